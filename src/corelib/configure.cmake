@@ -243,6 +243,45 @@ char buf[32];
 }
 ")
 
+# epoll
+qt_config_compile_test(epoll
+    LABEL "epoll"
+    CODE
+"#include <sys/epoll.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+struct epoll_event ev;
+int fd = epoll_create1(EPOLL_CLOEXEC);
+epoll_ctl(fd, EPOLL_CTL_ADD, 0, &ev);
+epoll_wait(fd, &ev, 1, 0);
+    /* END TEST: */
+    return 0;
+}
+")
+
+# io_uring
+qt_config_compile_test(io_uring
+    LABEL "io_uring"
+    CODE
+"#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+struct io_uring_params params = {};
+struct io_uring_getevents_arg arg = {};
+params.features = IORING_FEAT_EXT_ARG;
+int fd = syscall(__NR_io_uring_setup, 1, &params);
+syscall(__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    /* END TEST: */
+    return 0;
+}
+")
+
 # inotify
 qt_config_compile_test(inotify
     LABEL "inotify"
@@ -622,6 +661,11 @@ qt_feature("dladdr" PRIVATE
     LABEL "dladdr"
     CONDITION QT_FEATURE_dlopen AND TEST_dladdr
 )
+qt_feature("epoll" PRIVATE
+    LABEL "epoll event dispatcher"
+    PURPOSE "Provides an epoll(7) based event dispatcher, selectable with QT_EVENT_DISPATCHER_EPOLL."
+    CONDITION LINUX AND TEST_epoll
+)
 qt_feature("futimens" PRIVATE
     LABEL "futimens()"
     CONDITION NOT WIN32 AND TEST_futimens
@@ -650,6 +694,11 @@ qt_feature("inotify" PUBLIC PRIVATE
     CONDITION TEST_inotify
 )
 qt_feature_definition("inotify" "QT_NO_INOTIFY" NEGATE VALUE "1")
+qt_feature("io_uring" PRIVATE
+    LABEL "io_uring event dispatcher"
+    PURPOSE "Provides an io_uring(7) based event dispatcher, selectable with QT_EVENT_DISPATCHER_IO_URING."
+    CONDITION LINUX AND TEST_io_uring
+)
 qt_feature("ipc_posix"
     LABEL "Defaulting legacy IPC to POSIX"
     CONDITION TEST_posix_shm AND TEST_posix_sem AND (
@@ -1066,6 +1115,16 @@ qt_feature("cborstreamwriter" PUBLIC
     LABEL "CBOR stream writing"
     PURPOSE "Provides support for writing the CBOR binary format."
 )
+qt_feature("jsonstreamreader" PUBLIC
+    SECTION "Utilities"
+    LABEL "JSON stream reading"
+    PURPOSE "Provides support for reading JSON documents incrementally."
+)
+qt_feature("jsonstreamwriter" PUBLIC
+    SECTION "Utilities"
+    LABEL "JSON stream writing"
+    PURPOSE "Provides support for writing JSON documents incrementally."
+)
 qt_feature("poll-exit-on-error" PRIVATE
     LABEL "Poll exit on error"
     AUTODETECT OFF
@@ -1090,6 +1149,8 @@ qt_configure_add_summary_entry(ARGS "cxx23_stacktrace")
 qt_configure_add_summary_entry(ARGS "doubleconversion")
 qt_configure_add_summary_entry(ARGS "system-doubleconversion")
 qt_configure_add_summary_entry(ARGS "forkfd_pidfd" CONDITION LINUX)
+qt_configure_add_summary_entry(ARGS "epoll" CONDITION LINUX)
+qt_configure_add_summary_entry(ARGS "io_uring" CONDITION LINUX)
 qt_configure_add_summary_entry(ARGS "glib")
 qt_configure_add_summary_entry(ARGS "icu")
 qt_configure_add_summary_entry(ARGS "timezone_tzdb")
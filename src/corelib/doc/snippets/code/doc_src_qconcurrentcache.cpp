@@ -0,0 +1,22 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+// up to 64 MiB of decoded images, costed in KiB
+QConcurrentCache<QString, QImage> imageCache(64 * 1024);
+
+QImage loadImage(const QString &fileName)
+{
+    if (std::optional<QImage> cached = imageCache.find(fileName))
+        return *cached;
+    QImage image(fileName);
+    imageCache.insert(fileName, image, image.sizeInBytes() / 1024);
+    return image;
+}
+//! [0]
+
+
+//! [1]
+QConcurrentCache<QUrl, QByteArray> responses(1000);
+responses.setTimeToLive(std::chrono::minutes(5));
+//! [1]
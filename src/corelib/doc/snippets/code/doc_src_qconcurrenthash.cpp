@@ -0,0 +1,22 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QConcurrentHash<QString, QImage> thumbnails;
+
+// called from many threads at once
+QImage thumbnail(const QString &fileName)
+{
+    return thumbnails.findOrInsert(fileName, [&] {
+        return QImage(fileName).scaled(128, 128, Qt::KeepAspectRatio);
+    });
+}
+//! [0]
+
+
+//! [1]
+QConcurrentHash<QString, int> wordCount;
+...
+wordCount.insertIfAbsent(word, 0);
+wordCount.modify(word, [](int &count) { ++count; });
+//! [1]
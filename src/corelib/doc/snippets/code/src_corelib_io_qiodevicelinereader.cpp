@@ -0,0 +1,25 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QFile file("access.log");
+if (!file.open(QIODevice::ReadOnly))
+    return;
+
+qsizetype notFound = 0;
+QIODeviceLineReader reader(&file);
+for (QByteArrayView line : reader) {
+    if (line.contains(" 404 "))
+        ++notFound;
+}
+//! [0]
+
+//! [1]
+// reader is a member that reads from socket
+connect(socket, &QIODevice::readyRead, this, [this] {
+    while (reader.readNext())
+        handleLine(reader.line());
+    if (reader.atEnd())
+        socket->deleteLater();
+});
+//! [1]
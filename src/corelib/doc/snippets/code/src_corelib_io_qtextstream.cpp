@@ -84,3 +84,13 @@ out << "Qt rocks!" << Qt::endl;
 //! [9]
 stream << '\n' << Qt::flush;
 //! [9]
+
+
+//! [10]
+QTextStream in(&file);
+QStringView line;
+while (!(line = in.readLineView()).isNull()) {
+    if (line.startsWith(u"ERROR"))
+        errors.append(line.toString());  // copy what has to outlive the next read
+}
+//! [10]
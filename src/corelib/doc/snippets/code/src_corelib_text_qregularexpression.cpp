@@ -339,4 +339,12 @@ if (m.hasMatch()) {
 //! [36]
 }
 
+{
+//! [37]
+QRegularExpressionSet set({ R"(^ERROR\b)", R"(timeout)", R"(\bdisk\b)" });
+QList<qsizetype> matching = set.matchingPatterns(u"ERROR: disk read timeout"); // { 0, 1, 2 }
+bool any = set.matchesAny(u"INFO: all good"); // false
+//! [37]
+}
+
 }
@@ -58,3 +58,29 @@ QByteArray encodedString = fromUtf16(string); // Implicit conversion to QByteArr
 auto func = [&]() { return !fromUtf16.hasError() ? QByteArray(data) : "foo"_ba; }
 //! [5]
 }
+
+{
+//! [6]
+auto toUtf16 = QStringDecoder(QStringDecoder::Utf16BE);
+
+QString text;
+while (new_data_available()) {
+    QByteArray chunk = get_new_data();
+    text.truncate(0); // keeps the capacity
+    toUtf16.appendToBuffer(text, chunk);
+    process(text);
+}
+//! [6]
+}
+
+{
+//! [7]
+auto fromUtf16 = QStringEncoder(QStringEncoder::Utf32LE);
+
+QByteArray encoded;
+while (new_data_available()) {
+    QString chunk = get_new_data();
+    fromUtf16.appendToBuffer(encoded, chunk);
+}
+//! [7]
+}
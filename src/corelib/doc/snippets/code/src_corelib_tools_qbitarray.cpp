@@ -144,3 +144,22 @@ ba.fill(true, 1, 2);            // ba: [ 0, 1, 0, 0 ]
 ba.fill(true, 1, 3);            // ba: [ 0, 1, 1, 0 ]
 ba.fill(true, 1, 4);            // ba: [ 0, 1, 1, 1 ]
 //! [15]
+
+//! [16]
+QBitArray ba(1000);
+ba.setBit(3);
+ba.setBit(500);
+for (qsizetype i = ba.indexOf(true); i != -1; i = ba.indexOf(true, i + 1))
+    qDebug() << i;              // prints 3, 500
+//! [16]
+
+//! [17]
+QBitArray ba(100);
+ba.setBit(10);
+ba.setBit(20);
+ba.setBit(30);
+QBitArrayRankSelect index(ba);
+index.rank(25);                 // returns 2
+index.select(2);                // returns 30
+index.select(3);                // returns -1
+//! [17]
@@ -53,6 +53,8 @@
 #define QT_FEATURE_islamiccivilcalendar -1
 #define QT_FEATURE_jalalicalendar -1
 #define QT_FEATURE_journald -1
+#define QT_FEATURE_jsonstreamreader -1
+#define QT_FEATURE_jsonstreamwriter -1
 #define QT_FEATURE_futimens -1
 #undef QT_FEATURE_future
 #define QT_FEATURE_future -1
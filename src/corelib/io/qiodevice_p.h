@@ -72,6 +72,7 @@ public:
         inline qint64 nextDataBlockSize() const { return (m_buf ? m_buf->nextDataBlockSize() : Q_INT64_C(0)); }
         inline const char *readPointer() const { return (m_buf ? m_buf->readPointer() : nullptr); }
         inline const char *readPointerAtPosition(qint64 pos, qint64 &length) const { Q_ASSERT(m_buf); return m_buf->readPointerAtPosition(pos, length); }
+        QSpan<QByteArrayView> readPointers(QSpan<QByteArrayView> blocks, qint64 maxLength) const { return (m_buf ? m_buf->readPointers(blocks, maxLength) : QSpan<QByteArrayView>()); }
         inline void free(qint64 bytes) { Q_ASSERT(m_buf); m_buf->free(bytes); }
         inline char *reserve(qint64 bytes) { Q_ASSERT(m_buf); return m_buf->reserve(bytes); }
         inline char *reserveFront(qint64 bytes) { Q_ASSERT(m_buf); return m_buf->reserveFront(bytes); }
@@ -0,0 +1,280 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qiodevicelinereader.h"
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qfiledevice.h>
+#include <QtCore/qiodevice.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODeviceLineReaderPrivate
+{
+public:
+    enum { ChunkSize = 64 * 1024 };
+    enum FillResult { DataRead, NoDataYet, EndOfData };
+
+    FillResult fill();
+    bool atEndOfData(qint64 lastRead) const;
+    void setLine(qsizetype from, qsizetype to);
+
+    QIODevice *device = nullptr;
+    QByteArray buffer;
+    qsizetype begin = 0;        // start of the unconsumed data
+    qsizetype end = 0;          // end of the valid data
+    qsizetype scanned = 0;      // [begin, scanned) is known to contain no '\n'
+    QByteArrayView line;
+    bool finished = false;
+};
+
+/*!
+    \internal
+
+    Moves the unconsumed data to the front of the buffer, grows the buffer
+    if it is full, and reads as much as fits from the device.
+*/
+QIODeviceLineReaderPrivate::FillResult QIODeviceLineReaderPrivate::fill()
+{
+    if (begin > 0) {
+        if (end > begin)
+            memmove(buffer.data(), buffer.constData() + begin, size_t(end - begin));
+        end -= begin;
+        scanned -= begin;
+        begin = 0;
+    }
+    if (end == buffer.size())
+        buffer.resize(qMax<qsizetype>(ChunkSize, buffer.size() * 2));
+
+    const qint64 n = device->read(buffer.data() + end, buffer.size() - end);
+    if (n > 0) {
+        end += qsizetype(n);
+        return DataRead;
+    }
+    return atEndOfData(n) ? EndOfData : NoDataYet;
+}
+
+/*!
+    \internal
+
+    Returns \c true if a read() that returned \a lastRead bytes means that
+    the device has no more data. Sockets and processes signal the end of
+    their data with -1, and return 0 while they wait for more; sequential
+    files, such as pipes, block in read() and return 0 at their end.
+*/
+bool QIODeviceLineReaderPrivate::atEndOfData(qint64 lastRead) const
+{
+    if (lastRead < 0 || !device->isOpen() || !device->isReadable())
+        return true;
+    if (!device->isSequential())
+        return device->atEnd();
+    return qobject_cast<const QFileDevice *>(device) != nullptr;
+}
+
+void QIODeviceLineReaderPrivate::setLine(qsizetype from, qsizetype to)
+{
+    if (to > from && buffer.at(to - 1) == '\r')
+        --to;
+    line = QByteArrayView(buffer.constData() + from, to - from);
+}
+
+/*!
+    \class QIODeviceLineReader
+    \inmodule QtCore
+    \since 6.10
+    \reentrant
+    \ingroup io
+    \ingroup string-processing
+
+    \brief The QIODeviceLineReader class reads lines from a QIODevice
+    without copying or decoding them.
+
+    QIODeviceLineReader splits the data of a QIODevice into lines and hands
+    them out as QByteArrayView or QUtf8StringView. Unlike QTextStream, it
+    does not decode the data to UTF-16, and unlike QIODevice::readLine(), it
+    does not allocate a QByteArray for every line: the lines are views into
+    the reader's internal buffer. This makes it the fastest way to scan large
+    UTF-8 or ASCII text files, such as logs or CSV data, line by line.
+
+    \snippet code/src_corelib_io_qiodevicelinereader.cpp 0
+
+    Lines are terminated by \c{"\n"} or \c{"\r\n"}; the terminator is not part
+    of the line. If the data does not end with a line terminator, the
+    remaining data is returned as the last line.
+
+    With sequential devices such as QTcpSocket, QLocalSocket or QProcess,
+    the data of a line may not all have arrived yet. readNext() then returns
+    \c false but keeps the partial line buffered, and atEnd() returns
+    \c false; call readNext() again once the device has emitted
+    \l{QIODevice::}{readyRead()}:
+
+    \snippet code/src_corelib_io_qiodevicelinereader.cpp 1
+
+    The view returned by line() and utf8Line() is valid until the next call
+    to readNext() or setDevice(), or until the reader is destroyed. Copy the
+    data, for instance with QByteArrayView::toByteArray(), if you need to keep
+    it longer.
+
+    QIODeviceLineReader reads ahead in blocks of 64 KiB, and more if a single
+    line does not fit. Data that it has read from the device but not yet
+    returned as a line is lost when the reader is destroyed. Do not read from
+    the device by other means while a reader is using it.
+
+    QIODeviceLineReader does not validate the data; utf8Line() returns a view
+    of whatever bytes the line contains.
+
+    \sa QTextStream::readLineView(), QIODevice::readLine()
+*/
+
+/*!
+    Constructs a line reader that reads from \a device. The device must be
+    open for reading.
+*/
+QIODeviceLineReader::QIODeviceLineReader(QIODevice *device)
+    : d(new QIODeviceLineReaderPrivate)
+{
+    d->device = device;
+}
+
+/*!
+    Destroys the line reader. Data that has been read from the device but not
+    yet returned by readNext() is discarded.
+*/
+QIODeviceLineReader::~QIODeviceLineReader() = default;
+
+/*!
+    Sets the device to read from to \a device, and discards any data that has
+    been buffered from the previous device.
+
+    \sa device()
+*/
+void QIODeviceLineReader::setDevice(QIODevice *device)
+{
+    d->device = device;
+    d->begin = d->end = d->scanned = 0;
+    d->line = QByteArrayView();
+    d->finished = false;
+}
+
+/*!
+    Returns the device that the reader reads from, or \nullptr if no device
+    has been set.
+
+    \sa setDevice()
+*/
+QIODevice *QIODeviceLineReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Reads the next line. Returns \c true if a line was read, and \c false if
+    the end of the data has been reached, no device is set, or the device
+    has no complete line available yet. Use atEnd() to tell these apart.
+    The line is available through line() and utf8Line() afterwards.
+
+    The remaining data is only returned as a last line without terminator
+    once the device has reached its end: when a non-sequential device is
+    at its end, a sequential device's read() returns -1 (sockets and
+    processes do so once closed or finished), or the device is closed.
+
+    Calling this function invalidates the views previously returned by line()
+    and utf8Line().
+*/
+bool QIODeviceLineReader::readNext()
+{
+    if (!d->device || d->finished) {
+        d->line = QByteArrayView();
+        d->finished = true;
+        return false;
+    }
+
+    for (;;) {
+        const char *data = d->buffer.constData();
+        if (auto nl = static_cast<const char *>(memchr(data + d->scanned, '\n',
+                                                       size_t(d->end - d->scanned)))) {
+            const qsizetype pos = nl - data;
+            d->setLine(d->begin, pos);
+            d->begin = d->scanned = pos + 1;
+            return true;
+        }
+        d->scanned = d->end;
+
+        switch (d->fill()) {
+        case QIODeviceLineReaderPrivate::DataRead:
+            continue;
+        case QIODeviceLineReaderPrivate::NoDataYet:
+            // keep the partial line for the next call
+            d->line = QByteArrayView();
+            return false;
+        case QIODeviceLineReaderPrivate::EndOfData:
+            if (d->begin == d->end) {
+                d->line = QByteArrayView();
+                d->finished = true;
+                return false;
+            }
+            d->setLine(d->begin, d->end);
+            d->begin = d->scanned = d->end;
+            return true;
+        }
+    }
+}
+
+/*!
+    Returns the line read by the last call to readNext(), without the line
+    terminator. If readNext() has not been called yet, or returned \c false,
+    a null view is returned.
+
+    \sa utf8Line()
+*/
+QByteArrayView QIODeviceLineReader::line() const
+{
+    return d->line;
+}
+
+/*!
+    \fn QUtf8StringView QIODeviceLineReader::utf8Line() const
+
+    Returns the line read by the last call to readNext() as a QUtf8StringView.
+    The data is not validated.
+
+    \sa line()
+*/
+
+/*!
+    Returns \c true if readNext() has returned \c false because all lines
+    have been read, and \c false if it may return more lines later.
+*/
+bool QIODeviceLineReader::atEnd() const
+{
+    return d->finished;
+}
+
+/*!
+    \class QIODeviceLineReader::iterator
+    \inmodule QtCore
+    \since 6.10
+
+    \brief An input iterator over the lines of a QIODeviceLineReader.
+
+    This iterator allows using QIODeviceLineReader in a range-based
+    \c for loop. Dereferencing it returns the current line as a
+    QByteArrayView; incrementing it reads the next line.
+*/
+
+/*!
+    \fn QIODeviceLineReader::iterator QIODeviceLineReader::begin()
+
+    Reads the first line and returns an iterator pointing to it. If there
+    are no more lines, returns end().
+*/
+
+/*!
+    \fn QIODeviceLineReader::iterator QIODeviceLineReader::end()
+
+    Returns the sentinel iterator reached after the last line.
+*/
+
+QT_END_NAMESPACE
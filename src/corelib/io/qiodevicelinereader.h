@@ -0,0 +1,74 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIODEVICELINEREADER_H
+#define QIODEVICELINEREADER_H
+
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <iterator>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QIODeviceLineReaderPrivate;
+
+class Q_CORE_EXPORT QIODeviceLineReader
+{
+public:
+    explicit QIODeviceLineReader(QIODevice *device = nullptr);
+    ~QIODeviceLineReader();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    bool readNext();
+    QByteArrayView line() const;
+    QUtf8StringView utf8Line() const
+    {
+        const QByteArrayView l = line();
+        return QUtf8StringView(l.data(), l.size());
+    }
+    bool atEnd() const;
+
+    class iterator
+    {
+        QIODeviceLineReader *reader = nullptr;
+        friend class QIODeviceLineReader;
+        explicit iterator(QIODeviceLineReader *r) noexcept : reader(r) {}
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = QByteArrayView;
+        using difference_type = qptrdiff;
+        using pointer = const QByteArrayView *;
+        using reference = QByteArrayView;
+
+        constexpr iterator() noexcept = default;
+
+        QByteArrayView operator*() const { return reader->line(); }
+        iterator &operator++()
+        {
+            if (!reader->readNext())
+                reader = nullptr;
+            return *this;
+        }
+
+        friend bool operator==(iterator lhs, iterator rhs) noexcept
+        { return lhs.reader == rhs.reader; }
+        friend bool operator!=(iterator lhs, iterator rhs) noexcept
+        { return lhs.reader != rhs.reader; }
+    };
+
+    iterator begin() { return readNext() ? iterator(this) : iterator(); }
+    iterator end() noexcept { return iterator(); }
+
+private:
+    Q_DISABLE_COPY_MOVE(QIODeviceLineReader)
+    std::unique_ptr<QIODeviceLineReaderPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIODEVICELINEREADER_H
@@ -1087,13 +1087,23 @@ bool QProcessPrivate::_q_canWrite()
 
 bool QProcessPrivate::writeToStdin()
 {
-    const char *data = writeBuffer.readPointer();
-    const qint64 bytesToWrite = writeBuffer.nextDataBlockSize();
+    // Write all buffered chunks with one system call, so that many small
+    // writes to the process do not cost one write() each.
+    constexpr qsizetype MaxBlocks = 16;
+    QByteArrayView blocks[MaxBlocks];
+    const QSpan<QByteArrayView> pending = writeBuffer.readPointers(blocks, writeBuffer.size());
+    iovec iov[MaxBlocks];
+    for (qsizetype i = 0; i < pending.size(); ++i) {
+        iov[i].iov_base = const_cast<char *>(pending[i].data());
+        iov[i].iov_len = size_t(pending[i].size());
+    }
 
-    qint64 written = qt_safe_write_nosignal(stdinChannel.pipe[1], data, bytesToWrite);
+    qint64 written = qt_safe_writev_nosignal(stdinChannel.pipe[1], iov, int(pending.size()));
 #if defined QPROCESS_DEBUG
-    qDebug("QProcessPrivate::writeToStdin(), write(%p \"%s\", %lld) == %lld", data,
-           QtDebugUtils::toPrintable(data, bytesToWrite, 16).constData(), bytesToWrite, written);
+    const char *data = writeBuffer.readPointer();
+    qDebug("QProcessPrivate::writeToStdin(), writev(%p \"%s\", %lld bytes in %lld blocks) == %lld",
+           data, QtDebugUtils::toPrintable(data, writeBuffer.nextDataBlockSize(), 16).constData(),
+           writeBuffer.size(), qint64(pending.size()), written);
     if (written == -1)
         qDebug("QProcessPrivate::writeToStdin(), failed to write (%ls)", qUtf16Printable(qt_error_string(errno)));
 #endif
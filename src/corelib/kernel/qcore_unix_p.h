@@ -28,6 +28,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if !defined (Q_OS_VXWORKS)
@@ -367,6 +368,19 @@ static inline qint64 qt_safe_write_nosignal(int fd, const void *data, qint64 len
     return qt_safe_write(fd, data, len);
 }
 
+static inline qint64 qt_safe_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    qint64 ret = 0;
+    QT_EINTR_LOOP(ret, ::writev(fd, iov, iovcnt));
+    return ret;
+}
+
+static inline qint64 qt_safe_writev_nosignal(int fd, const struct iovec *iov, int iovcnt)
+{
+    qt_ignore_sigpipe();
+    return qt_safe_writev(fd, iov, iovcnt);
+}
+
 static inline int qt_safe_close(int fd)
 {
     int ret;
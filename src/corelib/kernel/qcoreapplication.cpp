@@ -357,7 +357,9 @@ Q_CONSTINIT bool QCoreApplicationPrivate::is_app_closing = false;
 
 qsizetype qGlobalPostedEventsCount()
 {
-    const QPostEventList &l = QThreadData::current()->postEventList;
+    QPostEventList &l = QThreadData::current()->postEventList;
+    QMutexLocker locker(&l.mutex);
+    l.takeIncoming();
     return l.size() - l.startOffset;
 }
 
@@ -497,6 +499,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        thisThreadData->postEventList.takeIncoming();
         for (const QPostEvent &pe : std::as_const(thisThreadData->postEventList)) {
             if (pe.event) {
                 pe.receiver->d_func()->postedEvents.fetchAndSubAcquire(1);
@@ -1644,6 +1647,16 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // Queued signal emissions are by far the most common events posted across
+    // threads. Qt does not compress them, so they do not need to see the list
+    // and can be pushed onto the receiving thread's incoming stack without
+    // locking its mutex. That bypasses compressEvent(), too.
+    if (event->type() == QEvent::MetaCall) {
+        QCoreApplicationPrivate::postEventWithoutLocking(
+                receiver, static_cast<QAbstractMetaCallEvent *>(event), priority);
+        return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1653,6 +1666,9 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
 
     QThreadData *data = locker.threadData;
 
+    // keep the order in which this thread posted events
+    data->postEventList.takeIncoming();
+
     // if this is one of the compressible events, do compression
     if (receiver->d_func()->postedEvents.loadAcquire()
         && self && self->compressEvent(event, receiver, &data->postEventList)) {
@@ -1676,9 +1692,57 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         dispatcher->wakeUp();
 }
 
+/*!
+  \internal
+
+  Posts \a event to \a receiver by pushing it onto the incoming stack of the
+  receiver's thread, so that posting threads neither block each other nor the
+  receiving thread. The stack is emptied into the posted event list, keeping
+  the \a priority order, whenever that list is locked. The stack is linked
+  through the events themselves, so posting allocates nothing.
+*/
+void QCoreApplicationPrivate::postEventWithoutLocking(QObject *receiver, QAbstractMetaCallEvent *event,
+                                                      int priority)
+{
+    std::unique_ptr<QEvent> eventDeleter(event);
+
+    // Register as a producer of the thread's list before checking that the
+    // receiver still lives there, so that QObject::moveToThread() either
+    // waits for us to finish or we see the new thread. This pairs with the
+    // fence in moveToThread().
+    auto &threadData = QObjectPrivate::get(receiver)->threadData;
+    QThreadData *data;
+    for (;;) {
+        data = threadData.loadAcquire();
+        if (!data) {
+            // posting during destruction? just delete the event to prevent a leak
+            return;
+        }
+        data->postEventList.incomingProducers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (data == threadData.loadAcquire())
+            break;
+        data->postEventList.incomingProducers.fetch_sub(1, std::memory_order_release);
+    }
+
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type());
+    Q_UNUSED(eventDeleter.release());
+    event->m_posted = true;
+    receiver->d_func()->postedEvents.fetchAndAddRelease(1);
+    data->postEventList.pushIncoming(receiver, event, priority);
+    data->postEventList.incomingProducers.fetch_sub(1, std::memory_order_release);
+
+    QAbstractEventDispatcher* dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+}
+
 /*!
   \internal
   Returns \c true if \a event was compressed away (possibly deleted) and should not be added to the list.
+
+  QEvent::MetaCall events are posted without locking the list and are never
+  passed to this function.
 */
 #if QT_VERSION < QT_VERSION_CHECK(7, 0, 0)
 bool QCoreApplication::compressEvent(QEvent *event, QObject *receiver, QPostEventList *postedEvents)
@@ -1769,6 +1833,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    data->postEventList.takeIncoming();
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -1936,6 +2001,8 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
     if (receiver && !receiver->d_func()->postedEvents.loadAcquire())
         return;
 
+    data->postEventList.takeIncoming();
+
     //we will collect all the posted events for the QObject
     //and we'll delete after the mutex was unlocked
     QVarLengthArray<QEvent*> events;
@@ -1991,6 +2058,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    data->postEventList.takeIncoming();
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
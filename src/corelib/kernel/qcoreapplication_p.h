@@ -123,6 +123,8 @@ public:
         void unlock() { locker.unlock(); }
     };
     static QPostEventListLocker lockThreadPostEventList(QObject *object);
+    static void postEventWithoutLocking(QObject *receiver, QAbstractMetaCallEvent *event,
+                                        int priority);
 #endif // QT_NO_QOBJECT
 
     int &argc;
@@ -0,0 +1,261 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplatformdefs.h"
+
+#include "qcoreapplication.h"
+#include "qsocketnotifier.h"
+
+#include "qeventdispatcher_epoll_p.h"
+#include <private/qthread_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <errno.h>
+
+QT_BEGIN_NAMESPACE
+
+// We hand the poll(2) flags computed by QSocketNotifierSetUNIX straight to
+// epoll_ctl() and feed the results back into the poll-based bookkeeping of
+// QEventDispatcherUNIXPrivate, so the two sets of flags must agree.
+static_assert(EPOLLIN == POLLIN);
+static_assert(EPOLLOUT == POLLOUT);
+static_assert(EPOLLPRI == POLLPRI);
+static_assert(EPOLLERR == POLLERR);
+static_assert(EPOLLHUP == POLLHUP);
+
+// Upper bound for the number of events we collect per epoll_wait() call.
+// Anything beyond that stays queued in the kernel for the next iteration.
+static constexpr qsizetype MaxEventsPerWait = 4096;
+
+QEventDispatcherEpollPrivate::QEventDispatcherEpollPrivate()
+{
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (Q_UNLIKELY(epollFd == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Cannot create epoll descriptor: %s",
+               qPrintable(qt_error_string()));
+
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = threadPipe.fds[0];
+    if (Q_UNLIKELY(epoll_ctl(epollFd, EPOLL_CTL_ADD, ev.data.fd, &ev) == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Cannot watch the thread pipe: %s",
+               qPrintable(qt_error_string()));
+
+    events.resize(events.capacity());
+}
+
+QEventDispatcherEpollPrivate::~QEventDispatcherEpollPrivate()
+{
+    if (epollFd != -1)
+        qt_safe_close(epollFd);
+}
+
+/*!
+    \internal
+
+    Brings the kernel interest set for \a fd from \a oldEvents to \a newEvents.
+    Only called when the notifiers registered for a descriptor change, so the
+    cost of the event loop no longer depends on the number of notifiers.
+*/
+void QEventDispatcherEpollPrivate::updateInterest(int fd, short oldEvents, short newEvents)
+{
+    if (oldEvents == newEvents)
+        return;
+
+    if (const auto it = std::find(alwaysReadyFds.begin(), alwaysReadyFds.end(), fd);
+            it != alwaysReadyFds.end()) {
+        if (newEvents == 0)
+            alwaysReadyFds.erase(it);
+        return;
+    }
+
+    if (newEvents == 0) {
+        // ENOENT and EBADF mean that the descriptor was closed before its
+        // notifiers were disabled, which already removed it from the set
+        if (epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr) == -1 && errno != ENOENT && errno != EBADF)
+            qErrnoWarning("QEventDispatcherEpoll: cannot stop watching socket %d", fd);
+        return;
+    }
+
+    epoll_event ev = {};
+    ev.events = quint32(newEvents);
+    ev.data.fd = fd;
+
+    int op = oldEvents ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    int ret = epoll_ctl(epollFd, op, fd, &ev);
+    if (ret == -1 && op == EPOLL_CTL_MOD && errno == ENOENT) {
+        // the descriptor was closed and reopened behind our back
+        op = EPOLL_CTL_ADD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    } else if (ret == -1 && op == EPOLL_CTL_ADD && errno == EEXIST) {
+        op = EPOLL_CTL_MOD;
+        ret = epoll_ctl(epollFd, op, fd, &ev);
+    }
+
+    if (ret == -1) {
+        if (errno == EPERM)
+            alwaysReadyFds.append(fd);
+        else
+            qErrnoWarning("QEventDispatcherEpoll: cannot watch socket %d", fd);
+    }
+}
+
+/*!
+    \internal
+
+    Unlike the base implementation, only the ready socket descriptors end up
+    in pollfds, so the cost is independent of the number of notifiers.
+*/
+int QEventDispatcherEpollPrivate::waitForEvents(QDeadlineTimer deadline, bool includeNotifiers)
+{
+    // Waiting on the thread pipe alone is what poll() is good at
+    if (!includeNotifiers)
+        return QEventDispatcherUNIXPrivate::waitForEvents(deadline, includeNotifiers);
+
+    pollfds.clear();
+
+    for (int fd : std::as_const(alwaysReadyFds)) {
+        pollfd pfd = qt_make_pollfd(fd, socketNotifiers.value(fd).events());
+        pfd.revents = pfd.events & (POLLIN | POLLOUT);
+        pollfds.append(pfd);
+    }
+    if (!pollfds.isEmpty())
+        deadline = QDeadlineTimer();
+
+    int n;
+    QT_EINTR_LOOP(n, epoll_wait(epollFd, events.data(), int(events.size()), 0));
+    if (n == 0 && !deadline.hasExpired()) {
+        // Nothing is ready yet. Block on the epoll descriptor itself, which
+        // becomes readable once any descriptor in its interest set is ready,
+        // so we get the same timeout precision and signal handling as the
+        // poll-based dispatcher for a constant-size poll set.
+        pollfd pfd = qt_make_pollfd(epollFd, POLLIN);
+        const int ret = qt_safe_poll(&pfd, 1, deadline);
+        if (ret == -1)
+            qErrnoWarning("qt_safe_poll");
+        if (ret <= 0)
+            return ret;
+        QT_EINTR_LOOP(n, epoll_wait(epollFd, events.data(), int(events.size()), 0));
+    }
+    if (n == -1) {
+        qErrnoWarning("epoll_wait");
+        return -1;
+    }
+
+    pollfd pipe = qt_make_pollfd(threadPipe.fds[0], POLLIN);
+    for (int i = 0; i < n; ++i) {
+        const epoll_event &ev = events[i];
+        if (ev.data.fd == pipe.fd) {
+            pipe.revents = short(ev.events);
+            continue;
+        }
+        // A descriptor that was dup()ed and then closed stays in the interest
+        // set under its old number; ignore whatever it reports.
+        if (!socketNotifiers.contains(ev.data.fd))
+            continue;
+        pollfd pfd = qt_make_pollfd(ev.data.fd, 0);
+        pfd.revents = short(ev.events);
+        pollfds.append(pfd);
+    }
+
+    // if the buffer was filled, there may be more; collect them next time
+    if (n == events.size() && events.size() < MaxEventsPerWait)
+        events.resize(events.size() * 2);
+
+    if (pollfds.isEmpty() && pipe.revents == 0)
+        return 0;
+
+    // This must be last, as it's popped off the end by processEvents()
+    pollfds.append(pipe);
+    return int(pollfds.size());
+}
+
+/*!
+    \class QEventDispatcherEpoll
+    \internal
+
+    An event dispatcher for Linux that keeps the socket notifiers in a
+    persistent epoll(7) interest set, updated whenever a notifier is enabled or
+    disabled, instead of building a pollfd array on every loop iteration. This
+    makes each event loop iteration cost proportional to the number of ready
+    descriptors rather than the number of registered notifiers.
+
+    Notifiers are level-triggered, like with QEventDispatcherUNIX: a notifier
+    fires again as long as its descriptor stays ready.
+
+    Set the environment variable \c QT_EVENT_DISPATCHER_EPOLL to a positive
+    value to use it instead of the default dispatcher for new threads.
+*/
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QObject *parent)
+    : QEventDispatcherUNIX(*new QEventDispatcherEpollPrivate, parent)
+{ }
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QEventDispatcherEpollPrivate &dd, QObject *parent)
+    : QEventDispatcherUNIX(dd, parent)
+{ }
+
+QEventDispatcherEpoll::~QEventDispatcherEpoll()
+{ }
+
+/*!
+    \internal
+
+    Returns \c true if the running kernel provides epoll(7).
+*/
+bool QEventDispatcherEpoll::isSupported()
+{
+    static const bool supported = [] {
+        const int fd = epoll_create1(EPOLL_CLOEXEC);
+        if (fd == -1)
+            return false;
+        qt_safe_close(fd);
+        return true;
+    }();
+    return supported;
+}
+
+void QEventDispatcherEpoll::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    Q_D(QEventDispatcherEpoll);
+    const int sockfd = notifier->socket();
+    const short oldEvents = d->socketNotifiers.value(sockfd).events();
+
+    QEventDispatcherUNIX::registerSocketNotifier(notifier);
+
+    d->updateInterest(sockfd, oldEvents, d->socketNotifiers.value(sockfd).events());
+}
+
+void QEventDispatcherEpoll::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    Q_D(QEventDispatcherEpoll);
+    const int sockfd = notifier->socket();
+    const short oldEvents = d->socketNotifiers.value(sockfd).events();
+
+    QEventDispatcherUNIX::unregisterSocketNotifier(notifier);
+
+    d->updateInterest(sockfd, oldEvents, d->socketNotifiers.value(sockfd).events());
+}
+
+/*!
+    \internal
+
+    Unlike QEventDispatcherUNIX, counts the events posted since the last pass
+    as the events that \a flags may ask us to wait for, like the Glib
+    dispatcher does, instead of blocking right after delivering them.
+*/
+bool QEventDispatcherEpoll::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherEpoll);
+    if (d->threadData.loadRelaxed()->canWaitLocked())
+        return QEventDispatcherUNIX::processEvents(flags);
+
+    QEventDispatcherUNIX::processEvents(flags & ~QEventLoop::WaitForMoreEvents);
+    return true;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_epoll_p.cpp"
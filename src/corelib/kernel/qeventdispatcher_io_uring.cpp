@@ -0,0 +1,421 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplatformdefs.h"
+
+#include "qsocketnotifier.h"
+
+#include "qeventdispatcher_io_uring_p.h"
+#include <private/qthread_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+QT_BEGIN_NAMESPACE
+
+static constexpr unsigned SubmissionQueueSize = 256;
+static constexpr unsigned CompletionQueueSize = 16384;
+
+// SINGLE_MMAP and EXT_ARG (Linux 5.11) let us map both rings at once and wait
+// with a timeout without a separate timeout request; NODROP makes the kernel
+// keep completions instead of dropping them when the completion ring is full.
+static constexpr quint32 RequiredFeatures =
+        IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+
+// user_data of the requests cancelling a poll; their completions are ignored
+static constexpr quint64 CancelToken = ~quint64(0);
+
+static int createRing(io_uring_params *params)
+{
+    *params = {};
+    params->flags = IORING_SETUP_CQSIZE;
+    params->cq_entries = CompletionQueueSize;
+
+    const int fd = int(syscall(__NR_io_uring_setup, SubmissionQueueSize, params));
+    if (fd == -1)
+        return -1;
+
+    if ((params->features & RequiredFeatures) != RequiredFeatures) {
+        qt_safe_close(fd);
+        errno = ENOSYS;
+        return -1;
+    }
+    return fd;
+}
+
+QEventDispatcherIoUringPrivate::QEventDispatcherIoUringPrivate()
+{
+    io_uring_params params;
+    ringFd = createRing(&params);
+    if (Q_UNLIKELY(ringFd == -1))
+        qFatal("QEventDispatcherIoUringPrivate(): Cannot create io_uring instance: %s",
+               qPrintable(qt_error_string()));
+
+    const size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    const size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    ringSize = qMax(sqSize, cqSize);
+    ringMemory = mmap(nullptr, ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd, IORING_OFF_SQ_RING);
+    if (Q_UNLIKELY(ringMemory == MAP_FAILED))
+        qFatal("QEventDispatcherIoUringPrivate(): Cannot map io_uring rings: %s",
+               qPrintable(qt_error_string()));
+
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqesMemory = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ringFd, IORING_OFF_SQES);
+    if (Q_UNLIKELY(sqesMemory == MAP_FAILED))
+        qFatal("QEventDispatcherIoUringPrivate(): Cannot map io_uring submissions: %s",
+               qPrintable(qt_error_string()));
+    sqes = static_cast<io_uring_sqe *>(sqesMemory);
+
+    char *ring = static_cast<char *>(ringMemory);
+    sqHead = reinterpret_cast<unsigned *>(ring + params.sq_off.head);
+    sqTail = reinterpret_cast<unsigned *>(ring + params.sq_off.tail);
+    sqArray = reinterpret_cast<unsigned *>(ring + params.sq_off.array);
+    sqMask = *reinterpret_cast<unsigned *>(ring + params.sq_off.ring_mask);
+    sqEntries = params.sq_entries;
+    sqLocalTail = *sqTail;
+
+    cqHead = reinterpret_cast<unsigned *>(ring + params.cq_off.head);
+    cqTail = reinterpret_cast<unsigned *>(ring + params.cq_off.tail);
+    cqes = reinterpret_cast<io_uring_cqe *>(ring + params.cq_off.cqes);
+    cqMask = *reinterpret_cast<unsigned *>(ring + params.cq_off.ring_mask);
+}
+
+QEventDispatcherIoUringPrivate::~QEventDispatcherIoUringPrivate()
+{
+    if (sqes)
+        munmap(sqes, sqesSize);
+    if (ringMemory && ringMemory != MAP_FAILED)
+        munmap(ringMemory, ringSize);
+    if (ringFd != -1)
+        qt_safe_close(ringFd);
+}
+
+/*!
+    \internal
+
+    Returns a cleared submission queue entry, flushing the queue to the kernel
+    first if it is full. Returns \nullptr if the kernel did not accept the
+    pending entries.
+*/
+io_uring_sqe *QEventDispatcherIoUringPrivate::nextSubmission()
+{
+    if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+        submitAndWait(QDeadlineTimer());
+        if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+            return nullptr;
+    }
+
+    const unsigned index = sqLocalTail & sqMask;
+    sqArray[index] = index;
+    ++sqLocalTail;
+
+    io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+void QEventDispatcherIoUringPrivate::queuePoll(int fd, short events, quint64 token)
+{
+    io_uring_sqe *sqe = nextSubmission();
+    if (Q_UNLIKELY(!sqe)) {
+        qErrnoWarning("QEventDispatcherIoUring: cannot watch socket %d", fd);
+        return;
+    }
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    sqe->poll32_events = (quint32(quint16(events)) << 16);
+#else
+    sqe->poll32_events = quint16(events);
+#endif
+    sqe->user_data = token;
+}
+
+void QEventDispatcherIoUringPrivate::queueCancel(quint64 token)
+{
+    io_uring_sqe *sqe = nextSubmission();
+    if (Q_UNLIKELY(!sqe)) {
+        qErrnoWarning("QEventDispatcherIoUring: cannot stop watching socket %d", int(quint32(token)));
+        return;
+    }
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = token;
+    sqe->user_data = CancelToken;
+}
+
+/*!
+    \internal
+
+    Hands all queued submissions to the kernel and, unless \a deadline has
+    already expired, waits until it for at least one completion, all in a
+    single system call. Returns 0 on timeout, a positive value if the call
+    succeeded, or -1 with errno set.
+*/
+int QEventDispatcherIoUringPrivate::submitAndWait(QDeadlineTimer deadline)
+{
+    __atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+
+    for (;;) {
+        const unsigned toSubmit = sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        unsigned minComplete = 0;
+        unsigned flags = 0;
+        __kernel_timespec ts = {};
+        io_uring_getevents_arg arg = {};
+        if (!deadline.hasExpired()) {
+            minComplete = 1;
+            flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+            if (!deadline.isForever()) {
+                const nanoseconds remaining = deadline.remainingTimeAsDuration();
+                ts.tv_sec = duration_cast<seconds>(remaining).count();
+                ts.tv_nsec = (remaining % 1s).count();
+                arg.ts = quintptr(&ts);
+            }
+        }
+        if (toSubmit == 0 && minComplete == 0)
+            return 0;
+
+        const long ret = syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags,
+                                 flags ? &arg : nullptr, flags ? sizeof(arg) : 0);
+        if (ret >= 0)
+            return minComplete ? 1 : int(ret);
+        if (errno == EINTR)
+            continue;
+        if (errno == ETIME)
+            return 0;
+        return -1;
+    }
+}
+
+/*!
+    \internal
+
+    Processes all completions posted by the kernel. Ready socket descriptors
+    are appended to pollfds if \a includeNotifiers is \c true and are otherwise
+    only scheduled for re-arming, which reports them again once notifiers are
+    included. Returns \c true if there were any completions.
+*/
+bool QEventDispatcherIoUringPrivate::reapCompletions(bool includeNotifiers, pollfd *pipe)
+{
+    unsigned head = *cqHead;
+    const unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+    const bool any = head != tail;
+
+    for ( ; head != tail; ++head) {
+        const io_uring_cqe &cqe = cqes[head & cqMask];
+        if (cqe.user_data == CancelToken)
+            continue;
+
+        short revents = short(cqe.res);
+        if (cqe.res < 0)
+            revents = cqe.res == -EBADF ? POLLNVAL : POLLERR;
+
+        if (cqe.user_data == quint32(pipe->fd)) {
+            pipeArmed = false;
+            pipe->revents |= revents;
+            continue;
+        }
+
+        const int fd = int(quint32(cqe.user_data));
+        const auto it = watches.find(fd);
+        if (it == watches.end() || it->token != cqe.user_data)
+            continue;   // the poll was cancelled after it completed
+
+        it->armed = false;
+        rearmFds.append(fd);
+        if (includeNotifiers) {
+            pollfd pfd = qt_make_pollfd(fd, it->events);
+            pfd.revents = revents;
+            pollfds.append(pfd);
+        }
+    }
+
+    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    return any;
+}
+
+/*!
+    \internal
+
+    Brings the poll request for \a fd in line with \a newEvents. The new
+    request is only queued and reaches the kernel together with the next wait,
+    but cancellations are submitted right away: a pending poll holds a
+    reference to the socket, which would otherwise stay open after the caller
+    closes its descriptor.
+*/
+void QEventDispatcherIoUringPrivate::updateInterest(int fd, short newEvents)
+{
+    auto it = watches.find(fd);
+    if (it != watches.end()) {
+        if (it->events == newEvents)
+            return;
+        if (it->armed) {
+            queueCancel(it->token);
+            submitAndWait(QDeadlineTimer());
+        }
+        if (newEvents == 0) {
+            watches.erase(it);
+            return;
+        }
+    } else {
+        if (newEvents == 0)
+            return;
+        it = watches.insert(fd, Watch());
+    }
+
+    if (++generation == 0)
+        ++generation;
+    it->token = (quint64(generation) << 32) | quint32(fd);
+    it->events = newEvents;
+    it->armed = true;
+    queuePoll(fd, newEvents, it->token);
+}
+
+int QEventDispatcherIoUringPrivate::waitForEvents(QDeadlineTimer deadline, bool includeNotifiers)
+{
+    pollfds.clear();
+
+    if (includeNotifiers) {
+        for (int fd : std::as_const(rearmFds)) {
+            const auto it = watches.find(fd);
+            if (it == watches.end() || it->armed)
+                continue;
+            it->armed = true;
+            queuePoll(fd, it->events, it->token);
+        }
+        rearmFds.clear();
+    }
+
+    pollfd pipe = threadPipe.prepare();
+    if (!pipeArmed) {
+        queuePoll(pipe.fd, pipe.events, quint32(pipe.fd));
+        pipeArmed = true;
+    }
+
+    for (;;) {
+        const int ret = submitAndWait(deadline);
+        if (ret == -1 && errno != EBUSY && errno != EAGAIN) {
+            qErrnoWarning("io_uring_enter");
+            return -1;
+        }
+
+        reapCompletions(includeNotifiers, &pipe);
+        if (!pollfds.isEmpty() || pipe.revents || deadline.hasExpired())
+            break;
+        // only completions of cancelled polls or excluded notifiers; keep waiting
+    }
+
+    if (pollfds.isEmpty() && pipe.revents == 0)
+        return 0;
+
+    // This must be last, as it's popped off the end by processEvents()
+    pollfds.append(pipe);
+    return int(pollfds.size());
+}
+
+/*!
+    \class QEventDispatcherIoUring
+    \internal
+
+    An event dispatcher for Linux that waits for socket notifiers with
+    io_uring(7) poll requests. Changes to the set of enabled notifiers and
+    the re-arming of the notifiers that fired are queued in the submission
+    ring and handed to the kernel in the same io_uring_enter() call that waits
+    for the next events, so that a busy event loop iteration costs a single
+    system call however many notifiers changed, and nothing proportional to
+    the number of registered notifiers.
+
+    Notifiers are level-triggered, like with QEventDispatcherUNIX.
+
+    Only readiness goes through the ring: the dispatcher reports that a socket
+    can be read or written, and QNativeSocketEngine still transfers the data
+    with its own recv() and send() calls afterwards. Reads that complete
+    straight into QAbstractSocket's buffer would need a completion-based
+    mode in the socket engine, which is not implemented.
+
+    Set the environment variable \c QT_EVENT_DISPATCHER_IO_URING to a positive
+    value to use it for new threads. If the running kernel lacks io_uring or
+    the features it needs, the default dispatcher is used instead.
+*/
+
+QEventDispatcherIoUring::QEventDispatcherIoUring(QObject *parent)
+    : QEventDispatcherUNIX(*new QEventDispatcherIoUringPrivate, parent)
+{ }
+
+QEventDispatcherIoUring::QEventDispatcherIoUring(QEventDispatcherIoUringPrivate &dd, QObject *parent)
+    : QEventDispatcherUNIX(dd, parent)
+{ }
+
+QEventDispatcherIoUring::~QEventDispatcherIoUring()
+{ }
+
+/*!
+    \internal
+
+    Returns \c true if the running kernel lets us create an io_uring instance
+    with the features this dispatcher needs. It may have been disabled
+    through the kernel.io_uring_disabled sysctl or a seccomp filter.
+*/
+bool QEventDispatcherIoUring::isSupported()
+{
+    static const bool supported = [] {
+        io_uring_params params;
+        const int fd = createRing(&params);
+        if (fd == -1)
+            return false;
+        qt_safe_close(fd);
+        return true;
+    }();
+    return supported;
+}
+
+void QEventDispatcherIoUring::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    Q_D(QEventDispatcherIoUring);
+    QEventDispatcherUNIX::registerSocketNotifier(notifier);
+
+    const int sockfd = notifier->socket();
+    d->updateInterest(sockfd, d->socketNotifiers.value(sockfd).events());
+}
+
+void QEventDispatcherIoUring::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    Q_D(QEventDispatcherIoUring);
+    QEventDispatcherUNIX::unregisterSocketNotifier(notifier);
+
+    const int sockfd = notifier->socket();
+    d->updateInterest(sockfd, d->socketNotifiers.value(sockfd).events());
+}
+
+/*!
+    \internal
+
+    Unlike QEventDispatcherUNIX, counts the events posted since the last pass
+    as the events that \a flags may ask us to wait for, like the Glib
+    dispatcher does, instead of blocking right after delivering them.
+*/
+bool QEventDispatcherIoUring::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherIoUring);
+    if (d->threadData.loadRelaxed()->canWaitLocked())
+        return QEventDispatcherUNIX::processEvents(flags);
+
+    QEventDispatcherUNIX::processEvents(flags & ~QEventLoop::WaitForMoreEvents);
+    return true;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_io_uring_p.cpp"
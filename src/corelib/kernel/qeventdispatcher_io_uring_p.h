@@ -0,0 +1,104 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QEVENTDISPATCHER_IO_URING_P_H
+#define QEVENTDISPATCHER_IO_URING_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "private/qeventdispatcher_unix_p.h"
+
+#include <linux/io_uring.h>
+
+QT_REQUIRE_CONFIG(io_uring);
+
+QT_BEGIN_NAMESPACE
+
+class QEventDispatcherIoUringPrivate;
+
+class Q_CORE_EXPORT QEventDispatcherIoUring : public QEventDispatcherUNIX
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QEventDispatcherIoUring)
+
+public:
+    explicit QEventDispatcherIoUring(QObject *parent = nullptr);
+    ~QEventDispatcherIoUring();
+
+    static bool isSupported();
+
+    void registerSocketNotifier(QSocketNotifier *notifier) final;
+    void unregisterSocketNotifier(QSocketNotifier *notifier) final;
+
+    bool processEvents(QEventLoop::ProcessEventsFlags flags) override;
+
+protected:
+    QEventDispatcherIoUring(QEventDispatcherIoUringPrivate &dd, QObject *parent = nullptr);
+};
+
+class Q_CORE_EXPORT QEventDispatcherIoUringPrivate : public QEventDispatcherUNIXPrivate
+{
+    Q_DECLARE_PUBLIC(QEventDispatcherIoUring)
+
+public:
+    QEventDispatcherIoUringPrivate();
+    ~QEventDispatcherIoUringPrivate();
+
+    void updateInterest(int fd, short newEvents);
+    int waitForEvents(QDeadlineTimer deadline, bool includeNotifiers) override;
+
+    io_uring_sqe *nextSubmission();
+    void queuePoll(int fd, short events, quint64 token);
+    void queueCancel(quint64 token);
+    int submitAndWait(QDeadlineTimer deadline);
+    bool reapCompletions(bool includeNotifiers, pollfd *pipe);
+
+    int ringFd = -1;
+
+    // the submission and completion rings share one mapping
+    void *ringMemory = nullptr;
+    size_t ringSize = 0;
+    io_uring_sqe *sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned *sqHead = nullptr;
+    unsigned *sqTail = nullptr;
+    unsigned *sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned sqLocalTail = 0;
+
+    unsigned *cqHead = nullptr;
+    unsigned *cqTail = nullptr;
+    io_uring_cqe *cqes = nullptr;
+    unsigned cqMask = 0;
+
+    // Polls are one-shot, which gives the level-triggered behavior that
+    // QSocketNotifier users expect: a poll re-armed on a descriptor that is
+    // still ready completes right away. Each armed poll is identified by a
+    // token combining the descriptor with a generation counter, so that
+    // completions of polls that were since cancelled can be told apart.
+    struct Watch
+    {
+        quint64 token = 0;
+        short events = 0;
+        bool armed = false;
+    };
+    QHash<int, Watch> watches;
+    QList<int> rearmFds;
+    quint32 generation = 0;
+    bool pipeArmed = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QEVENTDISPATCHER_IO_URING_P_H
@@ -258,6 +258,33 @@ int QEventDispatcherUNIXPrivate::activateSocketNotifiers()
     return n_activated;
 }
 
+/*!
+    \internal
+
+    Waits until \a deadline for the thread pipe and, if \a includeNotifiers is
+    \c true, the registered socket notifiers to become ready. On success,
+    pollfds holds the socket descriptors followed by the thread pipe, which
+    processEvents() pops off the end before activating the notifiers. Returns
+    the number of ready descriptors, 0 on timeout or -1 on error.
+*/
+int QEventDispatcherUNIXPrivate::waitForEvents(QDeadlineTimer deadline, bool includeNotifiers)
+{
+    pollfds.clear();
+    pollfds.reserve(1 + (includeNotifiers ? socketNotifiers.size() : 0));
+
+    if (includeNotifiers)
+        for (auto it = socketNotifiers.cbegin(); it != socketNotifiers.cend(); ++it)
+            pollfds.append(qt_make_pollfd(it.key(), it.value().events()));
+
+    // This must be last, as it's popped off the end by processEvents()
+    pollfds.append(threadPipe.prepare());
+
+    const int ret = qt_safe_poll(pollfds.data(), pollfds.size(), deadline);
+    if (ret == -1)
+        qErrnoWarning("qt_safe_poll");
+    return ret;
+}
+
 QEventDispatcherUNIX::QEventDispatcherUNIX(QObject *parent)
     : QAbstractEventDispatcherV2(*new QEventDispatcherUNIXPrivate, parent)
 { }
@@ -445,20 +472,9 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
         // ensures the code in the do-while loop in qt_safe_poll runs at least once.
     }
 
-    d->pollfds.clear();
-    d->pollfds.reserve(1 + (include_notifiers ? d->socketNotifiers.size() : 0));
-
-    if (include_notifiers)
-        for (auto it = d->socketNotifiers.cbegin(); it != d->socketNotifiers.cend(); ++it)
-            d->pollfds.append(qt_make_pollfd(it.key(), it.value().events()));
-
-    // This must be last, as it's popped off the end below
-    d->pollfds.append(d->threadPipe.prepare());
-
     int nevents = 0;
-    switch (qt_safe_poll(d->pollfds.data(), d->pollfds.size(), deadline)) {
+    switch (d->waitForEvents(deadline, include_notifiers)) {
     case -1:
-        qErrnoWarning("qt_safe_poll");
         if (QT_CONFIG(poll_exit_on_error))
             abort();
         break;
@@ -72,8 +72,8 @@ public:
 
     bool processEvents(QEventLoop::ProcessEventsFlags flags) override;
 
-    void registerSocketNotifier(QSocketNotifier *notifier) final;
-    void unregisterSocketNotifier(QSocketNotifier *notifier) final;
+    void registerSocketNotifier(QSocketNotifier *notifier) override;
+    void unregisterSocketNotifier(QSocketNotifier *notifier) override;
 
     void registerTimer(Qt::TimerId timerId, Duration interval, Qt::TimerType timerType,
                        QObject *object) override final;
@@ -98,6 +98,7 @@ public:
     ~QEventDispatcherUNIXPrivate();
 
     int activateTimers();
+    virtual int waitForEvents(QDeadlineTimer deadline, bool includeNotifiers);
 
     void markPendingSocketNotifiers();
     int activateSocketNotifiers();
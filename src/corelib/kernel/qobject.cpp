@@ -1719,8 +1719,31 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
     if (threadPrivate && !bindingStatus) {
         bindingStatus = threadPrivate->addObjectWithPendingBindingStatusChange(this);
     }
+    currentData->postEventList.takeIncoming();
+    targetData->postEventList.takeIncoming();
     d_func()->setThreadData_helper(currentData, targetData, bindingStatus);
 
+    // Threads that did not see the new thread data yet may still push events
+    // for the moved objects onto the old thread's incoming stack without
+    // locking (see QCoreApplication::postEvent()). Wait for them and move
+    // those events, too. This pairs with the fence in postEventWithoutLocking().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    currentData->postEventList.waitForIncomingProducers();
+    currentData->postEventList.takeIncoming();
+    qsizetype eventsMoved = 0;
+    for (qsizetype i = 0; i < currentData->postEventList.size(); ++i) {
+        const QPostEvent &pe = currentData->postEventList.at(i);
+        if (pe.event && pe.receiver->d_func()->threadData.loadRelaxed() == targetData) {
+            targetData->postEventList.addEvent(pe);
+            const_cast<QPostEvent &>(pe).event = nullptr;
+            ++eventsMoved;
+        }
+    }
+    if (eventsMoved > 0 && targetData->hasEventDispatcher()) {
+        targetData->canWait = false;
+        targetData->eventDispatcher.loadRelaxed()->wakeUp();
+    }
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
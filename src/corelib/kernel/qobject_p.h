@@ -359,11 +359,18 @@ public:
     inline int signalId() const { return signalId_; }
 
 private:
+    friend class QPostEventList;
+
     int signalId_;
+    int incomingPriority_ = 0;
     const QObject *sender_;
 #if QT_CONFIG(thread)
     QSemaphore *semaphore_;
 #endif
+    // links the event into the incoming stack of the receiver's thread, see
+    // QCoreApplicationPrivate::postEventWithoutLocking()
+    QObject *incomingReceiver_ = nullptr;
+    QAbstractMetaCallEvent *nextIncoming_ = nullptr;
 };
 
 class Q_CORE_EXPORT QMetaCallEvent : public QAbstractMetaCallEvent
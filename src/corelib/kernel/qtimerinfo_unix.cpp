@@ -4,6 +4,7 @@
 
 #include <qelapsedtimer.h>
 #include <qcoreapplication.h>
+#include <qvarlengtharray.h>
 
 #include "private/qcore_unix_p.h"
 #include "private/qtimerinfo_unix_p.h"
@@ -37,7 +38,8 @@ steady_clock::time_point QTimerInfoList::updateCurrentTime() const
     Updates the currentTime member to the current time, and returns \c true if
     the first timer's timeout is in the future (after currentTime).
 
-    The list is sorted by timeout, thus it's enough to check the first timer only.
+    The heap keeps the earliest timeout at the top, thus it's enough to check
+    the first timer only.
 */
 bool QTimerInfoList::hasPendingTimers()
 {
@@ -46,16 +48,109 @@ bool QTimerInfoList::hasPendingTimers()
     return updateCurrentTime() < timers.at(0)->timeout;
 }
 
-static bool byTimeout(const QTimerInfo *a, const QTimerInfo *b)
-{ return a->timeout < b->timeout; };
+void QTimerInfoList::heapMove(QTimerInfo *t, qsizetype index)
+{
+    timers[index] = t;
+    t->heapIndex = index;
+}
+
+void QTimerInfoList::heapSiftUp(qsizetype index)
+{
+    QTimerInfo *t = timers.at(index);
+    while (index > 0) {
+        const qsizetype parent = (index - 1) / 2;
+        if (!firesBefore(t, timers.at(parent)))
+            break;
+        heapMove(timers.at(parent), index);
+        index = parent;
+    }
+    heapMove(t, index);
+}
+
+void QTimerInfoList::heapSiftDown(qsizetype index)
+{
+    QTimerInfo *t = timers.at(index);
+    const qsizetype count = timers.size();
+    for (;;) {
+        qsizetype child = 2 * index + 1;
+        if (child >= count)
+            break;
+        if (child + 1 < count && firesBefore(timers.at(child + 1), timers.at(child)))
+            ++child;
+        if (!firesBefore(timers.at(child), t))
+            break;
+        heapMove(timers.at(child), index);
+        index = child;
+    }
+    heapMove(t, index);
+}
+
+void QTimerInfoList::heapRemove(QTimerInfo *t)
+{
+    const qsizetype index = t->heapIndex;
+    Q_ASSERT(index >= 0 && timers.at(index) == t);
+    QTimerInfo *last = timers.takeLast();
+    t->heapIndex = -1;
+    if (last == t)
+        return;
+
+    heapMove(last, index);
+    if (index > 0 && firesBefore(last, timers.at((index - 1) / 2)))
+        heapSiftUp(index);
+    else
+        heapSiftDown(index);
+}
+
+/*
+  Removes \a t from all indexes and deletes it
+*/
+void QTimerInfoList::removeTimer(QTimerInfo *t)
+{
+    if (t == firstTimerInfo)
+        firstTimerInfo = nullptr;
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+    heapRemove(t);
+    timersById.remove(t->id);
+    timersByObject.remove(t->obj, t);
+    delete t;
+}
 
 /*
   insert timer info into list
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
-    timers.insert(std::upper_bound(timers.cbegin(), timers.cend(), ti, byTimeout),
-                  ti);
+    // timers with equal timeouts fire in the order they were inserted
+    ti->sequence = nextSequence++;
+    timers.append(ti);
+    heapSiftUp(timers.size() - 1);
+    timersById.insert(ti->id, ti);
+    timersByObject.insert(ti->obj, ti);
+}
+
+/*
+  Returns the number of timers that have expired at \a now, visiting only
+  those timers and their direct children in the heap.
+*/
+qsizetype QTimerInfoList::expiredCount(steady_clock::time_point now) const
+{
+    qsizetype count = 0;
+    QVarLengthArray<qsizetype, 64> pending;
+    if (!timers.isEmpty())
+        pending.append(0);
+    while (!pending.isEmpty()) {
+        const qsizetype index = pending.last();
+        pending.removeLast();
+        if (now < timers.at(index)->timeout)
+            continue;
+        ++count;
+        for (qsizetype child = 2 * index + 1; child <= 2 * index + 2; ++child) {
+            if (child < timers.size())
+                pending.append(child);
+        }
+    }
+    return count;
 }
 
 static constexpr milliseconds roundToMillisecond(nanoseconds val)
@@ -239,13 +334,31 @@ std::optional<QTimerInfoList::Duration> QTimerInfoList::timerWait()
 {
     steady_clock::time_point now = updateCurrentTime();
 
-    auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
-    // Find first waiting timer not already active
-    auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
-    if (it == timers.cend())
+    // Find first waiting timer not already active. A waiting timer fires no
+    // later than anything below it in the heap, so we only need to look below
+    // the (few) timers that are currently being activated.
+    const QTimerInfo *first = nullptr;
+    QVarLengthArray<qsizetype, 64> pending;
+    if (!timers.isEmpty())
+        pending.append(0);
+    while (!pending.isEmpty()) {
+        const qsizetype index = pending.last();
+        pending.removeLast();
+        const QTimerInfo *t = timers.at(index);
+        if (!t->activateRef) {
+            if (!first || firesBefore(t, first))
+                first = t;
+            continue;
+        }
+        for (qsizetype child = 2 * index + 1; child <= 2 * index + 2; ++child) {
+            if (child < timers.size())
+                pending.append(child);
+        }
+    }
+    if (!first)
         return std::nullopt;
 
-    Duration timeToWait = (*it)->timeout - now;
+    Duration timeToWait = first->timeout - now;
     if (timeToWait > 0ns)
         return roundToMillisecond(timeToWait);
     return 0ms;
@@ -260,15 +373,14 @@ QTimerInfoList::Duration QTimerInfoList::remainingDuration(Qt::TimerId timerId)
 {
     const steady_clock::time_point now = updateCurrentTime();
 
-    auto it = findTimerById(timerId);
-    if (it == timers.cend()) {
+    const QTimerInfo *t = findTimerById(timerId);
+    if (!t) {
 #ifndef QT_NO_DEBUG
         qWarning("QTimerInfoList::timerRemainingTime: timer id %i not found", int(timerId));
 #endif
         return Duration::min();
     }
 
-    const QTimerInfo *t = *it;
     if (now < t->timeout) // time to wait
         return t->timeout - now;
     return 0ms;
@@ -319,51 +431,33 @@ void QTimerInfoList::registerTimer(Qt::TimerId timerId, QTimerInfoList::Duration
 
 bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 {
-    auto it = findTimerById(timerId);
-    if (it == timers.cend())
+    QTimerInfo *t = findTimerById(timerId);
+    if (!t)
         return false; // id not found
 
     // set timer inactive
-    QTimerInfo *t = *it;
-    if (t == firstTimerInfo)
-        firstTimerInfo = nullptr;
-    if (t->activateRef)
-        *(t->activateRef) = nullptr;
-    delete t;
-    timers.erase(it);
+    removeTimer(t);
     return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
-    if (timers.isEmpty())
-        return false;
-
-    auto associatedWith = [this](QObject *o) {
-        return [this, o](auto &t) {
-            if (t->obj == o) {
-                if (t == firstTimerInfo)
-                    firstTimerInfo = nullptr;
-                if (t->activateRef)
-                    *(t->activateRef) = nullptr;
-                delete t;
-                return true;
-            }
-            return false;
-        };
-    };
-
-    qsizetype count = timers.removeIf(associatedWith(object));
-    return count > 0;
+    const QList<QTimerInfo *> associated = timersByObject.values(object);
+    for (QTimerInfo *t : associated)
+        removeTimer(t);
+    return !associated.isEmpty();
 }
 
 auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
 {
+    // report the timers in the order they are going to fire
+    QList<QTimerInfo *> associated = timersByObject.values(object);
+    std::sort(associated.begin(), associated.end(), firesBefore);
+
     QList<TimerInfo> list;
-    for (const auto &t : timers) {
-        if (t->obj == object)
-            list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
-    }
+    list.reserve(associated.size());
+    for (const QTimerInfo *t : std::as_const(associated))
+        list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
     return list;
 }
 
@@ -380,10 +474,7 @@ int QTimerInfoList::activateTimers()
     const steady_clock::time_point now = updateCurrentTime();
     // qDebug() << "Thread" << QThread::currentThreadId() << "woken up at" << now;
     // Find out how many timer have expired
-    auto stillActive = [&now](const QTimerInfo *t) { return now < t->timeout; };
-    // Find first one still active (list is sorted by timeout)
-    auto it = std::find_if(timers.cbegin(), timers.cend(), stillActive);
-    auto maxCount = it - timers.cbegin();
+    auto maxCount = expiredCount(now);
 
     int n_act = 0;
     //fire the timers.
@@ -405,15 +496,11 @@ int QTimerInfoList::activateTimers()
             firstTimerInfo = currentTimerInfo;
         }
 
-        // determine next timeout time
+        // determine next timeout time and move the timer down the heap
+        // accordingly, behind the timers with the same timeout
         calculateNextTimeout(currentTimerInfo, now);
-        if (timers.size() > 1) {
-            // Find where "currentTimerInfo" should be in the list so as
-            // to keep the list ordered by timeout
-            auto afterCurrentIt = timers.begin() + 1;
-            auto iter = std::upper_bound(afterCurrentIt, timers.end(), currentTimerInfo, byTimeout);
-            currentTimerInfo = *std::rotate(timers.begin(), afterCurrentIt, iter);
-        }
+        currentTimerInfo->sequence = nextSequence++;
+        heapSiftDown(0);
 
         if (currentTimerInfo->interval > 0ms)
             n_act++;
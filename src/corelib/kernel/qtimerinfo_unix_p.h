@@ -18,6 +18,7 @@
 #include <QtCore/private/qglobal_p.h>
 
 #include "qabstracteventdispatcher.h"
+#include "qhash.h"
 
 #include <sys/time.h> // struct timespec
 #include <chrono>
@@ -40,6 +41,8 @@ struct QTimerInfo
     Qt::TimerType timerType; // - timer type
     QObject *obj = nullptr; // - object to receive event
     QTimerInfo **activateRef = nullptr; // - ref from activateTimers
+    quint64 sequence = 0;   // - orders timers with equal timeouts by insertion
+    qsizetype heapIndex = -1;   // - position in QTimerInfoList::timers
 };
 
 class Q_CORE_EXPORT QTimerInfoList
@@ -69,24 +72,45 @@ public:
     {
         qDeleteAll(timers);
         timers.clear();
+        timersById.clear();
+        timersByObject.clear();
     }
 
     bool isEmpty() const { return timers.empty(); }
 
     qsizetype size() const { return timers.size(); }
 
-    auto findTimerById(Qt::TimerId timerId) const
+    QTimerInfo *findTimerById(Qt::TimerId timerId) const
     {
-        auto matchesId = [timerId](const auto &t) { return t->id == timerId; };
-        return std::find_if(timers.cbegin(), timers.cend(), matchesId);
+        return timersById.value(timerId);
     }
 
 private:
     std::chrono::steady_clock::time_point updateCurrentTime() const;
 
+    static bool firesBefore(const QTimerInfo *a, const QTimerInfo *b)
+    {
+        if (a->timeout != b->timeout)
+            return a->timeout < b->timeout;
+        return a->sequence < b->sequence;
+    }
+    void heapMove(QTimerInfo *t, qsizetype index);
+    void heapSiftUp(qsizetype index);
+    void heapSiftDown(qsizetype index);
+    void heapRemove(QTimerInfo *t);
+    void removeTimer(QTimerInfo *t);
+    qsizetype expiredCount(std::chrono::steady_clock::time_point now) const;
+
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo = nullptr;
+
+    // Binary min-heap ordered by firesBefore(), so that registering, stopping
+    // and rescheduling a timer cost O(log n); the hashes find a timer by id or
+    // by object without scanning the heap.
     QList<QTimerInfo *> timers;
+    QHash<Qt::TimerId, QTimerInfo *> timersById;
+    QMultiHash<const QObject *, QTimerInfo *> timersByObject;
+    quint64 nextSequence = 0;
 };
 
 QT_END_NAMESPACE
@@ -263,6 +263,20 @@ Q_DECL_UNUSED static constexpr quint64 MaximumPreallocatedElementCount =
     \sa toCbor()
  */
 
+/*!
+    \enum QCborValue::DecodingOption
+    \since 6.10
+
+    This enum is used in the options argument to fromCbor(), modifying the
+    behavior of the decoder.
+
+    \value UseArena        Allocates all arrays and maps of the decoded item,
+                           and their contents, from one memory arena. See
+                           fromCbor(QCborStreamReader &, DecodingOptions).
+
+    \sa fromCbor()
+ */
+
 /*!
     \enum QCborValue::DiagnosticNotationOption
 
@@ -918,6 +932,123 @@ QCborContainerPrivate::~QCborContainerPrivate()
         if (e.flags & Element::IsContainer)
             e.container->deref();
     }
+    if (arena)
+        arena->deref();
+}
+
+static constexpr size_t ContainerHeaderSize = sizeof(QCborArena *);
+static_assert(alignof(QCborContainerPrivate) <= ContainerHeaderSize);
+
+void *QCborContainerPrivate::operator new(size_t size)
+{
+    void *block = ::operator new(ContainerHeaderSize + size);
+    *static_cast<QCborArena **>(block) = nullptr;
+    return static_cast<char *>(block) + ContainerHeaderSize;
+}
+
+void *QCborContainerPrivate::operator new(size_t size, QCborArena *arena)
+{
+    void *block = arena->allocate(ContainerHeaderSize + size, alignof(QCborContainerPrivate));
+    *static_cast<QCborArena **>(block) = arena;
+    arena->ref();
+    return static_cast<char *>(block) + ContainerHeaderSize;
+}
+
+void QCborContainerPrivate::operator delete(void *ptr) noexcept
+{
+    void *block = static_cast<char *>(ptr) - ContainerHeaderSize;
+    if (QCborArena *arena = *static_cast<QCborArena **>(block))
+        arena->deref();     // the memory is released along with the arena
+    else
+        ::operator delete(block);
+}
+
+void QCborContainerPrivate::operator delete(void *ptr, QCborArena *) noexcept
+{
+    QCborContainerPrivate::operator delete(ptr);
+}
+
+QCborArena::~QCborArena()
+{
+    while (Chunk *chunk = chunks) {
+        chunks = chunk->next;
+        ::operator delete(chunk);
+    }
+}
+
+void *QCborArena::allocate(qsizetype size, qsizetype alignment)
+{
+    // chunks are aligned for any type
+    static constexpr qsizetype MaxChunkSize = 1024 * 1024;
+    Q_ASSERT(alignment > 0 && alignment <= qsizetype(alignof(Chunk)));
+
+    quintptr ptr = (quintptr(cursor) + alignment - 1) & ~quintptr(alignment - 1);
+    if (!cursor || ptr + size > quintptr(limit)) {
+        const qsizetype chunkSize = qMax(nextChunkSize, size);
+        auto chunk = static_cast<Chunk *>(::operator new(sizeof(Chunk) + chunkSize));
+        chunk->next = chunks;
+        chunks = chunk;
+        cursor = reinterpret_cast<char *>(chunk + 1);
+        limit = cursor + chunkSize;
+        ptr = quintptr(cursor);
+        nextChunkSize = qMin(nextChunkSize * 2, MaxChunkSize);
+    }
+    cursor = reinterpret_cast<char *>(ptr + size);
+    return reinterpret_cast<void *>(ptr);
+}
+
+/*
+    Creates a container in the arena. Until it is sealed, the container
+    collects its contents in buffers that are reused by the next container
+    at the same nesting level, so decoding does not allocate per container.
+*/
+QCborContainerPrivate *QCborArena::createContainer()
+{
+    auto d = new (this) QCborContainerPrivate;
+    ref();
+    d->arena = this;
+    if (depth == scratch.size())
+        scratch.emplace_back();
+    Scratch &s = scratch[depth++];
+    d->elements.swap(s.elements);
+    d->data.swap(s.data);
+    return d;
+}
+
+/*
+    Copies the contents of \a d into the arena and takes back the buffers
+    handed out by createContainer().
+*/
+void QCborArena::seal(QCborContainerPrivate *d)
+{
+    QList<Element> elements;
+    if (const qsizetype n = d->elements.size()) {
+        void *ptr = allocate(n * sizeof(Element), alignof(Element));
+        memcpy(ptr, d->elements.constData(), n * sizeof(Element));
+        elements = QArrayDataPointer<Element>::fromRawData(static_cast<const Element *>(ptr), n);
+    }
+    QByteArray data;
+    if (const qsizetype n = d->data.size()) {
+        void *ptr = allocate(n, alignof(QtCbor::ByteData));
+        memcpy(ptr, d->data.constData(), n);
+        data = QByteArray::fromRawData(static_cast<const char *>(ptr), n);
+    }
+    d->elements.swap(elements);
+    d->data.swap(data);
+
+    if (depth == 0)
+        return;
+    elements.clear();
+    data.truncate(0);
+    Scratch &s = scratch[--depth];
+    s.elements.swap(elements);
+    s.data.swap(data);
+}
+
+void QCborArena::finishDecoding()
+{
+    scratch = {};
+    depth = 0;
 }
 
 void QCborContainerPrivate::compact()
@@ -1715,7 +1846,8 @@ static qsizetype clampedContainerLength(const QCborStreamReader &reader)
     return len << mapShift;
 }
 
-static inline QCborContainerPrivate *createContainerFromCbor(QCborStreamReader &reader, int remainingRecursionDepth)
+static inline QCborContainerPrivate *createContainerFromCbor(QCborStreamReader &reader, int remainingRecursionDepth,
+                                                             QCborArena *arena)
 {
     if (Q_UNLIKELY(remainingRecursionDepth == 0)) {
         QCborContainerPrivate::setErrorInReader(reader, { QCborError::NestingTooDeep });
@@ -1725,11 +1857,15 @@ static inline QCborContainerPrivate *createContainerFromCbor(QCborStreamReader &
     QCborContainerPrivate *d = nullptr;
     {
         // in case QList::reserve throws
-        QExplicitlySharedDataPointer u(new QCborContainerPrivate);
+        QExplicitlySharedDataPointer u(arena ? arena->createContainer() : new QCborContainerPrivate);
         if (qsizetype len = clampedContainerLength(reader))
             u->elements.reserve(len);
         d = u.take();
     }
+    auto seal = qScopeGuard([d, arena] {
+        if (arena)
+            arena->seal(d);
+    });
 
     reader.enterContainer();
     if (reader.lastError() != QCborError::NoError) {
@@ -1748,14 +1884,20 @@ static inline QCborContainerPrivate *createContainerFromCbor(QCborStreamReader &
     return d;
 }
 
-static QCborValue taggedValueFromCbor(QCborStreamReader &reader, int remainingRecursionDepth)
+static QCborValue taggedValueFromCbor(QCborStreamReader &reader, int remainingRecursionDepth,
+                                      QCborArena *arena)
 {
     if (Q_UNLIKELY(remainingRecursionDepth == 0)) {
         QCborContainerPrivate::setErrorInReader(reader, { QCborError::NestingTooDeep });
         return QCborValue::Invalid;
     }
 
+    // tags are rare, so they're not worth putting in the arena, but their
+    // contents may be
     auto d = new QCborContainerPrivate;
+    d->arena = arena;
+    if (arena)
+        arena->ref();
     d->append(reader.toTag());
     reader.next();
 
@@ -1918,11 +2060,11 @@ void QCborContainerPrivate::decodeValueFromCbor(QCborStreamReader &reader, int r
     case QCborStreamReader::Array:
     case QCborStreamReader::Map:
         return append(makeValue(t == QCborStreamReader::Array ? QCborValue::Array : QCborValue::Map, -1,
-                                createContainerFromCbor(reader, remainingRecursionDepth),
+                                createContainerFromCbor(reader, remainingRecursionDepth, arena),
                                 MoveContainer));
 
     case QCborStreamReader::Tag:
-        return append(taggedValueFromCbor(reader, remainingRecursionDepth));
+        return append(taggedValueFromCbor(reader, remainingRecursionDepth, arena));
 
     case QCborStreamReader::Invalid:
         return;                 // probably a decode error
@@ -2617,6 +2759,42 @@ QCborValueRef QCborValue::operator[](qint64 key)
  */
 QCborValue QCborValue::fromCbor(QCborStreamReader &reader)
 {
+    return fromCbor(reader, DecodingOptions());
+}
+
+/*!
+    \since 6.10
+    \overload
+
+    Decodes one item from the CBOR stream found in \a reader, using the
+    options specified in \a options, and returns the equivalent
+    representation.
+
+    If \l{DecodingOption}{DecodingOption::UseArena} is specified, the arrays
+    and maps found in the item, along with their elements and strings, are
+    allocated from one memory arena shared by the returned value, instead of
+    each being a separate allocation. That makes decoding documents consisting
+    of many small arrays or maps considerably faster and their contents more
+    compact in memory. A container that is modified afterwards copies its
+    contents out of the arena. The arena's memory is only released once all of
+    the containers allocated from it have been destroyed, so a small part of a
+    large decoded document that is kept around keeps the whole of it in
+    memory.
+
+    \sa DecodingOption
+ */
+QCborValue QCborValue::fromCbor(QCborStreamReader &reader, DecodingOptions options)
+{
+    QCborArena *arena = nullptr;
+    if (options & DecodingOption::UseArena)
+        arena = new QCborArena;
+    auto releaseArena = qScopeGuard([arena] {
+        if (arena) {
+            arena->finishDecoding();
+            arena->deref();
+        }
+    });
+
     QCborValue result;
     auto t = reader.type();
     if (reader.lastError() != QCborError::NoError)
@@ -2655,12 +2833,12 @@ QCborValue QCborValue::fromCbor(QCborStreamReader &reader)
     case QCborStreamReader::Map:
         result.n = -1;
         result.t = reader.isArray() ? Array : Map;
-        result.container = createContainerFromCbor(reader, MaximumRecursionDepth);
+        result.container = createContainerFromCbor(reader, MaximumRecursionDepth, arena);
         break;
 
     // tag
     case QCborStreamReader::Tag:
-        result = taggedValueFromCbor(reader, MaximumRecursionDepth);
+        result = taggedValueFromCbor(reader, MaximumRecursionDepth, arena);
         break;
     }
 
@@ -2690,9 +2868,26 @@ QCborValue QCborValue::fromCbor(QCborStreamReader &reader)
     \sa toCbor(), toDiagnosticNotation(), toVariant(), toJsonValue()
  */
 QCborValue QCborValue::fromCbor(const QByteArray &ba, QCborParserError *error)
+{
+    return fromCbor(ba, DecodingOptions(), error);
+}
+
+/*!
+    \since 6.10
+    \overload
+
+    Decodes one item from the CBOR stream found in the byte array \a ba, using
+    the options specified in \a options, and returns the equivalent
+    representation. The error state, if any, is stored in the object pointed
+    to by \a error.
+
+    \sa fromCbor(QCborStreamReader &, DecodingOptions)
+ */
+QCborValue QCborValue::fromCbor(const QByteArray &ba, DecodingOptions options,
+                                QCborParserError *error)
 {
     QCborStreamReader reader(ba);
-    QCborValue result = fromCbor(reader);
+    QCborValue result = fromCbor(reader, options);
     if (error) {
         error->error = reader.lastError();
         error->offset = reader.currentOffset();
@@ -59,6 +59,11 @@ public:
     };
     Q_DECLARE_FLAGS(EncodingOptions, EncodingOption)
 
+    enum class DecodingOption {
+        UseArena = 0x01,
+    };
+    Q_DECLARE_FLAGS(DecodingOptions, DecodingOption)
+
     enum DiagnosticNotationOption {
         Compact         = 0x00,
         LineWrapped     = 0x01,
@@ -240,6 +245,9 @@ public:
 #if QT_CONFIG(cborstreamreader)
     static QCborValue fromCbor(QCborStreamReader &reader);
     static QCborValue fromCbor(const QByteArray &ba, QCborParserError *error = nullptr);
+    static QCborValue fromCbor(QCborStreamReader &reader, DecodingOptions options);
+    static QCborValue fromCbor(const QByteArray &ba, DecodingOptions options,
+                               QCborParserError *error = nullptr);
     static QCborValue fromCbor(const char *data, qsizetype len, QCborParserError *error = nullptr)
     { return fromCbor(QByteArray(data, int(len)), error); }
     static QCborValue fromCbor(const quint8 *data, qsizetype len, QCborParserError *error = nullptr)
@@ -603,6 +611,7 @@ private:
 };
 QT_WARNING_POP
 Q_DECLARE_OPERATORS_FOR_FLAGS(QCborValue::EncodingOptions)
+Q_DECLARE_OPERATORS_FOR_FLAGS(QCborValue::DecodingOptions)
 Q_DECLARE_OPERATORS_FOR_FLAGS(QCborValue::DiagnosticNotationOptions)
 
 Q_CORE_EXPORT size_t qHash(const QCborValue &value, size_t seed = 0);
@@ -25,6 +25,7 @@
 #include <private/qstringconverter_p.h>
 
 #include <math.h>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -95,6 +96,52 @@ static_assert(std::is_standard_layout<ByteData>::value);
 
 Q_DECLARE_TYPEINFO(QtCbor::Element, Q_PRIMITIVE_TYPE);
 
+// A monotonic allocator for decoding large documents. The containers created
+// while decoding, their elements and their string data are all allocated
+// from it, and it is only freed when the last container using it is gone.
+// Containers keep referring to the arena's memory until they are modified,
+// at which point QList and QByteArray detach from the raw data.
+class QCborArena
+{
+    Q_DISABLE_COPY_MOVE(QCborArena)
+public:
+    QCborArena() = default;
+    ~QCborArena();
+
+    void ref() noexcept { refCount.ref(); }
+    void deref() noexcept { if (!refCount.deref()) delete this; }
+
+    void *allocate(qsizetype size, qsizetype alignment);
+
+    // for use by the decoders; calls must be paired like the brackets
+    QCborContainerPrivate *createContainer();
+    void seal(QCborContainerPrivate *d);
+    void finishDecoding();
+
+private:
+    struct alignas(std::max_align_t) Chunk
+    {
+        Chunk *next;
+    };
+    struct Scratch
+    {
+        QList<QtCbor::Element> elements;
+        QByteArray data;
+    };
+
+    Chunk *chunks = nullptr;
+    char *cursor = nullptr;
+    char *limit = nullptr;
+    qsizetype nextChunkSize = 4096;
+
+    // buffers for the containers being decoded, one per nesting level, reused
+    // from one container to the next
+    std::vector<Scratch> scratch;
+    size_t depth = 0;
+
+    QAtomicInt refCount = 1;
+};
+
 class QCborContainerPrivate : public QSharedData
 {
     friend class QExplicitlySharedDataPointer<QCborContainerPrivate>;
@@ -102,16 +149,34 @@ class QCborContainerPrivate : public QSharedData
 
 public:
     QCborContainerPrivate() = default;
-    QCborContainerPrivate(const QCborContainerPrivate &) = default;
-    QCborContainerPrivate(QCborContainerPrivate &&) = default;
+    QCborContainerPrivate(const QCborContainerPrivate &other)
+        : QSharedData(other), usedData(other.usedData), data(other.data),
+          elements(other.elements), arena(other.arena)
+    {
+        if (arena)
+            arena->ref();
+    }
+    QCborContainerPrivate(QCborContainerPrivate &&other) noexcept
+        : QSharedData(other), usedData(other.usedData), data(std::move(other.data)),
+          elements(std::move(other.elements)), arena(std::exchange(other.arena, nullptr))
+    {}
     QCborContainerPrivate &operator=(const QCborContainerPrivate &) = delete;
     QCborContainerPrivate &operator=(QCborContainerPrivate &&) = delete;
 
+    // Containers created by QCborArena live in its memory. The allocating
+    // arena, if any, is stored in front of each object for the benefit of
+    // operator delete.
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, QCborArena *arena);
+    static void operator delete(void *ptr) noexcept;
+    static void operator delete(void *ptr, QCborArena *arena) noexcept;
+
     enum ContainerDisposition { CopyContainer, MoveContainer };
 
     QByteArray::size_type usedData = 0;
     QByteArray data;
     QList<QtCbor::Element> elements;
+    QCborArena *arena = nullptr;    // the data and elements may point into it
 
     void deref() { if (!ref.deref()) delete this; }
     void compact();
@@ -1128,6 +1128,54 @@ qint64 QDataStream::readRawData(char *s, qint64 len)
     return readBlock(s, len);
 }
 
+/*!
+    \fn template <typename T, std::size_t E> QDataStream &QDataStream::readRawSpan(QSpan<T, E> span)
+    \since 6.10
+
+    Reads \c{span.size()} elements of type \c T from the stream into \a span
+    and returns a reference to the stream. Unlike \c{operator>>()} for
+    containers, this function does not read a size prefix: the caller must
+    know how many elements to expect, and \a span must already have that size.
+    Use it together with writeRawSpan().
+
+    For the integral, character and floating-point types, as well as QPointF,
+    whose stream representation is their memory representation, the elements
+    are read with a single read from the device, followed by a vectorized byte
+    swap if the stream's byteOrder() differs from the host's. All other types,
+    including enumerations, are read one by one with \c{operator>>()}.
+
+    \sa writeRawSpan(), readRawData()
+*/
+
+// Reads \a len bytes into \a data, then byte-swaps each \a componentSize
+// unit of them if the stream's byte order differs from the host's.
+bool QDataStream::readPodData(char *data, qint64 len, int componentSize)
+{
+    CHECK_STREAM_PRECOND(false)
+    if (readBlock(data, len) != len) {
+        memset(data, 0, len);
+        return false;
+    }
+    if (noswap)
+        return true;
+
+    switch (componentSize) {
+    case 2:
+        qbswap<2>(data, len / 2, data);
+        break;
+    case 4:
+        qbswap<4>(data, len / 4, data);
+        break;
+    case 8:
+        qbswap<8>(data, len / 8, data);
+        break;
+    default:
+        Q_ASSERT(componentSize == 1);
+        break;
+    }
+    return true;
+}
+
 /*! \fn template <class T1, class T2> QDataStream &operator>>(QDataStream &in, std::pair<T1, T2> &pair)
     \since 6.0
     \relates QDataStream
@@ -1424,6 +1472,62 @@ qint64 QDataStream::writeRawData(const char *s, qint64 len)
     return ret;
 }
 
+/*!
+    \fn template <typename T, std::size_t E> QDataStream &QDataStream::writeRawSpan(QSpan<T, E> span)
+    \since 6.10
+
+    Writes the elements of \a span to the stream and returns a reference to
+    the stream. Unlike \c{operator<<()} for containers, this function does not
+    write a size prefix. Each element is encoded exactly as \c{operator<<()}
+    would encode it, so the data can be read back element by element or with
+    readRawSpan().
+
+    For the integral, character and floating-point types, as well as QPointF,
+    whose stream representation is their memory representation, the whole
+    span is written with a single write to the device, byte-swapped in blocks
+    if the stream's byteOrder() differs from the host's. All other types,
+    including enumerations, are written one by one with \c{operator<<()}.
+
+    \sa readRawSpan(), writeRawData()
+*/
+
+// Writes \a len bytes from \a data, byte-swapping each \a componentSize unit
+// of them if the stream's byte order differs from the host's.
+bool QDataStream::writePodData(const char *data, qint64 len, int componentSize)
+{
+    CHECK_STREAM_WRITE_PRECOND(false)
+    if (noswap || componentSize == 1) {
+        if (dev->write(data, len) == len)
+            return true;
+        q_status = WriteFailed;
+        return false;
+    }
+
+    alignas(quint64) char buffer[16 * 1024];
+    while (len) {
+        const qint64 chunk = qMin(len, qint64(sizeof(buffer)));
+        switch (componentSize) {
+        case 2:
+            qbswap<2>(data, chunk / 2, buffer);
+            break;
+        case 4:
+            qbswap<4>(data, chunk / 4, buffer);
+            break;
+        default:
+            Q_ASSERT(componentSize == 8);
+            qbswap<8>(data, chunk / 8, buffer);
+            break;
+        }
+        if (dev->write(buffer, chunk) != chunk) {
+            q_status = WriteFailed;
+            return false;
+        }
+        data += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
 /*!
     \since 4.1
 
@@ -25,6 +25,7 @@ class qfloat16;
 class QByteArray;
 class QDataStream;
 class QIODevice;
+class QPointF;
 class QString;
 
 #if !defined(QT_NO_DATASTREAM)
@@ -43,6 +44,38 @@ template <typename Container>
 QDataStream &writeAssociativeContainer(QDataStream &s, const Container &c);
 template <typename Container>
 QDataStream &writeAssociativeMultiContainer(QDataStream &s, const Container &c);
+
+// Types whose stream representation is their in-memory representation, as a
+// sequence of Component values in the stream's byte order. Component is void
+// for the types that must be streamed one element at a time. Enumerations are
+// among them: applications may stream an enumeration with their own operators,
+// in a format other than that of its underlying type.
+template <typename T, typename = void>
+struct DataStreamPodTraits
+{
+    using Component = std::conditional_t<
+            std::disjunction_v<std::is_same<T, char>, std::is_same<T, char16_t>,
+                               std::is_same<T, char32_t>, std::is_same<T, qint8>,
+                               std::is_same<T, quint8>, std::is_same<T, qint16>,
+                               std::is_same<T, quint16>, std::is_same<T, qint32>,
+                               std::is_same<T, quint32>, std::is_same<T, qint64>,
+                               std::is_same<T, quint64>, std::is_same<T, float>,
+                               std::is_same<T, double>>,
+            T, void>;
+};
+
+template <typename T>
+struct DataStreamPodTraits<const T> : DataStreamPodTraits<T> {};
+
+template <>
+struct DataStreamPodTraits<QPointF>
+{
+    // streamed as two doubles, whatever qreal is
+    using Component = std::conditional_t<std::is_same_v<qreal, double>, double, void>;
+};
+
+template <typename T>
+constexpr bool isDataStreamPod = !std::is_void_v<typename DataStreamPodTraits<T>::Component>;
 }
 class Q_CORE_EXPORT QDataStream : public QIODeviceBase
 {
@@ -209,6 +242,11 @@ public:
     qint64 writeRawData(const char *, qint64 len);
     qint64 skipRawData(qint64 len);
 
+    template <typename T, std::size_t E>
+    QDataStream &readRawSpan(QSpan<T, E> span);
+    template <typename T, std::size_t E>
+    QDataStream &writeRawSpan(QSpan<T, E> span);
+
     void startTransaction();
     bool commitTransaction();
     void rollbackTransaction();
@@ -239,6 +277,10 @@ private:
     qint64 readBlock(char *data, qint64 len);
     static inline qint64 readQSizeType(QDataStream &s);
     static inline bool writeQSizeType(QDataStream &s, qint64 value);
+    template <typename T>
+    bool canStreamAsPod() const;
+    bool readPodData(char *data, qint64 len, int componentSize);
+    bool writePodData(const char *data, qint64 len, int componentSize);
     static constexpr quint32 NullCode = 0xffffffffu;
     static constexpr quint32 ExtendedSize = 0xfffffffeu;
 
@@ -286,6 +328,20 @@ private:
     QDataStream::Status oldStatus;
 };
 
+template <typename Container, typename = void>
+constexpr bool isContiguousContainer = false;
+
+template <typename Container>
+constexpr bool isContiguousContainer<
+        Container, std::void_t<decltype(std::declval<const Container &>().data())>> = true;
+
+template <typename Container, typename = void>
+constexpr bool canResizeForOverwrite = false;
+
+template <typename Container>
+constexpr bool canResizeForOverwrite<
+        Container, std::void_t<decltype(std::declval<Container &>().resizeForOverwrite(0))>> = true;
+
 template <typename Container>
 QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
 {
@@ -298,6 +354,17 @@ QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
         s.setStatus(QDataStream::SizeLimitExceeded);
         return s;
     }
+    using T = typename Container::value_type;
+    if constexpr (isDataStreamPod<T> && canResizeForOverwrite<Container>) {
+        if (s.canStreamAsPod<T>()) {
+            c.resizeForOverwrite(n);
+            if (!s.readPodData(reinterpret_cast<char *>(c.data()), n * qint64(sizeof(T)),
+                               sizeof(typename DataStreamPodTraits<T>::Component))) {
+                c.clear();
+            }
+            return s;
+        }
+    }
     c.reserve(n);
     for (qsizetype i = 0; i < n; ++i) {
         typename Container::value_type t;
@@ -368,6 +435,17 @@ QDataStream &writeSequentialContainer(QDataStream &s, const Container &c)
 {
     if (!QDataStream::writeQSizeType(s, c.size()))
         return s;
+    if constexpr (isContiguousContainer<Container>) {
+        using T = typename Container::value_type;
+        if constexpr (isDataStreamPod<T>) {
+            if (s.canStreamAsPod<T>()) {
+                s.writePodData(reinterpret_cast<const char *>(c.data()),
+                               c.size() * qint64(sizeof(T)),
+                               sizeof(typename DataStreamPodTraits<T>::Component));
+                return s;
+            }
+        }
+    }
     for (const typename Container::value_type &t : c)
         s << t;
 
@@ -486,6 +564,49 @@ bool QDataStream::writeQSizeType(QDataStream &s, qint64 value)
     return true;
 }
 
+template <typename T>
+bool QDataStream::canStreamAsPod() const
+{
+    using Component = typename QtPrivate::DataStreamPodTraits<T>::Component;
+    static_assert(std::is_trivially_copyable_v<T> && sizeof(T) % sizeof(Component) == 0);
+    if constexpr (std::is_same_v<Component, float>)
+        return ver < Qt_4_6 || fpPrecision == SinglePrecision;
+    else if constexpr (std::is_same_v<Component, double>)
+        return ver < Qt_4_6 || fpPrecision == DoublePrecision;
+    return true;
+}
+
+template <typename T, std::size_t E>
+QDataStream &QDataStream::readRawSpan(QSpan<T, E> span)
+{
+    static_assert(!std::is_const_v<T>, "Cannot read into a span of const elements");
+    if constexpr (QtPrivate::isDataStreamPod<T>) {
+        if (canStreamAsPod<T>()) {
+            readPodData(reinterpret_cast<char *>(span.data()), span.size_bytes(),
+                        sizeof(typename QtPrivate::DataStreamPodTraits<T>::Component));
+            return *this;
+        }
+    }
+    for (T &t : span)
+        *this >> t;
+    return *this;
+}
+
+template <typename T, std::size_t E>
+QDataStream &QDataStream::writeRawSpan(QSpan<T, E> span)
+{
+    if constexpr (QtPrivate::isDataStreamPod<T>) {
+        if (canStreamAsPod<T>()) {
+            writePodData(reinterpret_cast<const char *>(span.data()), span.size_bytes(),
+                         sizeof(typename QtPrivate::DataStreamPodTraits<T>::Component));
+            return *this;
+        }
+    }
+    for (const T &t : span)
+        *this << t;
+    return *this;
+}
+
 inline QDataStream &QDataStream::operator>>(char &i)
 { return *this >> reinterpret_cast<qint8&>(i); }
 
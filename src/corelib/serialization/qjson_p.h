@@ -197,6 +197,7 @@ public:
         return container(r)->elements.at(indexHelper(r));
     }
 
+    static const QCborValue &toCbor(const QJsonValue &v) { return v.value; }
     static QJsonValue fromTrustedCbor(const QCborValue &v)
     {
         QJsonValue result;
@@ -15,6 +15,9 @@
 #include "qjsonparser_p.h"
 #include "qjson_p.h"
 #include "qdatastream.h"
+#if QT_CONFIG(jsonstreamwriter)
+#include "qjsonstreamwriter.h"
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -255,6 +258,32 @@ QByteArray QJsonDocument::toJson(JsonFormat format) const
 }
 #endif
 
+/*!
+    \since 6.10
+    \overload
+
+    Writes the QJsonDocument as UTF-8 encoded JSON in the provided \a format
+    to \a device, which must be open for writing. Returns \c true if all of
+    the output could be written.
+
+    The output is the same as that of toJson(JsonFormat), but it is handed to
+    the device in chunks of a bounded size while the document is being
+    serialized, so the whole text is never held in memory at once.
+
+    \sa QJsonStreamWriter
+ */
+#if (QT_CONFIG(jsonstreamwriter) && !defined(QT_JSON_READONLY)) || defined(Q_QDOC)
+bool QJsonDocument::toJson(QIODevice *device, JsonFormat format) const
+{
+    QJsonStreamWriter writer(device);
+    writer.setFormat(format == JsonFormat::Compact ? QJsonValue::JsonFormat::Compact
+                                                   : QJsonValue::JsonFormat::Indented);
+    if (d)
+        writer.append(QJsonPrivate::Value::fromTrustedCbor(d->value));
+    return writer.flush();
+}
+#endif
+
 /*!
  Parses \a json as a UTF-8 encoded JSON document, and creates a QJsonDocument
  from it.
@@ -267,7 +296,48 @@ QByteArray QJsonDocument::toJson(JsonFormat format) const
  */
 QJsonDocument QJsonDocument::fromJson(const QByteArray &json, QJsonParseError *error)
 {
-    QJsonPrivate::Parser parser(json.constData(), json.size());
+    return fromJson(json, ParseOptions(), error);
+}
+
+/*!
+    \enum QJsonDocument::ParseOption
+    \since 6.10
+
+    This enum is used in the options argument to fromJson(), modifying the
+    behavior of the parser.
+
+    \value UseArena        Allocates all arrays and objects of the document, and
+                           their contents, from one memory arena.
+
+    \sa fromJson(const QByteArray &, ParseOptions, QJsonParseError *)
+*/
+
+/*!
+    \since 6.10
+    \overload
+
+    Parses \a json as a UTF-8 encoded JSON document using the options
+    specified in \a options, and creates a QJsonDocument from it. The optional
+    \a error variable will contain further details about parse errors.
+
+    If \l{ParseOption}{ParseOption::UseArena} is specified, the arrays and
+    objects of the document, along with their elements and strings, are
+    allocated from one memory arena shared by the document, instead of each
+    being a separate allocation. That makes parsing documents consisting of
+    many small arrays or objects considerably faster and their contents more
+    compact in memory. An array or object that is modified afterwards copies
+    its contents out of the arena. The arena's memory is only released once
+    all of the arrays and objects allocated from it have been destroyed, so a
+    small part of a large document that is kept around keeps the whole of it
+    in memory.
+
+    \sa QCborValue::fromCbor(QCborStreamReader &, QCborValue::DecodingOptions)
+*/
+QJsonDocument QJsonDocument::fromJson(const QByteArray &json, ParseOptions options,
+                                      QJsonParseError *error)
+{
+    QJsonPrivate::Parser parser(json.constData(), json.size(),
+                                options.testFlag(ParseOption::UseArena));
     QJsonDocument result;
     const QCborValue val = parser.parse(error);
     if (val.isArray() || val.isMap()) {
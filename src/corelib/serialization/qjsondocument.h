@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 
 class QDebug;
 class QCborValue;
+class QIODevice;
 class QJsonArray;
 class QJsonObject;
 class QJsonValue;
@@ -72,11 +73,21 @@ public:
 #  endif
 #endif
 
+    enum class ParseOption {
+        UseArena = 0x01,
+    };
+    Q_DECLARE_FLAGS(ParseOptions, ParseOption)
+
     static QJsonDocument fromJson(const QByteArray &json, QJsonParseError *error = nullptr);
+    static QJsonDocument fromJson(const QByteArray &json, ParseOptions options,
+                                  QJsonParseError *error = nullptr);
 
 #if !defined(QT_JSON_READONLY) || defined(Q_QDOC)
     QByteArray toJson(JsonFormat format = JsonFormat::Indented) const;
 #endif
+#if (QT_CONFIG(jsonstreamwriter) && !defined(QT_JSON_READONLY)) || defined(Q_QDOC)
+    bool toJson(QIODevice *device, JsonFormat format = JsonFormat::Indented) const;
+#endif
 
     bool isEmpty() const;
     bool isArray() const;
@@ -112,6 +123,7 @@ private:
 };
 
 Q_DECLARE_SHARED(QJsonDocument)
+Q_DECLARE_OPERATORS_FOR_FLAGS(QJsonDocument::ParseOptions)
 
 #if !defined(QT_NO_DEBUG_STREAM) && !defined(QT_JSON_READONLY)
 Q_CORE_EXPORT QDebug operator<<(QDebug, const QJsonDocument &);
@@ -35,6 +35,7 @@ using namespace QtMiscUtils;
 #define JSONERR_DEEP_NEST   QT_TRANSLATE_NOOP("QJsonParseError", "too deeply nested document")
 #define JSONERR_DOC_LARGE   QT_TRANSLATE_NOOP("QJsonParseError", "too large document")
 #define JSONERR_GARBAGEEND  QT_TRANSLATE_NOOP("QJsonParseError", "garbage at the end of the document")
+#define JSONERR_PREMATURE   QT_TRANSLATE_NOOP("QJsonParseError", "premature end of document")
 
 /*!
     \class QJsonParseError
@@ -70,6 +71,10 @@ using namespace QtMiscUtils;
     \value DeepNesting              The JSON document is too deeply nested for the parser to parse it
     \value DocumentTooLarge         The JSON document is too large for the parser to parse it
     \value GarbageAtEnd             The parsed document contains additional garbage characters at the end
+    \value [since 6.10] PrematureEndOfDocument
+                                    The input ended before the document was complete. This is
+                                    only reported by QJsonStreamReader, which can continue once
+                                    more data is available.
 
 */
 
@@ -145,6 +150,9 @@ QString QJsonParseError::errorString() const
     case GarbageAtEnd:
         sz = JSONERR_GARBAGEEND;
         break;
+    case PrematureEndOfDocument:
+        sz = JSONERR_PREMATURE;
+        break;
     }
 #ifndef QT_BOOTSTRAPPED
     return QCoreApplication::translate("QJsonParseError", sz);
@@ -177,12 +185,25 @@ private:
     QExplicitlySharedDataPointer<QCborContainerPrivate> stashed;
 };
 
-Parser::Parser(const char *json, int length)
+Parser::Parser(const char *json, int length, bool useArena)
     : head(json), json(json)
     , nestingLevel(0)
     , lastError(QJsonParseError::NoError)
 {
     end = json + length;
+    if (useArena)
+        arena = new QCborArena;
+}
+
+Parser::~Parser()
+{
+    if (arena)
+        arena->deref();
+}
+
+QCborContainerPrivate *Parser::createContainer()
+{
+    return arena ? arena->createContainer() : new QCborContainerPrivate;
 }
 
 
@@ -240,16 +261,7 @@ void Parser::eatBOM()
 
 bool Parser::eatSpace()
 {
-    while (json < end) {
-        if (*json > Space)
-            break;
-        if (*json != Space &&
-            *json != Tab &&
-            *json != LineFeed &&
-            *json != Return)
-            break;
-        ++json;
-    }
+    json = skipWhitespace(json, end);
     return (json < end);
 }
 
@@ -314,12 +326,16 @@ QCborValue Parser::parse(QJsonParseError *error)
             error->offset = 0;
             error->error = QJsonParseError::NoError;
         }
+        if (arena)
+            arena->finishDecoding();
 
         return value;
     }
 
 error:
     container.reset();
+    if (arena)
+        arena->finishDecoding();
     if (error) {
         error->offset = json - head;
         error->error  = lastError;
@@ -454,7 +470,7 @@ bool Parser::parseObject()
     char token = nextToken();
     while (token == Quote) {
         if (!container)
-            container = new QCborContainerPrivate;
+            container = createContainer();
         if (!parseMember())
             return false;
         token = nextToken();
@@ -522,7 +538,7 @@ bool Parser::parseArray()
                 return false;
             }
             if (!container)
-                container = new QCborContainerPrivate;
+                container = createContainer();
 
             if (!parseValueIntoContainer())
                 return false;
@@ -600,15 +616,21 @@ QCborValue Parser::parseValue()
     }
     case BeginArray: {
         StashedContainer stashedContainer(&container, QCborValue::Array);
-        if (parseArray())
+        if (parseArray()) {
+            if (arena && container)
+                arena->seal(container.data());
             return stashedContainer.intoValue(&container);
+        }
 
         return QCborValue();
     }
     case BeginObject: {
         StashedContainer stashedContainer(&container, QCborValue::Map);
-        if (parseObject())
+        if (parseObject()) {
+            if (arena && container)
+                arena->seal(container.data());
             return stashedContainer.intoValue(&container);
+        }
 
         return QCborValue();
     }
@@ -650,35 +672,93 @@ QCborValue Parser::parseNumber()
     const char *start = json;
     bool isInt = true;
 
+    // For the fast paths below: the significant digits and the decimal
+    // exponent, as long as they fit into 19 digits.
+    quint64 mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool isSimple = true;
+    auto addDigit = [&](char c) {
+        if (digits == 19) {
+            isSimple = false;
+            return;
+        }
+        mantissa = mantissa * 10 + (c - '0');
+        if (mantissa)
+            ++digits;
+    };
+
     // minus
-    if (json < end && *json == '-')
+    const bool negative = json < end && *json == '-';
+    if (negative)
         ++json;
 
     // int = zero / ( digit1-9 *DIGIT )
     if (json < end && *json == '0') {
         ++json;
     } else {
+        const char *intStart = json;
         while (json < end && isAsciiDigit(*json))
-            ++json;
+            addDigit(*json++);
+        if (json == intStart)
+            isSimple = false;
     }
 
     // frac = decimal-point 1*DIGIT
     if (json < end && *json == '.') {
         ++json;
+        const char *fracStart = json;
         while (json < end && isAsciiDigit(*json)) {
             isInt = isInt && *json == '0';
-            ++json;
+            addDigit(*json++);
+            --exponent;
         }
+        if (json == fracStart)
+            isSimple = false;
     }
 
     // exp = e [ minus / plus ] 1*DIGIT
     if (json < end && (*json == 'e' || *json == 'E')) {
         isInt = false;
         ++json;
+        bool negativeExponent = false;
         if (json < end && (*json == '-' || *json == '+'))
+            negativeExponent = *json++ == '-';
+        const char *expStart = json;
+        int e = 0;
+        while (json < end && isAsciiDigit(*json)) {
+            if (e < 100000)
+                e = e * 10 + (*json - '0');
             ++json;
-        while (json < end && isAsciiDigit(*json))
-            ++json;
+        }
+        if (json == expStart)
+            isSimple = false;
+        exponent += negativeExponent ? -e : e;
+    }
+
+    if (isSimple && isInt && exponent == 0 && digits < 19) {
+        // cannot overflow
+        const qint64 n = qint64(mantissa);
+        return QCborValue(negative ? -n : n);
+    }
+
+    if (isSimple && mantissa <= (quint64(1) << 53) && exponent >= -22 && exponent <= 22) {
+        // Both the mantissa and the power of ten are exact doubles, so a
+        // single multiplication or division gives the correctly rounded
+        // result, as std::from_chars() would.
+        static constexpr double powersOf10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        double d = double(mantissa);
+        d = exponent < 0 ? d / powersOf10[-exponent] : d * powersOf10[exponent];
+        if (negative)
+            d = -d;
+
+        qint64 n;
+        if (convertDoubleTo(d, &n))
+            return QCborValue(n);
+        return QCborValue(d);
     }
 
     const QByteArray number = QByteArray::fromRawData(start, json - start);
@@ -727,102 +807,16 @@ QCborValue Parser::parseNumber()
 
         unescaped = %x20-21 / %x23-5B / %x5D-10FFFF
  */
-static inline bool addHexDigit(char digit, char32_t *result)
-{
-    *result <<= 4;
-    const int h = fromHex(digit);
-    if (h != -1) {
-        *result |= h;
-        return true;
-    }
-
-    return false;
-}
-
-static inline bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
-{
-    ++json;
-    if (json >= end)
-        return false;
-
-    uchar escaped = *json++;
-    switch (escaped) {
-    case '"':
-        *ch = '"'; break;
-    case '\\':
-        *ch = '\\'; break;
-    case '/':
-        *ch = '/'; break;
-    case 'b':
-        *ch = 0x8; break;
-    case 'f':
-        *ch = 0xc; break;
-    case 'n':
-        *ch = 0xa; break;
-    case 'r':
-        *ch = 0xd; break;
-    case 't':
-        *ch = 0x9; break;
-    case 'u': {
-        *ch = 0;
-        if (json > end - 4)
-            return false;
-        for (int i = 0; i < 4; ++i) {
-            if (!addHexDigit(*json, ch))
-                return false;
-            ++json;
-        }
-        return true;
-    }
-    default:
-        // this is not as strict as one could be, but allows for more Json files
-        // to be parsed correctly.
-        *ch = escaped;
-        return true;
-    }
-    return true;
-}
-
-static inline bool scanUtf8Char(const char *&json, const char *end, char32_t *result)
-{
-    const auto *usrc = reinterpret_cast<const uchar *>(json);
-    const auto *uend = reinterpret_cast<const uchar *>(end);
-    const uchar b = *usrc++;
-    qsizetype res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, result, usrc, uend);
-    if (res < 0)
-        return false;
-
-    json = reinterpret_cast<const char *>(usrc);
-    return true;
-}
-
 bool Parser::parseString()
 {
     const char *start = json;
 
     // try to parse a utf-8 string without escape sequences, and note whether it's 7bit ASCII.
 
-    bool isUtf8 = true;
     bool isAscii = true;
-    while (json < end) {
-        char32_t ch = 0;
-        if (*json == '"')
-            break;
-        if (*json == '\\') {
-            isAscii = false;
-            // If we find escape sequences, we store UTF-16 as there are some
-            // escape sequences which are hard to represent in UTF-8.
-            // (plain "\\ud800" for example)
-            isUtf8 = false;
-            break;
-        }
-        if (!scanUtf8Char(json, end, &ch)) {
-            lastError = QJsonParseError::IllegalUTF8String;
-            return false;
-        }
-        if (ch > 0x7f)
-            isAscii = false;
-    }
+    json = scanStringBody(json, end, &isAscii);
+    if (!isAscii && !validateUtf8(start))
+        return false;
     ++json;
     if (json > end) {
         lastError = QJsonParseError::UnterminatedString;
@@ -830,7 +824,7 @@ bool Parser::parseString()
     }
 
     // no escape sequences, we are done
-    if (isUtf8) {
+    if (json[-1] == '"') {
         if (isAscii)
             container->appendAsciiString(start, json - start - 1);
         else
@@ -838,25 +832,37 @@ bool Parser::parseString()
         return true;
     }
 
-    json = start;
-
+    // If we find escape sequences, we store UTF-16 as there are some
+    // escape sequences which are hard to represent in UTF-8.
+    // (plain "\\ud800" for example)
+    --json;
     QString ucs4;
+    ucs4.reserve(json - start);
+    ucs4.append(QUtf8StringView(start, json));
     while (json < end) {
-        char32_t ch = 0;
         if (*json == '"')
             break;
-        else if (*json == '\\') {
+        if (*json == '\\') {
+            char32_t ch = 0;
             if (!scanEscapeSequence(json, end, &ch)) {
                 lastError = QJsonParseError::IllegalEscapeSequence;
                 return false;
             }
+            ucs4.append(QChar::fromUcs4(ch));
+            continue;
+        }
+
+        // copy everything up to the next escape sequence at once
+        const char *run = json;
+        isAscii = true;
+        json = scanStringBody(json, end, &isAscii);
+        if (isAscii) {
+            ucs4.append(QLatin1StringView(run, json));
         } else {
-            if (!scanUtf8Char(json, end, &ch)) {
-                lastError = QJsonParseError::IllegalUTF8String;
+            if (!validateUtf8(run))
                 return false;
-            }
+            ucs4.append(QUtf8StringView(run, json));
         }
-        ucs4.append(QChar::fromUcs4(ch));
     }
     ++json;
 
@@ -870,4 +876,20 @@ bool Parser::parseString()
     return true;
 }
 
+// Validates the non-ASCII run of string characters in [start, json). On
+// failure, json is left on the offending character.
+bool Parser::validateUtf8(const char *start)
+{
+    if (QUtf8::isValidUtf8(QByteArrayView(start, json)).isValidUtf8)
+        return true;
+
+    const char *limit = json;
+    json = start;
+    char32_t ch;
+    while (json < limit && scanUtf8Char(json, end, &ch))
+        ;
+    lastError = QJsonParseError::IllegalUTF8String;
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -17,16 +17,203 @@
 
 #include <QtCore/private/qglobal_p.h>
 #include <QtCore/private/qcborvalue_p.h>
+#include <QtCore/private/qsimd_p.h>
+#include <QtCore/private/qstringconverter_p.h>
+#include <QtCore/private/qtools_p.h>
 #include <QtCore/qjsondocument.h>
 
 QT_BEGIN_NAMESPACE
 
 namespace QJsonPrivate {
 
+inline bool addHexDigit(char digit, char32_t *result)
+{
+    *result <<= 4;
+    const int h = QtMiscUtils::fromHex(digit);
+    if (h != -1) {
+        *result |= h;
+        return true;
+    }
+
+    return false;
+}
+
+inline bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
+{
+    ++json;
+    if (json >= end)
+        return false;
+
+    uchar escaped = *json++;
+    switch (escaped) {
+    case '"':
+        *ch = '"'; break;
+    case '\\':
+        *ch = '\\'; break;
+    case '/':
+        *ch = '/'; break;
+    case 'b':
+        *ch = 0x8; break;
+    case 'f':
+        *ch = 0xc; break;
+    case 'n':
+        *ch = 0xa; break;
+    case 'r':
+        *ch = 0xd; break;
+    case 't':
+        *ch = 0x9; break;
+    case 'u': {
+        *ch = 0;
+        if (json > end - 4)
+            return false;
+        for (int i = 0; i < 4; ++i) {
+            if (!addHexDigit(*json, ch))
+                return false;
+            ++json;
+        }
+        return true;
+    }
+    default:
+        // this is not as strict as one could be, but allows for more Json files
+        // to be parsed correctly.
+        *ch = escaped;
+        return true;
+    }
+    return true;
+}
+
+inline bool scanUtf8Char(const char *&json, const char *end, char32_t *result)
+{
+    const auto *usrc = reinterpret_cast<const uchar *>(json);
+    const auto *uend = reinterpret_cast<const uchar *>(end);
+    const uchar b = *usrc++;
+    qsizetype res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, result, usrc, uend);
+    if (res < 0)
+        return false;
+
+    json = reinterpret_cast<const char *>(usrc);
+    return true;
+}
+
+// Returns the first quote or backslash in [json, end), or end if there is
+// none. Sets *isAscii to false if any byte before it is not US-ASCII.
+inline const char *scanStringBody(const char *json, const char *end, bool *isAscii)
+{
+#if defined(__SSE2__)
+#  ifdef __AVX2__
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    for ( ; end - json >= 32; json += 32) {
+        __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(json));
+        __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(data, quote32),
+                                          _mm256_cmpeq_epi8(data, backslash32));
+        uint specialMask = _mm256_movemask_epi8(special);
+        uint nonAscii = _mm256_movemask_epi8(data);
+        if (specialMask) {
+            // only the bytes before the quote or backslash belong to this run
+            const uint n = qCountTrailingZeroBits(specialMask);
+            if (nonAscii & ((1U << n) - 1))
+                *isAscii = false;
+            return json + n;
+        }
+        if (nonAscii)
+            *isAscii = false;
+    }
+#  endif
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    for ( ; end - json >= 16; json += 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(data, quote),
+                                       _mm_cmpeq_epi8(data, backslash));
+        uint specialMask = _mm_movemask_epi8(special);
+        uint nonAscii = _mm_movemask_epi8(data);
+        if (specialMask) {
+            const uint n = qCountTrailingZeroBits(specialMask);
+            if (nonAscii & ((1U << n) - 1))
+                *isAscii = false;
+            return json + n;
+        }
+        if (nonAscii)
+            *isAscii = false;
+    }
+#elif defined(__ARM_NEON__)
+    // do eight characters at a time, see simdDecodeAscii() in qstringconverter.cpp
+    const uint8x8_t quote = vdup_n_u8('"');
+    const uint8x8_t backslash = vdup_n_u8('\\');
+    const uint8x8_t msbMask = vdup_n_u8(0x80);
+    const uint8x8_t addMask = qvset_n_u8(1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7);
+    for ( ; end - json >= 8; json += 8) {
+        uint8x8_t c = vld1_u8(reinterpret_cast<const uint8_t *>(json));
+        uint8x8_t special = vorr_u8(vceq_u8(c, quote), vceq_u8(c, backslash));
+        uint specialMask = vaddv_u8(vand_u8(special, addMask));
+        uint nonAscii = vaddv_u8(vand_u8(vcge_u8(c, msbMask), addMask));
+        if (specialMask) {
+            const uint n = qCountTrailingZeroBits(specialMask);
+            if (nonAscii & ((1U << n) - 1))
+                *isAscii = false;
+            return json + n;
+        }
+        if (nonAscii)
+            *isAscii = false;
+    }
+#endif
+
+    for ( ; json < end; ++json) {
+        if (*json == '"' || *json == '\\')
+            break;
+        if (uchar(*json) >= 0x80)
+            *isAscii = false;
+    }
+    return json;
+}
+
+// Returns the first byte in [json, end) that is not JSON whitespace, or end.
+inline const char *skipWhitespace(const char *json, const char *end)
+{
+    auto isSpace = [](char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    };
+    // most runs of whitespace are a single space or a newline
+    if (json < end && !isSpace(*json))
+        return json;
+
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i lineFeed = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    for ( ; end - json >= 16; json += 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, space),
+                                               _mm_cmpeq_epi8(data, tab)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(data, lineFeed),
+                                               _mm_cmpeq_epi8(data, carriageReturn)));
+        if (uint n = ~_mm_movemask_epi8(ws) & 0xffff)
+            return json + qCountTrailingZeroBits(n);
+    }
+#elif defined(__ARM_NEON__)
+    const uint8x8_t addMask = qvset_n_u8(1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7);
+    for ( ; end - json >= 8; json += 8) {
+        uint8x8_t c = vld1_u8(reinterpret_cast<const uint8_t *>(json));
+        uint8x8_t ws = vorr_u8(vorr_u8(vceq_u8(c, vdup_n_u8(' ')), vceq_u8(c, vdup_n_u8('\t'))),
+                               vorr_u8(vceq_u8(c, vdup_n_u8('\n')), vceq_u8(c, vdup_n_u8('\r'))));
+        if (uint n = uint8_t(~vaddv_u8(vand_u8(ws, addMask))))
+            return json + qCountTrailingZeroBits(n);
+    }
+#endif
+
+    while (json < end && isSpace(*json))
+        ++json;
+    return json;
+}
+
 class Parser
 {
 public:
-    Parser(const char *json, int length);
+    Parser(const char *json, int length, bool useArena = false);
+    ~Parser();
+    Q_DISABLE_COPY_MOVE(Parser)
 
     QCborValue parse(QJsonParseError *error);
 
@@ -39,9 +226,11 @@ private:
     bool parseArray();
     bool parseMember();
     bool parseString();
+    bool validateUtf8(const char *start);
     bool parseValueIntoContainer();
     QCborValue parseValue();
     QCborValue parseNumber();
+    QCborContainerPrivate *createContainer();
     const char *head;
     const char *json;
     const char *end;
@@ -49,6 +238,7 @@ private:
     int nestingLevel;
     QJsonParseError::ParseError lastError;
     QExplicitlySharedDataPointer<QCborContainerPrivate> container;
+    QCborArena *arena = nullptr;
 };
 
 }
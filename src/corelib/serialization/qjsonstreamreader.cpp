@@ -0,0 +1,951 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamreader.h"
+
+#include "qjsonparser_p.h"
+
+#include <qdebug.h>
+#include <qiodevice.h>
+#include <qvarlengtharray.h>
+
+#include <private/qnumeric_p.h>
+#include <private/qstringconverter_p.h>
+#include <private/qtools_p.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+using namespace QJsonPrivate;
+
+// same as QJsonDocument::fromJson()
+static constexpr int NestingLimit = 1024;
+static constexpr qsizetype ReadChunkSize = 64 * 1024;
+
+class QJsonStreamReaderPrivate
+{
+public:
+    // Where we are inside a container. The current item has been found once
+    // the state is BeforeItem or BeforeValue; everything up to it, including
+    // separators, has been consumed.
+    enum State : quint8 {
+        FirstItem,          // an item or the closing bracket follows
+        BeforeItem,         // the current item is the next element (or key, in objects)
+        AfterItem,          // a comma or the closing bracket follows
+        AfterKey,           // objects only: a colon follows
+        BeforeValue,        // objects only: the current item is the value of a member
+    };
+    struct Container
+    {
+        QJsonStreamReader::Type type;
+        State state;
+    };
+
+    QJsonStreamReaderPrivate(const QByteArray &data, bool complete)
+        : buffer(data), inputComplete(complete) {}
+    QJsonStreamReaderPrivate(QIODevice *device) : device(device) {}
+
+    void reset(QIODevice *dev, const QByteArray &data = {})
+    {
+        device = dev;
+        buffer = data;
+        bufferOffset = 0;
+        pos = 0;
+        containers.clear();
+        lastError = QJsonParseError::NoError;
+        errorOffset = -1;
+        skipDepth = -1;
+        atContainerEnd = false;
+        inputComplete = false;
+    }
+
+    bool fill();
+    void compact();
+    int skipSpace(qsizetype &p);
+
+    QJsonStreamReader::Type preparse();
+    QJsonStreamReader::Type scanValue(qsizetype p, int c);
+    QJsonStreamReader::Type scanString(qsizetype p);
+    QJsonStreamReader::Type scanNumber(qsizetype p);
+    QJsonStreamReader::Type scanLiteral(qsizetype p, QByteArrayView literal,
+                                        QJsonStreamReader::Type type);
+    void advance();
+
+    QJsonStreamReader::Type containerEnd(qsizetype p)
+    {
+        pos = p;
+        itemEnd = p + 1;
+        atContainerEnd = true;
+        return QJsonStreamReader::Invalid;
+    }
+    QJsonStreamReader::Type error(QJsonParseError::ParseError code, qsizetype p)
+    {
+        lastError = code;
+        errorOffset = bufferOffset + p;
+        return QJsonStreamReader::Invalid;
+    }
+    QJsonStreamReader::Type premature()
+    {
+        return error(QJsonParseError::PrematureEndOfDocument, buffer.size());
+    }
+    bool atEndOfInput() const
+    {
+        if (!device)
+            return inputComplete;
+        return !device->isSequential() && device->atEnd();
+    }
+
+    QIODevice *device = nullptr;
+
+    // Only the bytes from the current item onwards are kept, so the buffer
+    // does not grow beyond the largest single token plus one read chunk.
+    QByteArray buffer;
+    qint64 bufferOffset = 0;    // offset in the input of buffer[0]
+    qsizetype pos = 0;          // start of the current item
+    qsizetype itemEnd = 0;      // just past the current item (or the opening bracket)
+    qsizetype tokenBegin = 0;   // the raw value, without the quotes for strings
+    qsizetype tokenEnd = 0;
+
+    QVarLengthArray<Container, 16> containers;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+    qint64 errorOffset = -1;
+    int skipDepth = -1;         // >= 0 while next() or leaveContainer() wait for more data
+    bool atContainerEnd = false;
+    bool inputComplete = false; // no addData() will follow the data given on construction
+
+    bool hasEscapes = false;
+    bool boolValue = false;
+    bool isInteger = false;
+    qint64 integerValue = 0;
+    double doubleValue = 0;
+};
+
+bool QJsonStreamReaderPrivate::fill()
+{
+    if (!device)
+        return false;
+
+    const qsizetype oldSize = buffer.size();
+    buffer.resize(oldSize + ReadChunkSize);
+    const qint64 n = device->read(buffer.data() + oldSize, ReadChunkSize);
+    buffer.resize(oldSize + qMax(n, qint64(0)));
+    return n > 0;
+}
+
+void QJsonStreamReaderPrivate::compact()
+{
+    if (pos == 0)
+        return;
+
+    if (pos >= buffer.size())
+        buffer.truncate(0);
+    else
+        buffer.remove(0, pos);
+    bufferOffset += pos;
+    itemEnd -= pos;
+    tokenBegin -= pos;
+    tokenEnd -= pos;
+    pos = 0;
+}
+
+// Returns the first non-whitespace byte at or after p, reading more data if
+// needed, or -1 if there isn't one yet.
+int QJsonStreamReaderPrivate::skipSpace(qsizetype &p)
+{
+    for (;;) {
+        const char *data = buffer.constData();
+        const qsizetype size = buffer.size();
+        if (p < size) {
+            p = skipWhitespace(data + p, data + size) - data;
+            if (p < size)
+                return uchar(data[p]);
+        }
+        if (!fill())
+            return -1;
+    }
+}
+
+QJsonStreamReader::Type QJsonStreamReaderPrivate::preparse()
+{
+    if (lastError != QJsonParseError::NoError)
+        return QJsonStreamReader::Invalid;
+
+    atContainerEnd = false;
+    if (device)
+        compact();
+
+    qsizetype p = pos;
+    if (bufferOffset + p == 0) {
+        // skip the UTF-8 byte order mark, if any
+        const QByteArrayView bom = "\xef\xbb\xbf";
+        while (buffer.size() < bom.size() && bom.startsWith(buffer) && fill()) {
+        }
+        if (buffer.startsWith(bom))
+            p = bom.size();
+        else if (!buffer.isEmpty() && bom.startsWith(buffer))
+            return premature();
+    }
+
+    int c = skipSpace(p);
+    if (containers.isEmpty()) {
+        if (c < 0) {
+            // nothing left for now at the top level
+            pos = p;
+            return QJsonStreamReader::Invalid;
+        }
+        const QJsonStreamReader::Type type = scanValue(p, c);
+        if (type != QJsonStreamReader::Invalid)
+            pos = p;
+        return type;
+    }
+
+    Container &container = containers.last();
+    const bool isObject = container.type == QJsonStreamReader::Object;
+    const char closing = isObject ? '}' : ']';
+    switch (container.state) {
+    case FirstItem:
+        if (c == closing)
+            return containerEnd(p);
+        break;
+    case AfterItem:
+        if (c == closing)
+            return containerEnd(p);
+        if (c < 0)
+            return premature();
+        if (c != ',') {
+            return error(isObject ? QJsonParseError::UnterminatedObject
+                                  : QJsonParseError::MissingValueSeparator, p);
+        }
+        c = skipSpace(++p);
+        if (c == ']' || c == '}')
+            return error(QJsonParseError::MissingObject, p);
+        break;
+    case AfterKey:
+        if (c < 0)
+            return premature();
+        if (c != ':')
+            return error(QJsonParseError::MissingNameSeparator, p);
+        c = skipSpace(++p);
+        break;
+    case BeforeItem:
+    case BeforeValue:
+        break;
+    }
+
+    const bool isKey = isObject && container.state != AfterKey && container.state != BeforeValue;
+    if (isKey && c != '"')
+        return c < 0 ? premature() : error(QJsonParseError::UnterminatedObject, p);
+
+    const QJsonStreamReader::Type type = scanValue(p, c);
+    if (type != QJsonStreamReader::Invalid) {
+        pos = p;
+        container.state = isKey || !isObject ? BeforeItem : BeforeValue;
+    }
+    return type;
+}
+
+QJsonStreamReader::Type QJsonStreamReaderPrivate::scanValue(qsizetype p, int c)
+{
+    switch (c) {
+    case '[':
+        tokenBegin = tokenEnd = p;
+        itemEnd = p + 1;
+        return QJsonStreamReader::Array;
+    case '{':
+        tokenBegin = tokenEnd = p;
+        itemEnd = p + 1;
+        return QJsonStreamReader::Object;
+    case '"':
+        return scanString(p);
+    case 't':
+        return scanLiteral(p, "true", QJsonStreamReader::Bool);
+    case 'f':
+        return scanLiteral(p, "false", QJsonStreamReader::Bool);
+    case 'n':
+        return scanLiteral(p, "null", QJsonStreamReader::Null);
+    case ']':
+    case '}':
+        return error(QJsonParseError::MissingObject, p);
+    case -1:
+        return premature();
+    }
+
+    if (c == '-' || isAsciiDigit(c))
+        return scanNumber(p);
+    return error(QJsonParseError::IllegalValue, p);
+}
+
+QJsonStreamReader::Type QJsonStreamReaderPrivate::scanString(qsizetype p)
+{
+    const qsizetype begin = p + 1;
+    qsizetype q = begin;
+    bool isAscii = true;
+    hasEscapes = false;
+    for (;;) {
+        const char *data = buffer.constData();
+        const qsizetype size = buffer.size();
+        while (q < size) {
+            q = scanStringBody(data + q, data + size, &isAscii) - data;
+            if (q == size || data[q] == '"')
+                break;
+            // the escaped character may not have been read yet
+            hasEscapes = true;
+            q += 2;
+        }
+        if (q < size)
+            break;
+        if (!fill())
+            return premature();
+    }
+
+    tokenBegin = begin;
+    tokenEnd = q;
+    itemEnd = q + 1;
+
+    const char *data = buffer.constData();
+    if (!hasEscapes) {
+        if (!isAscii && !QUtf8::isValidUtf8(QByteArrayView(data + begin, q - begin)).isValidUtf8)
+            return error(QJsonParseError::IllegalUTF8String, begin);
+        return QJsonStreamReader::String;
+    }
+
+    const char *json = data + begin;
+    const char *end = data + q;
+    while (json < end) {
+        char32_t ch = 0;
+        if (*json == '\\') {
+            const char *escape = json;
+            if (!scanEscapeSequence(json, end, &ch))
+                return error(QJsonParseError::IllegalEscapeSequence, escape - data);
+        } else if (!scanUtf8Char(json, end, &ch)) {
+            return error(QJsonParseError::IllegalUTF8String, json - data);
+        }
+    }
+    return QJsonStreamReader::String;
+}
+
+static bool isNumberChar(char c)
+{
+    return isAsciiDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+QJsonStreamReader::Type QJsonStreamReaderPrivate::scanNumber(qsizetype p)
+{
+    // A number is only complete once something else follows it, since the
+    // next block of data could continue it.
+    qsizetype q = p;
+    for (;;) {
+        const char *data = buffer.constData();
+        const qsizetype size = buffer.size();
+        while (q < size && isNumberChar(data[q]))
+            ++q;
+        if (q < size)
+            break;
+        if (!fill()) {
+            if (atEndOfInput())
+                break;
+            return premature();
+        }
+    }
+
+    // see QJsonPrivate::Parser::parseNumber() for the grammar
+    const char *data = buffer.constData();
+    const char *json = data + p;
+    const char *end = data + q;
+    bool isInt = true;
+    if (json < end && *json == '-')
+        ++json;
+    if (json < end && *json == '0') {
+        ++json;
+    } else {
+        while (json < end && isAsciiDigit(*json))
+            ++json;
+    }
+    if (json < end && *json == '.') {
+        ++json;
+        while (json < end && isAsciiDigit(*json)) {
+            isInt = isInt && *json == '0';
+            ++json;
+        }
+    }
+    if (json < end && (*json == 'e' || *json == 'E')) {
+        isInt = false;
+        ++json;
+        if (json < end && (*json == '-' || *json == '+'))
+            ++json;
+        while (json < end && isAsciiDigit(*json))
+            ++json;
+    }
+
+    tokenBegin = p;
+    tokenEnd = itemEnd = json - data;
+    const QByteArrayView number(data + p, json - data - p);
+
+    bool ok = false;
+    if (isInt) {
+        integerValue = number.toLongLong(&ok);
+        if (ok) {
+            isInteger = true;
+            doubleValue = double(integerValue);
+            return QJsonStreamReader::Number;
+        }
+    }
+
+    doubleValue = number.toDouble(&ok);
+    if (!ok)
+        return error(QJsonParseError::IllegalNumber, p);
+    isInteger = convertDoubleTo(doubleValue, &integerValue);
+    return QJsonStreamReader::Number;
+}
+
+QJsonStreamReader::Type QJsonStreamReaderPrivate::scanLiteral(qsizetype p, QByteArrayView literal,
+                                                              QJsonStreamReader::Type type)
+{
+    while (buffer.size() - p < literal.size()) {
+        const QByteArrayView available = QByteArrayView(buffer).sliced(p);
+        if (!literal.startsWith(available))
+            return error(QJsonParseError::IllegalValue, p);
+        if (!fill())
+            return premature();
+    }
+    if (QByteArrayView(buffer).sliced(p, literal.size()) != literal)
+        return error(QJsonParseError::IllegalValue, p);
+
+    tokenBegin = p;
+    tokenEnd = itemEnd = p + literal.size();
+    boolValue = literal.front() == 't';
+    return type;
+}
+
+// Moves past the current item, which must be a scalar or a container that was
+// just left.
+void QJsonStreamReaderPrivate::advance()
+{
+    pos = itemEnd;
+    atContainerEnd = false;
+    if (containers.isEmpty())
+        return;
+
+    Container &container = containers.last();
+    if (container.type == QJsonStreamReader::Object && container.state == BeforeItem)
+        container.state = AfterKey;
+    else
+        container.state = AfterItem;
+}
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.10
+
+    \brief The QJsonStreamReader class is a pull-based JSON reader, operating
+    on either a QByteArray or a QIODevice.
+
+    QJsonStreamReader reads a JSON document one item at a time, without
+    building a QJsonDocument in memory. It only keeps the part of the input
+    that holds the current item, so documents much larger than the available
+    memory can be processed, and it can continue where it left off when the
+    input arrives in blocks. Its API follows that of QCborStreamReader.
+
+    The reader is always positioned on an item, whose type() is one of Null,
+    Bool, Number, String, Array or Object. Scalar values are available through
+    toBool(), toDouble(), toInteger() and toString(); next() moves on to the
+    following item. To read the contents of an array or object, call
+    enterContainer(), iterate while hasNext() returns true and then call
+    leaveContainer(). The members of an object are read as pairs of items: the
+    key, which is always a String, followed by the value.
+
+    \code
+        QJsonStreamReader reader(&file);
+        reader.enterContainer();                // the top-level array
+        while (reader.hasNext()) {
+            reader.enterContainer();            // one record
+            while (reader.hasNext()) {
+                if (reader.stringView() == "name"_L1) {
+                    reader.next();
+                    names << reader.toString();
+                    reader.next();
+                } else {
+                    reader.next();              // the key
+                    reader.next();              // skips the value
+                }
+            }
+            reader.leaveContainer();
+        }
+        reader.leaveContainer();
+    \endcode
+
+    Calling next() on an array or object skips it entirely. Skipping only
+    validates the input, it does not decode strings or allocate memory for the
+    skipped values. Likewise, stringView() and rawValue() give access to the
+    current value directly in the input, without conversion. The views remain
+    valid until the reader moves to another item.
+
+    \section1 Incremental Reading
+
+    When the input ends before the current item is complete, the reader
+    becomes invalid and lastError() reports
+    QJsonParseError::PrematureEndOfDocument. Once more data is available, call
+    addData() or, when reading from a QIODevice, reparse() and the reader
+    continues as if the data had been there all along. This includes a next()
+    or leaveContainer() call that was skipping values when the input ran out.
+
+    Data passed to the constructor is taken to be complete, and so is a file
+    that has reached its end. Once input has been extended with addData(),
+    or when reading from a sequential device, a following block of data
+    could continue a number, so a number at the top level of the input is
+    only reported when it is followed by whitespace.
+
+    At the top level, the input may consist of several JSON values, separated
+    by optional whitespace, as for example in the JSON Lines format. When
+    there are no more values, the reader becomes invalid without an error.
+
+    Other errors are reported as with QJsonDocument::fromJson() and are final:
+    the reader stays invalid until it is given a new source with setDevice()
+    or clear().
+
+    \sa QJsonDocument, QCborStreamReader, QXmlStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::Type
+
+    This enum describes the type of the item the reader is positioned on.
+
+    \value Null         The \c null literal.
+    \value Bool         The \c true or \c false literals.
+    \value Number       A number, see toDouble() and toInteger().
+    \value String       A string, see toString() and stringView().
+    \value Array        An array, see enterContainer().
+    \value Object       An object, see enterContainer().
+    \value Invalid      There is no current item, because of an error, because the
+                        reader is at the end of a container or because the input
+                        has been exhausted.
+*/
+
+/*!
+    Creates a QJsonStreamReader object with no source data. After
+    construction, QJsonStreamReader is invalid; call addData() to add data to
+    be read.
+
+    \sa addData(), isValid()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate(QByteArray(), false))
+{
+    preparse();
+}
+
+/*!
+    \overload
+
+    Creates a QJsonStreamReader object with \a len bytes of data starting at
+    \a data. The pointer must remain valid until QJsonStreamReader is
+    destroyed.
+*/
+QJsonStreamReader::QJsonStreamReader(const char *data, qsizetype len)
+    : QJsonStreamReader(QByteArray::fromRawData(data, len))
+{
+}
+
+/*!
+    \overload
+
+    Creates a QJsonStreamReader object that will read the JSON found in
+    \a data.
+
+    \a data is taken to be complete, so a number at its very end is read
+    as a whole. If more data is added with addData() later, the reader
+    treats its input as incremental from then on.
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d(new QJsonStreamReaderPrivate(data, true))
+{
+    preparse();
+}
+
+/*!
+    \overload
+
+    Creates a QJsonStreamReader object that will read the JSON found by
+    reading from \a device. QJsonStreamReader does not take ownership of
+    \a device, so it must remain valid until this object is destroyed.
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d(new QJsonStreamReaderPrivate(device))
+{
+    preparse();
+}
+
+/*!
+    Destroys this QJsonStreamReader object and frees any associated resources.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+}
+
+/*!
+    Sets the source of data to \a device, resetting the reader to its initial
+    state.
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    d->reset(device);
+    preparse();
+}
+
+/*!
+    Returns the QIODevice that was set with either setDevice() or the
+    QJsonStreamReader constructor. If this object was reading from a
+    QByteArray, this function returns nullptr instead.
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Adds \a data to the input and reparses the current item. This function is
+    useful if the end of the data was previously reached while reading, but
+    now more data is available.
+
+    Views returned by stringView() and rawValue() become invalid.
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    addData(data.constData(), data.size());
+}
+
+/*!
+    \overload
+
+    Adds \a len bytes of data starting at \a data to the input and reparses
+    the current item.
+*/
+void QJsonStreamReader::addData(const char *data, qsizetype len)
+{
+    if (!d->device) {
+        d->inputComplete = false;
+        d->compact();
+        if (len > 0)
+            d->buffer.append(data, len);
+        reparse();
+    } else {
+        qWarning("QJsonStreamReader: addData() with device()");
+    }
+}
+
+/*!
+    Reparses the current item. This function must be called when more data
+    becomes available in the source QIODevice after reading failed with
+    QJsonParseError::PrematureEndOfDocument. It also picks up new values at
+    the top level after the input had been exhausted.
+
+    When reading from a QByteArray, the addData() function automatically calls
+    this function.
+*/
+void QJsonStreamReader::reparse()
+{
+    if (d->lastError == QJsonParseError::PrematureEndOfDocument) {
+        d->lastError = QJsonParseError::NoError;
+        d->errorOffset = -1;
+    }
+    preparse();
+    if (d->skipDepth >= 0)
+        skipUntilDepth(d->skipDepth);
+}
+
+/*!
+    Clears the reader state and resets the input source data to an empty byte
+    array. After this function is called, QJsonStreamReader is invalid.
+
+    Call addData() to add more data to be read.
+
+    \sa setDevice()
+*/
+void QJsonStreamReader::clear()
+{
+    setDevice(nullptr);
+}
+
+/*!
+    Returns the last error encountered while reading, if any. The offset of
+    the error is relative to the start of the input.
+
+    \sa isValid()
+*/
+QJsonParseError QJsonStreamReader::lastError() const
+{
+    QJsonParseError error;
+    error.error = d->lastError;
+    error.offset = int(qMin(d->errorOffset, qint64(std::numeric_limits<int>::max())));
+    return error;
+}
+
+/*!
+    Returns the offset in the input of the item the reader is positioned on.
+    When reading from a QIODevice, the offset is relative to the position the
+    device had when reading started.
+*/
+qint64 QJsonStreamReader::currentOffset() const
+{
+    return d->bufferOffset + d->pos;
+}
+
+/*!
+    \fn bool QJsonStreamReader::isValid() const
+
+    Returns true if the reader is positioned on an item, false at the end of a
+    container, when the input is exhausted, or after an error.
+
+    \sa lastError(), hasNext()
+*/
+
+/*!
+    Returns the number of containers that this reader has entered with
+    enterContainer() but not yet left.
+
+    \sa enterContainer(), leaveContainer()
+*/
+int QJsonStreamReader::containerDepth() const
+{
+    return int(d->containers.size());
+}
+
+/*!
+    Returns either QJsonStreamReader::Array or QJsonStreamReader::Object,
+    indicating whether the container that contains the current item is an
+    array or an object. If the reader is at the top level, this function
+    returns QJsonStreamReader::Invalid.
+
+    \sa containerDepth(), enterContainer()
+*/
+QJsonStreamReader::Type QJsonStreamReader::parentContainerType() const
+{
+    if (d->containers.isEmpty())
+        return Invalid;
+    return d->containers.last().type;
+}
+
+/*!
+    Returns true if there is a current item, false if the reader has reached
+    the end of the current container, the end of the input, or an error.
+
+    \sa next(), leaveContainer()
+*/
+bool QJsonStreamReader::hasNext() const noexcept
+{
+    return type_ != Invalid;
+}
+
+/*!
+    Moves to the next item in the current container, skipping the current
+    one. If the current item is an array or object, it is skipped with all of
+    its contents, without decoding them. Returns true on success, false if an
+    error occurred or the input ended before the next item could be read.
+
+    \sa hasNext(), enterContainer()
+*/
+bool QJsonStreamReader::next()
+{
+    if (!isValid())
+        return false;
+
+    if (isContainer()) {
+        const int depth = containerDepth();
+        return enterContainer() && skipUntilDepth(depth);
+    }
+
+    d->advance();
+    preparse();
+    return d->lastError == QJsonParseError::NoError;
+}
+
+/*!
+    \fn bool QJsonStreamReader::isContainer() const
+
+    Returns true if the current item is an array or an object.
+
+    \sa enterContainer()
+*/
+
+/*!
+    Enters the array or object that is the current item and positions the
+    reader on its first element. Returns true on success, false if the
+    document is nested too deeply.
+
+    \sa leaveContainer(), containerDepth()
+*/
+bool QJsonStreamReader::enterContainer()
+{
+    Q_ASSERT(isContainer());
+    if (d->containers.size() >= NestingLimit) {
+        d->error(QJsonParseError::DeepNesting, d->pos);
+        type_ = Invalid;
+        return false;
+    }
+
+    d->containers.append({ type_, QJsonStreamReaderPrivate::FirstItem });
+    d->pos = d->itemEnd;
+    preparse();
+    return true;
+}
+
+/*!
+    Leaves the array or object that was entered last and positions the reader
+    on the item that follows it. Any remaining items in the container are
+    skipped, as with next(). Returns true on success, false if an error
+    occurred or the input ended before the end of the container.
+
+    \sa enterContainer(), hasNext()
+*/
+bool QJsonStreamReader::leaveContainer()
+{
+    Q_ASSERT(containerDepth() > 0);
+    return skipUntilDepth(containerDepth() - 1);
+}
+
+// Skips items and leaves containers until the given depth is reached. If the
+// input runs out, reparse() resumes from where we stopped.
+bool QJsonStreamReader::skipUntilDepth(int depth)
+{
+    d->skipDepth = depth;
+    while (d->lastError == QJsonParseError::NoError && containerDepth() > depth) {
+        if (d->atContainerEnd) {
+            d->containers.removeLast();
+            d->advance();
+            preparse();
+        } else if (isContainer()) {
+            enterContainer();
+        } else {
+            d->advance();
+            preparse();
+        }
+    }
+    if (d->lastError != QJsonParseError::NoError)
+        return false;
+    d->skipDepth = -1;
+    return true;
+}
+
+void QJsonStreamReader::preparse()
+{
+    type_ = d->preparse();
+}
+
+/*!
+    \fn QJsonStreamReader::Type QJsonStreamReader::type() const
+
+    Returns the type of the current item.
+
+    \sa isValid()
+*/
+
+/*!
+    Returns the value of the current item, which must be a Bool.
+*/
+bool QJsonStreamReader::toBool() const
+{
+    Q_ASSERT(isBool());
+    return d->boolValue;
+}
+
+/*!
+    Returns the value of the current item, which must be a Number.
+
+    \sa toInteger()
+*/
+double QJsonStreamReader::toDouble() const
+{
+    Q_ASSERT(isNumber());
+    return d->doubleValue;
+}
+
+/*!
+    Returns the value of the current item, which must be a Number, if it is
+    an integer that can be represented as a qint64. Otherwise, returns
+    \a defaultValue.
+
+    Unlike toDouble(), this function returns integers that cannot be
+    represented exactly as a double without loss of precision.
+
+    \sa toDouble()
+*/
+qint64 QJsonStreamReader::toInteger(qint64 defaultValue) const
+{
+    Q_ASSERT(isNumber());
+    return d->isInteger ? d->integerValue : defaultValue;
+}
+
+/*!
+    Returns the value of the current item, which must be a String, with all
+    escape sequences decoded.
+
+    \sa stringView()
+*/
+QString QJsonStreamReader::toString() const
+{
+    Q_ASSERT(isString());
+    const QByteArrayView raw = rawValue();
+    if (!d->hasEscapes)
+        return QString::fromUtf8(raw);
+
+    QString result;
+    result.reserve(raw.size());
+    const char *json = raw.begin();
+    const char *end = raw.end();
+    while (json < end) {
+        char32_t ch = 0;
+        if (*json == '\\')
+            scanEscapeSequence(json, end, &ch);
+        else
+            scanUtf8Char(json, end, &ch);
+        result.append(QChar::fromUcs4(ch));
+    }
+    return result;
+}
+
+/*!
+    Returns the value of the current item, which must be a String, as a view
+    into the input. If the string contains escape sequences, the view cannot
+    represent it and this function returns a null view; use toString()
+    instead.
+
+    The view remains valid until the reader moves to another item.
+
+    \sa toString(), rawValue()
+*/
+QUtf8StringView QJsonStreamReader::stringView() const
+{
+    Q_ASSERT(isString());
+    if (d->hasEscapes)
+        return {};
+    const QByteArrayView raw = rawValue();
+    return QUtf8StringView(raw.data(), raw.size());
+}
+
+/*!
+    Returns the bytes of the current item as they appear in the input: the
+    contents of a string without the quotes and with escape sequences left as
+    they are, the text of a number, or the \c true, \c false and \c null
+    literals. For arrays and objects, this function returns an empty view.
+
+    The view remains valid until the reader moves to another item.
+
+    \sa stringView()
+*/
+QByteArrayView QJsonStreamReader::rawValue() const
+{
+    if (!isValid())
+        return {};
+    return QByteArrayView(d->buffer.constData() + d->tokenBegin, d->tokenEnd - d->tokenBegin);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qjsonstreamreader.cpp"
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONSTREAMREADER_H
+#define QJSONSTREAMREADER_H
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qjsonparseerror.h>
+#include <QtCore/qobjectdefs.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <memory>
+
+QT_REQUIRE_CONFIG(jsonstreamreader);
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+class QJsonStreamReaderPrivate;
+class Q_CORE_EXPORT QJsonStreamReader
+{
+    Q_GADGET
+public:
+    enum Type : quint8 {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object,
+
+        Invalid = 0xff
+    };
+    Q_ENUM(Type)
+
+    QJsonStreamReader();
+    QJsonStreamReader(const char *data, qsizetype len);
+    explicit QJsonStreamReader(const QByteArray &data);
+    explicit QJsonStreamReader(QIODevice *device);
+    ~QJsonStreamReader();
+    Q_DISABLE_COPY(QJsonStreamReader)
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+    void addData(const QByteArray &data);
+    void addData(const char *data, qsizetype len);
+    void reparse();
+    void clear();
+
+    QJsonParseError lastError() const;
+    qint64 currentOffset() const;
+
+    bool isValid() const            { return !isInvalid(); }
+
+    int containerDepth() const;
+    QJsonStreamReader::Type parentContainerType() const;
+    bool hasNext() const noexcept Q_DECL_PURE_FUNCTION;
+    bool next();
+
+    Type type() const               { return type_; }
+    bool isNull() const             { return type() == Null; }
+    bool isBool() const             { return type() == Bool; }
+    bool isNumber() const           { return type() == Number; }
+    bool isString() const           { return type() == String; }
+    bool isArray() const            { return type() == Array; }
+    bool isObject() const           { return type() == Object; }
+    bool isInvalid() const          { return type() == Invalid; }
+
+    bool isContainer() const        { return isArray() || isObject(); }
+    bool enterContainer();
+    bool leaveContainer();
+
+    bool toBool() const;
+    double toDouble() const;
+    qint64 toInteger(qint64 defaultValue = 0) const;
+    QString toString() const;
+    QUtf8StringView stringView() const;
+    QByteArrayView rawValue() const;
+
+private:
+    void preparse();
+    void consumeItem();
+    bool skipUntilDepth(int depth);
+
+    friend QJsonStreamReaderPrivate;
+    std::unique_ptr<QJsonStreamReaderPrivate> d;
+    Type type_;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMREADER_H
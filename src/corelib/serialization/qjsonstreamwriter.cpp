@@ -0,0 +1,637 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamwriter.h"
+
+#include "qjson_p.h"
+#include "qjsonwriter_p.h"
+
+#include <qdebug.h>
+#include <qiodevice.h>
+#include <qlocale.h>
+#include <qvarlengtharray.h>
+
+#include <private/qnumeric_p.h>
+
+#include <charconv>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QJsonPrivate;
+
+// output is handed to the device whenever this much has accumulated
+static constexpr qsizetype BufferSize = 16 * 1024;
+
+class QJsonStreamWriterPrivate
+{
+public:
+    enum State : quint8 {
+        Empty,              // nothing was written to the container yet
+        AfterItem,          // a comma must precede the next item
+        AfterKey,           // objects only: the value of a member follows
+    };
+    struct Container
+    {
+        bool isObject;
+        bool valid;         // false if a key was not a string
+        State state;
+    };
+    enum ItemKind : quint8 {
+        Value,
+        Key,
+    };
+
+    QJsonStreamWriterPrivate(QIODevice *device) : device(device) {}
+    QJsonStreamWriterPrivate(QByteArray *data) : data(data) {}
+
+    QByteArray &out() { return data ? *data : buffer; }
+    void indent(qsizetype depth)
+    {
+        if (!compact)
+            out().append(4 * depth, ' ');
+    }
+
+    ItemKind beginItem(bool isString);
+    void endItem(ItemKind kind);
+    bool flush();
+
+    void writeInteger(qint64 i);
+    void writeDouble(double d);
+    void writeLiteral(QByteArrayView literal);
+    template <typename String> void writeString(String str);
+
+    void startContainer(bool isObject);
+    bool closeContainer(bool isObject);
+    void writeContainer(const QCborContainerPrivate *c, bool isObject);
+    void writeElement(const QCborContainerPrivate *c, qsizetype idx);
+
+    QIODevice *device = nullptr;
+    QByteArray *data = nullptr;     // written to directly, without buffering
+    QByteArray buffer;
+    QVarLengthArray<Container, 16> containers;
+    bool compact = true;
+    bool needSeparator = false;     // a top-level value without a trailing newline was written
+    bool ioError = false;
+};
+
+// Writes what needs to precede the next item and returns whether the item is
+// the key of an object member.
+QJsonStreamWriterPrivate::ItemKind QJsonStreamWriterPrivate::beginItem(bool isString)
+{
+    QByteArray &json = out();
+    if (containers.isEmpty()) {
+        if (needSeparator)
+            json += '\n';
+        needSeparator = false;
+        return Value;
+    }
+
+    Container &container = containers.last();
+    if (container.state == AfterKey) {
+        container.state = AfterItem;
+        return Value;
+    }
+    if (container.state == AfterItem)
+        json += compact ? "," : ",\n";
+    indent(containers.size());
+    container.state = AfterItem;
+    if (!container.isObject)
+        return Value;
+
+    if (!isString) {
+        qWarning("QJsonStreamWriter: object keys must be strings");
+        container.valid = false;
+    }
+    return Key;
+}
+
+void QJsonStreamWriterPrivate::endItem(ItemKind kind)
+{
+    if (kind == Key) {
+        out() += compact ? ":" : ": ";
+        containers.last().state = AfterKey;
+    } else if (containers.isEmpty()) {
+        needSeparator = true;
+    }
+
+    if (!data && buffer.size() >= BufferSize)
+        flush();
+}
+
+bool QJsonStreamWriterPrivate::flush()
+{
+    if (data || buffer.isEmpty())
+        return !ioError;
+
+    if (device && !ioError)
+        ioError = device->write(buffer) != buffer.size();
+    buffer.truncate(0);     // keeps the capacity for the next chunk
+    return !ioError;
+}
+
+void QJsonStreamWriterPrivate::writeInteger(qint64 i)
+{
+    const ItemKind kind = beginItem(false);
+    char buf[std::numeric_limits<qint64>::digits10 + 2];
+    const auto r = std::to_chars(buf, buf + sizeof(buf), i);
+    out().append(buf, r.ptr - buf);
+    endItem(kind);
+}
+
+void QJsonStreamWriterPrivate::writeDouble(double d)
+{
+    // same formatting as QJsonDocument::toJson()
+    const ItemKind kind = beginItem(false);
+    if (qt_is_finite(d))
+        out() += QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+    else
+        out() += "null"; // +INF || -INF || NaN (see RFC4627#section2.4)
+    endItem(kind);
+}
+
+void QJsonStreamWriterPrivate::writeLiteral(QByteArrayView literal)
+{
+    const ItemKind kind = beginItem(false);
+    out() += literal;
+    endItem(kind);
+}
+
+// Returns how many of the first \a n code units of \a str can be escaped on
+// their own, without splitting a surrogate pair or a UTF-8 sequence.
+static qsizetype pieceSize(QStringView str, qsizetype n)
+{
+    return str[n - 1].isHighSurrogate() ? n - 1 : n;
+}
+
+static qsizetype pieceSize(QLatin1StringView, qsizetype n)
+{
+    return n;
+}
+
+static qsizetype pieceSize(QUtf8StringView str, qsizetype n)
+{
+    qsizetype end = n;
+    while (end > 0 && (uchar(str.data()[end]) & 0xc0) == 0x80)
+        --end;
+    return end ? end : n;
+}
+
+template <typename String> void QJsonStreamWriterPrivate::writeString(String str)
+{
+    const ItemKind kind = beginItem(true);
+    out() += '"';
+    // escape long strings in pieces, so that the buffer stays bounded
+    while (!data && str.size() > BufferSize) {
+        const qsizetype n = pieceSize(str, BufferSize);
+        Writer::appendEscaped(buffer, str.first(n));
+        str = str.sliced(n);
+        flush();
+    }
+    QByteArray &json = out();
+    Writer::appendEscaped(json, str);
+    json += '"';
+    endItem(kind);
+}
+
+void QJsonStreamWriterPrivate::startContainer(bool isObject)
+{
+    beginItem(false);
+    out() += compact ? (isObject ? "{" : "[") : (isObject ? "{\n" : "[\n");
+    containers.append({ isObject, true, Empty });
+}
+
+bool QJsonStreamWriterPrivate::closeContainer(bool isObject)
+{
+    if (containers.isEmpty()) {
+        qWarning("QJsonStreamWriter: closing object or array that wasn't open");
+        return false;
+    }
+
+    const Container container = containers.last();
+    containers.removeLast();
+    bool ok = container.valid;
+    if (container.isObject != isObject) {
+        qWarning(isObject ? "QJsonStreamWriter: endObject() called to close an array"
+                          : "QJsonStreamWriter: endArray() called to close an object");
+        ok = false;
+    }
+    if (container.state == AfterKey) {
+        qWarning("QJsonStreamWriter: object member without a value");
+        ok = false;
+    }
+
+    QByteArray &json = out();
+    if (!compact && container.state != Empty)
+        json += '\n';
+    indent(containers.size());
+    json += container.isObject ? '}' : ']';
+
+    if (containers.isEmpty()) {
+        // QJsonDocument::toJson() terminates indented documents with a newline
+        if (!compact)
+            json += '\n';
+        else
+            needSeparator = true;
+    }
+    if (!data && buffer.size() >= BufferSize)
+        flush();
+    return ok;
+}
+
+void QJsonStreamWriterPrivate::writeContainer(const QCborContainerPrivate *c, bool isObject)
+{
+    startContainer(isObject);
+    if (c) {
+        for (qsizetype i = 0; i < c->elements.size(); ++i)
+            writeElement(c, i);
+    }
+    closeContainer(isObject);
+}
+
+void QJsonStreamWriterPrivate::writeElement(const QCborContainerPrivate *c, qsizetype idx)
+{
+    // Walk the elements directly, so that strings need not be converted to
+    // QString first.
+    const QtCbor::Element &e = c->elements.at(idx);
+    switch (e.type) {
+    case QCborValue::Integer:
+        writeInteger(e.value);
+        break;
+    case QCborValue::Double:
+        writeDouble(e.fpvalue());
+        break;
+    case QCborValue::String:
+        if (const QtCbor::ByteData *b = c->byteData(e); !b)
+            writeString(QLatin1StringView(""));
+        else if (e.flags & QtCbor::Element::StringIsUtf16)
+            writeString(b->asStringView());
+        else if (e.flags & QtCbor::Element::StringIsAscii)
+            writeString(b->asLatin1());
+        else
+            writeString(b->asUtf8StringView());
+        break;
+    case QCborValue::Array:
+    case QCborValue::Map:
+        writeContainer(e.flags & QtCbor::Element::IsContainer ? e.container : nullptr,
+                       e.type == QCborValue::Map);
+        break;
+    case QCborValue::True:
+        writeLiteral("true");
+        break;
+    case QCborValue::False:
+        writeLiteral("false");
+        break;
+    case QCborValue::Null:
+    default:
+        writeLiteral("null");
+        break;
+    }
+}
+
+/*!
+    \class QJsonStreamWriter
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.10
+
+    \brief The QJsonStreamWriter class writes JSON text incrementally to a
+    QIODevice or a QByteArray.
+
+    QJsonDocument::toJson() builds the entire document in memory before
+    anything can be written out. QJsonStreamWriter instead produces the
+    JSON text as the values are appended, and hands it to the device in
+    chunks of a bounded size. It is useful for large documents and for
+    protocols, such as HTTP, where the first bytes should go out as soon as
+    possible.
+
+    The API follows that of QCborStreamWriter: scalar values are written
+    with one of the append() overloads, and arrays and objects are started
+    with startArray() and startObject() and terminated with the matching
+    endArray() and endObject(). Inside an object, the items alternate
+    between the key, which must be a string, and the value of each member.
+    Complete QJsonValue, QJsonArray and QJsonObject values can be written in
+    one go with append(const QJsonValue &).
+
+    The following example writes \c{{"name": "Qt", "versions": [5, 6]}}:
+
+    \code
+    QJsonStreamWriter writer(&file);
+    writer.startObject();
+    writer.append("name"_L1);
+    writer.append("Qt"_L1);
+    writer.append("versions"_L1);
+    writer.startArray();
+    writer.append(5);
+    writer.append(6);
+    writer.endArray();
+    writer.endObject();
+    \endcode
+
+    Output is collected in an internal buffer of a few kilobytes and written
+    to the device whenever the buffer fills up, when flush() is called, and
+    when the writer is destroyed. Strings longer than the buffer are
+    escaped and written out in pieces. When writing to a QByteArray, the
+    output is appended to it directly.
+
+    Several top-level values may be written in a row; they are then
+    separated by newlines, as in the JSON Lines format.
+
+    \sa QJsonStreamReader, QJsonDocument::toJson(), QCborStreamWriter
+*/
+
+/*!
+    Creates a QJsonStreamWriter object that will write to \a device. The
+    device must be open for writing before the output is flushed to it.
+
+    QJsonStreamWriter does not take ownership of \a device.
+
+    \sa device(), setDevice()
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : d(new QJsonStreamWriterPrivate(device))
+{
+}
+
+/*!
+    Creates a QJsonStreamWriter object that will append to \a data. The
+    text is appended as it is written, without the need for flushing.
+
+    QJsonStreamWriter does not take ownership of \a data.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *data)
+    : d(new QJsonStreamWriterPrivate(data))
+{
+}
+
+/*!
+    Flushes any pending output to the device and destroys this
+    QJsonStreamWriter object.
+
+    QJsonStreamWriter does not check whether all arrays and objects were
+    terminated before the object is destroyed. It is the programmer's
+    responsibility to ensure that they were.
+
+    \sa flush()
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    d->flush();
+}
+
+/*!
+    Flushes any pending output and replaces the device or byte array that
+    this QJsonStreamWriter object is writing to with \a device.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    d->flush();
+    d->device = device;
+    d->data = nullptr;
+    d->ioError = false;
+}
+
+/*!
+    Returns the QIODevice that this QJsonStreamWriter object is writing to,
+    or \nullptr if it is writing to a QByteArray.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    return d->device;
+}
+
+/*!
+    Sets the format of the output to \a format. The default is
+    QJsonValue::JsonFormat::Compact.
+
+    With QJsonValue::JsonFormat::Indented, the output is the same as that of
+    QJsonDocument::toJson() for the same document. The format should not be
+    changed while an array or object is being written.
+
+    \sa format()
+*/
+void QJsonStreamWriter::setFormat(QJsonValue::JsonFormat format)
+{
+    d->compact = format == QJsonValue::JsonFormat::Compact;
+}
+
+/*!
+    Returns the format of the output.
+
+    \sa setFormat()
+*/
+QJsonValue::JsonFormat QJsonStreamWriter::format() const
+{
+    return d->compact ? QJsonValue::JsonFormat::Compact : QJsonValue::JsonFormat::Indented;
+}
+
+/*!
+    Appends the integer \a i to the stream.
+*/
+void QJsonStreamWriter::append(qint64 i)
+{
+    d->writeInteger(i);
+}
+
+/*!
+    \overload
+
+    Appends the floating point number \a d to the stream. Since JSON cannot
+    represent infinities and NaN, those are written as \c null, as
+    QJsonDocument::toJson() does.
+*/
+void QJsonStreamWriter::append(double d)
+{
+    this->d->writeDouble(d);
+}
+
+/*!
+    \overload
+
+    Appends the boolean value \a b to the stream.
+*/
+void QJsonStreamWriter::append(bool b)
+{
+    d->writeLiteral(b ? "true" : "false");
+}
+
+/*!
+    \overload
+
+    Appends the Latin-1 string \a str to the stream, escaping the characters
+    JSON requires to be escaped.
+*/
+void QJsonStreamWriter::append(QLatin1StringView str)
+{
+    d->writeString(str);
+}
+
+/*!
+    \overload
+
+    Appends the UTF-16 string \a str to the stream, escaping the characters
+    JSON requires to be escaped. Unpaired surrogates are written as \c{\u}
+    escape sequences.
+*/
+void QJsonStreamWriter::append(QStringView str)
+{
+    d->writeString(str);
+}
+
+/*!
+    \overload
+
+    Appends the UTF-8 string \a str to the stream, escaping the characters
+    JSON requires to be escaped. The string must be valid UTF-8; it is copied
+    to the output otherwise unchanged.
+*/
+void QJsonStreamWriter::append(QUtf8StringView str)
+{
+    d->writeString(str);
+}
+
+/*!
+    \fn void QJsonStreamWriter::append(const QString &str)
+    \overload
+
+    Appends the string \a str to the stream.
+*/
+
+/*!
+    \fn void QJsonStreamWriter::append(std::nullptr_t)
+    \overload
+
+    Appends a \c null value to the stream. Same as appendNull().
+*/
+
+/*!
+    \fn void QJsonStreamWriter::append(const char *str, qsizetype size)
+    \overload
+
+    Appends \a size bytes of the UTF-8 string \a str to the stream. If \a
+    size is -1, \a str must be null-terminated.
+
+    This function is not available if \c QT_NO_CAST_FROM_ASCII is defined.
+*/
+
+/*!
+    \overload
+
+    Appends \a value, including the contents of arrays and objects, to the
+    stream. Undefined values are written as \c null.
+
+    \sa QJsonDocument::toJson()
+*/
+void QJsonStreamWriter::append(const QJsonValue &value)
+{
+    const QCborValue &v = Value::toCbor(value);
+    switch (v.type()) {
+    case QCborValue::Integer:
+        d->writeInteger(v.toInteger());
+        break;
+    case QCborValue::Double:
+        d->writeDouble(v.toDouble());
+        break;
+    case QCborValue::String:
+        d->writeString(QStringView(v.toString()));
+        break;
+    case QCborValue::Array:
+    case QCborValue::Map:
+        d->writeContainer(Value::container(v), v.isMap());
+        break;
+    case QCborValue::True:
+        d->writeLiteral("true");
+        break;
+    case QCborValue::False:
+        d->writeLiteral("false");
+        break;
+    default:
+        d->writeLiteral("null");
+        break;
+    }
+}
+
+/*!
+    Appends a \c null value to the stream.
+*/
+void QJsonStreamWriter::appendNull()
+{
+    d->writeLiteral("null");
+}
+
+/*!
+    Starts a JSON array. Each startArray() call must be paired with one
+    endArray() call.
+
+    \sa endArray(), startObject()
+*/
+void QJsonStreamWriter::startArray()
+{
+    d->startContainer(false);
+}
+
+/*!
+    Terminates the array started by startArray() and returns \c true if the
+    array was written correctly.
+
+    A return of \c false indicates an error in the application, such as
+    calling this function when no array is open, and means the output is not
+    valid JSON. QJsonStreamWriter also writes a warning using qWarning() if
+    that happens.
+
+    \sa startArray(), endObject()
+*/
+bool QJsonStreamWriter::endArray()
+{
+    return d->closeContainer(false);
+}
+
+/*!
+    Starts a JSON object. Each startObject() call must be paired with one
+    endObject() call. The items appended until then alternate between the
+    key, which must be a string, and the value of each member.
+
+    \sa endObject(), startArray()
+*/
+void QJsonStreamWriter::startObject()
+{
+    d->startContainer(true);
+}
+
+/*!
+    Terminates the object started by startObject() and returns \c true if
+    the object was written correctly.
+
+    A return of \c false indicates an error in the application, such as a key
+    that was not a string or a key without a value, and means the output is
+    not valid JSON. QJsonStreamWriter also writes a warning using qWarning()
+    if that happens.
+
+    \sa startObject(), endArray()
+*/
+bool QJsonStreamWriter::endObject()
+{
+    return d->closeContainer(true);
+}
+
+/*!
+    Writes any buffered output to the device and returns \c true if all
+    output so far could be written, or \c false if the device reported an
+    error. Output that could not be written is discarded.
+
+    Flushing happens automatically whenever the internal buffer fills up and
+    when the writer is destroyed. Call this function to hand a partial
+    document to the device earlier, or to check for write errors.
+*/
+bool QJsonStreamWriter::flush()
+{
+    return d->flush();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,70 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONSTREAMWRITER_H
+#define QJSONSTREAMWRITER_H
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringview.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <memory>
+
+QT_REQUIRE_CONFIG(jsonstreamwriter);
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+class QJsonStreamWriterPrivate;
+class Q_CORE_EXPORT QJsonStreamWriter
+{
+public:
+    explicit QJsonStreamWriter(QIODevice *device);
+    explicit QJsonStreamWriter(QByteArray *data);
+    ~QJsonStreamWriter();
+    Q_DISABLE_COPY(QJsonStreamWriter)
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    void setFormat(QJsonValue::JsonFormat format);
+    QJsonValue::JsonFormat format() const;
+
+    void append(qint64 i);
+    void append(double d);
+    void append(bool b);
+    void append(QLatin1StringView str);
+    void append(QStringView str);
+    void append(QUtf8StringView str);
+    void append(const QString &str)         { append(QStringView(str)); }
+    void append(std::nullptr_t)             { appendNull(); }
+    void append(const QJsonValue &value);
+    void appendNull();
+
+#ifndef Q_QDOC
+    // overloads to make normal code not complain
+    void append(int i)      { append(qint64(i)); }
+    void append(uint u)     { append(qint64(u)); }
+#endif
+#ifndef QT_NO_CAST_FROM_ASCII
+    void append(const char *str, qsizetype size = -1)
+    { append(QUtf8StringView(str, (str && size == -1) ? qsizetype(strlen(str)) : size)); }
+#endif
+
+    void startArray();
+    bool endArray();
+    void startObject();
+    bool endObject();
+
+    bool flush();
+
+private:
+    std::unique_ptr<QJsonStreamWriterPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMWRITER_H
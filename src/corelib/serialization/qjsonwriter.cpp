@@ -22,62 +22,73 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(QStringView s)
+static inline uchar *escapeAscii(uchar *cursor, uchar u)
+{
+    *cursor++ = '\\';
+    switch (u) {
+    case 0x22:
+        *cursor++ = '"';
+        break;
+    case 0x5c:
+        *cursor++ = '\\';
+        break;
+    case 0x8:
+        *cursor++ = 'b';
+        break;
+    case 0xc:
+        *cursor++ = 'f';
+        break;
+    case 0xa:
+        *cursor++ = 'n';
+        break;
+    case 0xd:
+        *cursor++ = 'r';
+        break;
+    case 0x9:
+        *cursor++ = 't';
+        break;
+    default:
+        *cursor++ = 'u';
+        *cursor++ = '0';
+        *cursor++ = '0';
+        *cursor++ = hexdig(u>>4);
+        *cursor++ = hexdig(u & 0xf);
+    }
+    return cursor;
+}
+
+static inline bool needsEscape(uchar u)
+{
+    return u < 0x20 || u == 0x22 || u == 0x5c;
+}
+
+void Writer::appendEscaped(QByteArray &json, QStringView s)
 {
     // give it a minimum size to ensure the resize() below always adds enough space
-    QByteArray ba(qMax(s.size(), 16), Qt::Uninitialized);
+    const qsizetype start = json.size();
+    json.resize(start + qMax(s.size(), 16));
 
-    auto ba_const_start = [&]() { return reinterpret_cast<const uchar *>(ba.constData()); };
-    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
-    const uchar *ba_end = cursor + ba.size();
+    auto json_const_start = [&]() { return reinterpret_cast<const uchar *>(json.constData()); };
+    uchar *cursor = reinterpret_cast<uchar *>(json.data()) + start;
+    const uchar *json_end = json_const_start() + json.size();
     const char16_t *src = s.utf16();
     const char16_t *const end = s.utf16() + s.size();
 
     while (src != end) {
-        if (cursor >= ba_end - 6) {
+        if (cursor >= json_end - 6) {
             // ensure we have enough space
-            qptrdiff pos = cursor - ba_const_start();
-            ba.resize(ba.size()*2);
-            cursor = reinterpret_cast<uchar *>(ba.data()) + pos;
-            ba_end = ba_const_start() + ba.size();
+            qptrdiff pos = cursor - json_const_start();
+            json.resize(json.size() + qMax(end - src, qptrdiff(16)) * 2);
+            cursor = reinterpret_cast<uchar *>(json.data()) + pos;
+            json_end = json_const_start() + json.size();
         }
 
         char16_t u = *src++;
         if (u < 0x80) {
-            if (u < 0x20 || u == 0x22 || u == 0x5c) {
-                *cursor++ = '\\';
-                switch (u) {
-                case 0x22:
-                    *cursor++ = '"';
-                    break;
-                case 0x5c:
-                    *cursor++ = '\\';
-                    break;
-                case 0x8:
-                    *cursor++ = 'b';
-                    break;
-                case 0xc:
-                    *cursor++ = 'f';
-                    break;
-                case 0xa:
-                    *cursor++ = 'n';
-                    break;
-                case 0xd:
-                    *cursor++ = 'r';
-                    break;
-                case 0x9:
-                    *cursor++ = 't';
-                    break;
-                default:
-                    *cursor++ = 'u';
-                    *cursor++ = '0';
-                    *cursor++ = '0';
-                    *cursor++ = hexdig(u>>4);
-                    *cursor++ = hexdig(u & 0xf);
-               }
-            } else {
+            if (needsEscape(u))
+                cursor = escapeAscii(cursor, u);
+            else
                 *cursor++ = (uchar)u;
-            }
         } else if (QUtf8Functions::toUtf8<QUtf8BaseTraits>(u, cursor, src, end) < 0) {
             // failed to get valid utf8 use JSON escape sequence
             *cursor++ = '\\';
@@ -89,8 +100,52 @@ static QByteArray escapedString(QStringView s)
         }
     }
 
-    ba.resize(cursor - ba_const_start());
-    return ba;
+    json.resize(cursor - json_const_start());
+}
+
+void Writer::appendEscaped(QByteArray &json, QLatin1StringView s)
+{
+    const uchar *src = reinterpret_cast<const uchar *>(s.data());
+    const uchar *const end = src + s.size();
+    while (src != end) {
+        // copy the run that needs no conversion in one go
+        const uchar *run = src;
+        while (src != end && *src < 0x80 && !needsEscape(*src))
+            ++src;
+        json.append(reinterpret_cast<const char *>(run), src - run);
+        if (src == end)
+            break;
+
+        uchar buf[6];
+        uchar *cursor = buf;
+        const uchar u = *src++;
+        if (u < 0x80) {
+            cursor = escapeAscii(cursor, u);
+        } else {
+            *cursor++ = 0xc0 | (u >> 6);
+            *cursor++ = 0x80 | (u & 0x3f);
+        }
+        json.append(reinterpret_cast<const char *>(buf), cursor - buf);
+    }
+}
+
+void Writer::appendEscaped(QByteArray &json, QUtf8StringView s)
+{
+    // the input is assumed to be valid UTF-8, so only the ASCII characters
+    // JSON reserves need to be replaced
+    const uchar *src = reinterpret_cast<const uchar *>(s.data());
+    const uchar *const end = src + s.size();
+    while (src != end) {
+        const uchar *run = src;
+        while (src != end && !needsEscape(*src))
+            ++src;
+        json.append(reinterpret_cast<const char *>(run), src - run);
+        if (src == end)
+            break;
+
+        uchar buf[6];
+        json.append(reinterpret_cast<const char *>(buf), escapeAscii(buf, *src++) - buf);
+    }
 }
 
 static void valueContentToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
@@ -116,7 +171,7 @@ static void valueContentToJson(const QCborValue &v, QByteArray &json, int indent
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        Writer::appendEscaped(json, v.toString());
         json += '"';
         break;
     case QCborValue::Array:
@@ -174,7 +229,7 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
         QCborValue e = o->valueAt(i);
         json += indentString;
         json += '"';
-        json += escapedString(o->valueAt(i).toString());
+        Writer::appendEscaped(json, o->valueAt(i).toString());
         json += compact ? "\":" : "\": ";
         valueContentToJson(o->valueAt(i + 1), json, indent, compact);
 
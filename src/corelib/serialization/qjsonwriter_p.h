@@ -29,6 +29,11 @@ public:
     static void objectToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact = false);
     static void arrayToJson(const QCborContainerPrivate *a, QByteArray &json, int indent, bool compact = false);
     static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact = false);
+
+    // append the contents of a JSON string, without the quotes
+    static void appendEscaped(QByteArray &json, QStringView s);
+    static void appendEscaped(QByteArray &json, QLatin1StringView s);
+    static void appendEscaped(QByteArray &json, QUtf8StringView s);
 };
 
 }
@@ -630,17 +630,22 @@ inline const QChar *QTextStreamPrivate::readPtr() const
 /*!
     \internal
 */
-inline void QTextStreamPrivate::consumeLastToken()
+inline void QTextStreamPrivate::consumeLastToken(ConsumeMode mode)
 {
     if (lastTokenSize)
-        consume(lastTokenSize);
+        consume(lastTokenSize, mode);
     lastTokenSize = 0;
 }
 
 /*!
     \internal
+
+    With KeepConsumedData, the consumed characters stay where they are in
+    memory until the next read: instead of being removed from readBuffer,
+    the unconsumed rest is moved to lineViewBuffer and the two buffers are
+    swapped.
 */
-inline void QTextStreamPrivate::consume(int size)
+inline void QTextStreamPrivate::consume(int size, ConsumeMode mode)
 {
 #if defined (QTEXTSTREAM_DEBUG)
     qDebug("QTextStreamPrivate::consume(%d)", size);
@@ -651,12 +656,21 @@ inline void QTextStreamPrivate::consume(int size)
             stringOffset = string->size();
     } else {
         readBufferOffset += size;
-        if (readBufferOffset >= readBuffer.size()) {
+        const bool consumedAll = readBufferOffset >= readBuffer.size();
+        if (mode == KeepConsumedData && (consumedAll || readBufferOffset > QTEXTSTREAM_BUFFERSIZE)) {
+            lineViewBuffer.resize(0);
+            if (!consumedAll)
+                lineViewBuffer.append(QStringView(readBuffer).sliced(readBufferOffset));
+            readBuffer.swap(lineViewBuffer);
+        }
+        if (consumedAll) {
             readBufferOffset = 0;
-            readBuffer.clear();
+            if (mode == DropConsumedData)
+                readBuffer.clear();
             saveConverterState(device->pos());
         } else if (readBufferOffset > QTEXTSTREAM_BUFFERSIZE) {
-            readBuffer = readBuffer.remove(0,readBufferOffset);
+            if (mode == DropConsumedData)
+                readBuffer = readBuffer.remove(0,readBufferOffset);
             readConverterSavedStateOffset += readBufferOffset;
             readBufferOffset = 0;
         }
@@ -1596,6 +1610,44 @@ bool QTextStream::readLineInto(QString *line, qint64 maxlen)
     return true;
 }
 
+/*!
+    \since 6.10
+
+    Reads one line of text from the stream, and returns a view of it. The
+    maximum allowed line length is set to \a maxlen; longer lines are split
+    after \a maxlen characters and returned in parts. If \a maxlen is 0, the
+    lines can be of any length.
+
+    Unlike readLine() and readLineInto(), this function does not copy the
+    line: the returned view points into the stream's buffer, or into the
+    string the stream operates on. It stays valid until the next operation
+    that reads from, seeks in or resets the stream, or until the stream is
+    destroyed.
+
+    The returned line has no trailing end-of-line characters ("\\n" or
+    "\\r\\n"). If the stream has read to the end of the file or an error has
+    occurred, a null view is returned; an empty line returns an empty but
+    not null view.
+
+    \snippet code/src_corelib_io_qtextstream.cpp 10
+
+    \sa readLine(), readLineInto(), QStringView::isNull()
+*/
+QStringView QTextStream::readLineView(qint64 maxlen)
+{
+    Q_D(QTextStream);
+    CHECK_VALID_STREAM(QStringView());
+
+    const QChar *readPtr;
+    int length;
+    if (!d->scan(&readPtr, &length, int(maxlen), QTextStreamPrivate::EndOfLine))
+        return QStringView();
+
+    const QStringView line(readPtr, length);
+    d->consumeLastToken(QTextStreamPrivate::KeepConsumedData);
+    return line;
+}
+
 /*!
     \since 4.1
 
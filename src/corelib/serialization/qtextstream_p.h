@@ -95,6 +95,7 @@ public:
 
     QString writeBuffer;
     QString readBuffer;
+    QString lineViewBuffer; // keeps the data of the last readLineView() alive
     int readBufferOffset;
     int readConverterSavedStateOffset; //the offset between readBufferStartDevicePos and that start of the buffer
     qint64 readBufferStartDevicePos;
@@ -123,8 +124,12 @@ public:
     bool scan(const QChar **ptr, int *tokenLength,
               int maxlen, TokenDelimiter delimiter);
     inline const QChar *readPtr() const;
-    inline void consumeLastToken();
-    inline void consume(int nchars);
+    enum ConsumeMode {
+        DropConsumedData,
+        KeepConsumedData,   // for views into the read buffer
+    };
+    inline void consumeLastToken(ConsumeMode mode = DropConsumedData);
+    inline void consume(int nchars, ConsumeMode mode = DropConsumedData);
     void saveConverterState(qint64 newPos);
     void restoreToSavedConverterState();
 
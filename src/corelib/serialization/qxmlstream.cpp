@@ -16,6 +16,7 @@
 #include <qcoreapplication.h>
 
 #include <private/qoffsetstringarray_p.h>
+#include <private/qsimd_p.h>
 #include <private/qtools_p.h>
 
 #include <iterator>
@@ -896,6 +897,7 @@ void QXmlStreamReaderPrivate::init()
     namespaceProcessing = true;
     rawReadBuffer.clear();
     dataBuffer.clear();
+    dataBufferPos = 0;
     readBuffer.clear();
     tagStackStringStorageSize = initialTagStackStringStorageSize;
 
@@ -999,6 +1001,106 @@ inline uint QXmlStreamReaderPrivate::peekChar()
     return c;
 }
 
+/*!
+  \internal
+
+  Returns the length of the run at the start of \a str made of characters that
+  the fastScan functions append to textBuffer unchanged: anything but control
+  characters, the non-characters U+FFFE and U+FFFF, '&', '<', and either ']'
+  (PlainContent) or the quotes (PlainLiteral).
+ */
+template <QXmlStreamReaderPrivate::PlainRunType Type>
+static qsizetype plainRunLength(QStringView str) noexcept
+{
+    const char16_t *begin = str.utf16();
+    const char16_t *ptr = begin;
+    const char16_t *end = begin + str.size();
+#if defined(__SSE2__)
+    const __m128i controlMax = _mm_set1_epi16(0x1f);
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i allOnes = _mm_set1_epi16(-1);
+    const __m128i ampersand = _mm_set1_epi16('&');
+    const __m128i lessThan = _mm_set1_epi16('<');
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i apostrophe = _mm_set1_epi16('\'');
+    const __m128i bracket = _mm_set1_epi16(']');
+    for ( ; end - ptr >= 8; ptr += 8) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        // c <= 0x1f and c >= 0xfffe, with unsigned saturation
+        __m128i special = _mm_or_si128(
+                _mm_cmpeq_epi16(_mm_subs_epu16(data, controlMax), _mm_setzero_si128()),
+                _mm_cmpeq_epi16(_mm_adds_epu16(data, one), allOnes));
+        special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi16(data, ampersand),
+                                                     _mm_cmpeq_epi16(data, lessThan)));
+        if constexpr (Type == QXmlStreamReaderPrivate::PlainLiteral) {
+            special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi16(data, quote),
+                                                         _mm_cmpeq_epi16(data, apostrophe)));
+        } else {
+            special = _mm_or_si128(special, _mm_cmpeq_epi16(data, bracket));
+        }
+        // two mask bits per character
+        if (uint mask = _mm_movemask_epi8(special))
+            return ptr - begin + qCountTrailingZeroBits(mask) / 2;
+    }
+#elif defined(__ARM_NEON__)
+    const uint16x8_t controlMax = vdupq_n_u16(0x1f);
+    const uint16x8_t nonCharacter = vdupq_n_u16(0xfffe);
+    for ( ; end - ptr >= 8; ptr += 8) {
+        uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(ptr));
+        uint16x8_t special = vorrq_u16(vcleq_u16(data, controlMax), vcgeq_u16(data, nonCharacter));
+        special = vorrq_u16(special, vorrq_u16(vceqq_u16(data, vdupq_n_u16('&')),
+                                               vceqq_u16(data, vdupq_n_u16('<'))));
+        if constexpr (Type == QXmlStreamReaderPrivate::PlainLiteral) {
+            special = vorrq_u16(special, vorrq_u16(vceqq_u16(data, vdupq_n_u16('"')),
+                                                   vceqq_u16(data, vdupq_n_u16('\''))));
+        } else {
+            special = vorrq_u16(special, vceqq_u16(data, vdupq_n_u16(']')));
+        }
+        // narrow to one byte per character
+        const quint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(special, 4)), 0);
+        if (mask)
+            return ptr - begin + qCountTrailingZeroBits(mask) / 8;
+    }
+#endif
+
+    for ( ; ptr != end; ++ptr) {
+        const char16_t c = *ptr;
+        if (c < 0x20 || c >= 0xfffe || c == '&' || c == '<')
+            break;
+        if (Type == QXmlStreamReaderPrivate::PlainLiteral ? (c == '"' || c == '\'') : c == ']')
+            break;
+    }
+    return ptr - begin;
+}
+
+/*!
+  \internal
+
+  Appends the run of characters that need no special treatment from the read
+  buffer to textBuffer in one go and returns its length. The caller handles the
+  character following it with getChar().
+ */
+template <QXmlStreamReaderPrivate::PlainRunType Type>
+inline qsizetype QXmlStreamReaderPrivate::copyPlainRun()
+{
+    if (!putStack.isEmpty() || readBufferPos >= readBuffer.size())
+        return 0;
+
+    const QStringView rest = QStringView(readBuffer).sliced(readBufferPos);
+    const qsizetype n = plainRunLength<Type>(rest);
+    if (n == 0)
+        return 0;
+
+    const QStringView run = rest.first(n);
+    if constexpr (Type == PlainContent) {
+        if (isWhitespace)
+            isWhitespace = std::all_of(run.begin(), run.end(), [](QChar c) { return c == u' '; });
+    }
+    textBuffer += run;
+    readBufferPos += n;
+    return n;
+}
+
 /*!
   \internal
 
@@ -1192,7 +1294,10 @@ inline qsizetype QXmlStreamReaderPrivate::fastScanLiteralContent()
 {
     qsizetype n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        n += copyPlainRun<PlainLiteral>();
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1275,7 +1380,10 @@ inline qsizetype QXmlStreamReaderPrivate::fastScanContentCharList()
 {
     qsizetype n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        n += copyPlainRun<PlainContent>();
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1536,12 +1644,31 @@ uint QXmlStreamReaderPrivate::getChar_helper()
         qint64 nbytesreadOrMinus1 = device->read(rawReadBuffer.data() + nbytesread, BUFFER_SIZE - nbytesread);
         nbytesread += qMax(nbytesreadOrMinus1, qint64{0});
     } else {
-        if (nbytesread)
-            rawReadBuffer += dataBuffer;
-        else
-            rawReadBuffer = dataBuffer;
+        // Decode large documents piecewise, so the UTF-16 copy of the input
+        // stays small and hot in the cache. The decoder keeps the state of
+        // sequences split across chunks.
+        constexpr qsizetype DATA_CHUNK_SIZE = 64 * 1024;
+        const qsizetype remaining = dataBuffer.size() - dataBufferPos;
+        if (dataBufferPos == 0 && remaining <= DATA_CHUNK_SIZE) {
+            if (nbytesread)
+                rawReadBuffer += dataBuffer;
+            else
+                rawReadBuffer = dataBuffer;
+            dataBuffer.clear();
+        } else {
+            const QByteArrayView chunk = QByteArrayView(dataBuffer)
+                    .sliced(dataBufferPos, qMin(remaining, DATA_CHUNK_SIZE));
+            if (nbytesread)
+                rawReadBuffer += chunk;
+            else
+                rawReadBuffer.assign(chunk);
+            dataBufferPos += chunk.size();
+            if (dataBufferPos == dataBuffer.size()) {
+                dataBuffer.clear();
+                dataBufferPos = 0;
+            }
+        }
         nbytesread = rawReadBuffer.size();
-        dataBuffer.clear();
     }
     if (!nbytesread) {
         atEnd = true;
@@ -238,6 +238,7 @@ public:
 
     QByteArray rawReadBuffer;
     QByteArray dataBuffer;
+    qsizetype dataBufferPos;
     uchar firstByte;
     qint64 nbytesread;
     QString readBuffer;
@@ -507,6 +508,9 @@ public:
 
     // scan optimization functions. Not strictly necessary but LALR is
     // not very well suited for scanning fast
+    enum PlainRunType { PlainContent, PlainLiteral };
+    template <PlainRunType Type>
+    qsizetype copyPlainRun();
     qsizetype fastScanLiteralContent();
     qsizetype fastScanSpace();
     qsizetype fastScanContentCharList();
@@ -47,6 +47,7 @@ QT_WARNING_DISABLE_GCC("-Wfree-nonheap-object") // false positive tracking
 #endif
 #include "private/qnumeric_p.h"
 #include "private/qtools_p.h"
+#include <algorithm>
 #include <cmath>
 #ifndef QT_NO_SYSTEMLOCALE
 #   include "qmutex.h"
@@ -2951,6 +2952,15 @@ QString QLocale::toString(double f, char format, int precision) const
         break;
     }
 
+    constexpr NumberOptions FormattingOptions =
+            OmitGroupSeparator | OmitLeadingZeroInExponent | IncludeTrailingZeroesAfterDot;
+    if (d->m_data == QLocaleData::c()
+            && (d->m_numberOptions & FormattingOptions) == OmitGroupSeparator) {
+        // The C locale with its default options formats exactly like
+        // QString::number(), which skips the localization of the digits.
+        return qdtoBasicLatin(f, form, precision, isAsciiUpper(format));
+    }
+
     if (!(d->m_numberOptions & OmitGroupSeparator))
         flags |= QLocaleData::GroupDigits;
     if (!(d->m_numberOptions & OmitLeadingZeroInExponent))
@@ -4692,6 +4702,27 @@ QLocaleData::validateChars(QStringView str, NumberMode numMode, int decDigits,
 double QLocaleData::stringToDouble(QStringView str, bool *ok,
                                    QLocale::NumberOptions number_options) const
 {
+    constexpr QLocale::NumberOptions StrictOptions =
+            QLocale::RejectLeadingZeroInExponent | QLocale::RejectTrailingZeroesAfterDot;
+    if (this == c() && !(number_options & StrictOptions)) {
+        // Fast path for plain C-locale numbers, which need no conversion: a
+        // string of only these characters parses the same either way.
+        constexpr qsizetype MaxLength = 64;
+        char latin1[MaxLength];
+        const auto isPlain = [](QChar ch) {
+            const char16_t c = ch.unicode();
+            return isAsciiDigit(c) || c == u'.' || c == u'e' || c == u'E' || c == u'+' || c == u'-';
+        };
+        if (str.size() <= MaxLength && std::all_of(str.begin(), str.end(), isPlain)) {
+            std::transform(str.begin(), str.end(), latin1, [](QChar ch) { return char(ch.unicode()); });
+            if (auto r = qt_asciiToDouble(latin1, str.size()); r.ok()) {
+                if (ok != nullptr)
+                    *ok = true;
+                return r.result;
+            }
+        }
+    }
+
     CharBuff buff;
     if (!numberToCLocale(str, number_options, DoubleScientificMode, &buff)) {
         if (ok != nullptr)
@@ -45,6 +45,49 @@ using namespace QtMiscUtils;
 
 QT_CLOCALE_HOLDER
 
+#if defined(__cpp_lib_to_chars) && !defined(QT_BOOTSTRAPPED)
+// The standard library's floating-point std::to_chars() and std::from_chars()
+// are complete and use shortest round-trip (Ryu-class) and Eisel-Lemire
+// algorithms, which are considerably faster than libdouble-conversion.
+#  define QT_USE_CHARCONV_FOR_DOUBLE
+#endif
+
+#ifdef QT_USE_CHARCONV_FOR_DOUBLE
+/*
+    Produces the shortest digit string that round-trips to \a d, the same
+    digits libdouble-conversion's SHORTEST mode produces. Rounding in the
+    precision modes differs (std::to_chars() rounds exact ties to even,
+    libdouble-conversion away from zero), so those keep using the latter.
+*/
+static void doubleToAsciiShortest(double d, char *buf, qsizetype bufSize,
+                                  bool &sign, int &length, int &decpt)
+{
+    // "-d.ddddddddddddddddde-308"
+    char digits[std::numeric_limits<double>::max_digits10 + 8];
+    const auto r = std::to_chars(digits, digits + sizeof(digits), d,
+                                 std::chars_format::scientific);
+    Q_ASSERT(r.ec == std::errc{});
+
+    const char *p = digits;
+    sign = *p == '-';
+    if (sign)
+        ++p;
+    length = 0;
+    for ( ; *p != 'e'; ++p) {
+        if (*p != '.' && length < bufSize)
+            buf[length++] = *p;
+    }
+
+    ++p; // 'e'
+    const bool negativeExponent = *p++ == '-';
+    int exponent = 0;
+    for ( ; p != r.ptr; ++p)
+        exponent = exponent * 10 + (*p - '0');
+    // one digit before the dot
+    decpt = (negativeExponent ? -exponent : exponent) + 1;
+}
+#endif // QT_USE_CHARCONV_FOR_DOUBLE
+
 void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
                       char *buf, qsizetype bufSize,
                       bool &sign, int &length, int &decpt)
@@ -87,6 +130,14 @@ void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
     if (form == QLocaleData::DFSignificantDigits && precision == 0)
         precision = 1; // 0 significant digits is silently converted to 1
 
+#ifdef QT_USE_CHARCONV_FOR_DOUBLE
+    if (precision == QLocale::FloatingPointShortest) {
+        // the shortest representation never has trailing zeroes
+        doubleToAsciiShortest(d, buf, bufSize, sign, length, decpt);
+        return;
+    }
+#endif
+
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
     // one digit before the decimal dot, counts as significant digit for DoubleToStringConverter
     if (form == QLocaleData::DFExponent && precision >= 0)
@@ -295,6 +346,30 @@ QSimpleParsedNumber<double> qt_asciiToDouble(const char *num, qsizetype numLen,
         }
     }
 
+#ifdef QT_USE_CHARCONV_FOR_DOUBLE
+    if (strayCharMode != TrailingJunkAllowed) {
+        // Fast path for well-formed, finite numbers. Anything else, including
+        // overflow and underflow, is left to the code below, which knows how
+        // to report it.
+        const char *begin = num;
+        const char *end = num + numLen;
+        if (strayCharMode == WhitespacesAllowed) {
+            while (begin != end && ascii_isspace(*begin))
+                ++begin;
+            while (begin != end && ascii_isspace(end[-1]))
+                --end;
+        }
+        // std::from_chars() doesn't accept a leading '+'
+        if (end - begin > 1 && *begin == '+' && begin[1] != '-' && begin[1] != '+')
+            ++begin;
+
+        double d;
+        const auto r = std::from_chars(begin, end, d, std::chars_format::general);
+        if (r.ec == std::errc{} && r.ptr == end && qt_is_finite(d))
+            return { d, numLen };
+    }
+#endif // QT_USE_CHARCONV_FOR_DOUBLE
+
     double d = 0.0;
     int processed;
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
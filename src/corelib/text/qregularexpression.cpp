@@ -5,6 +5,7 @@
 
 #include "qregularexpression.h"
 
+#include <QtCore/qcache.h>
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qhashfunctions.h>
 #include <QtCore/qlist.h>
@@ -14,6 +15,7 @@
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/private/qtools_p.h>
 
 #if defined(Q_OS_MACOS)
 #include <QtCore/private/qcore_mac_p.h>
@@ -23,6 +25,8 @@
 
 #include <pcre2.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
@@ -414,6 +418,17 @@ using namespace Qt::StringLiterals;
 
     This may change in a future version of Qt.
 
+    \section1 Sharing of Compiled Patterns
+
+    Since Qt 6.10, QRegularExpression objects with the same pattern and
+    pattern options share the compiled (and possibly JIT compiled) form of
+    the pattern, even if they were constructed independently. A process-wide
+    cache keeps the compiled form of the most recently used patterns, so that
+    recreating a QRegularExpression, for instance a local variable in a
+    function that is called repeatedly, does not compile its pattern again.
+
+    To match one string against many patterns, use QRegularExpressionSet.
+
     \section1 Debugging Code that Uses QRegularExpression
 
     QRegularExpression internally uses a just in time compiler (JIT) to
@@ -430,7 +445,8 @@ using namespace Qt::StringLiterals;
     \c{QT_ENABLE_REGEXP_JIT} environment variable to a non-zero or zero value
     respectively.
 
-    \sa QRegularExpressionMatch, QRegularExpressionMatchIterator
+    \sa QRegularExpressionMatch, QRegularExpressionMatchIterator,
+        QRegularExpressionSet
 */
 
 /*!
@@ -702,6 +718,29 @@ static int convertToPcreOptions(QRegularExpression::MatchOptions matchOptions)
     return options;
 }
 
+/*
+    A compiled pattern, JIT-compiled if the JIT is enabled. It never changes
+    once created, so any number of QRegularExpressionPrivate objects with the
+    same pattern and options can share it, in any thread: PCRE2 only reads the
+    compiled code while matching.
+*/
+struct QRegularExpressionCompiledPattern : QSharedData
+{
+    QRegularExpressionCompiledPattern(const QString &pattern,
+                                      QRegularExpression::PatternOptions patternOptions);
+    ~QRegularExpressionCompiledPattern();
+    Q_DISABLE_COPY_MOVE(QRegularExpressionCompiledPattern)
+
+    void getPatternInfo(const QString &pattern);
+    void optimizePattern();
+
+    pcre2_code_16 *code = nullptr;
+    int errorCode = 0;
+    qsizetype errorOffset = -1;
+    int capturingCount = 0;
+    bool usingCrLfNewlines = false;
+};
+
 struct QRegularExpressionPrivate : QSharedData
 {
     QRegularExpressionPrivate();
@@ -710,8 +749,6 @@ struct QRegularExpressionPrivate : QSharedData
 
     void cleanCompiledPattern();
     void compilePattern();
-    void getPatternInfo();
-    void optimizePattern();
 
     enum CheckSubjectStringOption {
         CheckSubjectString,
@@ -734,9 +771,10 @@ struct QRegularExpressionPrivate : QSharedData
     // (right after a detach happened).
     mutable QMutex mutex;
 
-    // The PCRE code pointer is reference-counted by the QRegularExpressionPrivate
-    // objects themselves; when the private is copied (i.e. a detach happened)
-    // it is set to nullptr
+    // The compiled pattern comes from the process-wide cache and may be shared
+    // with other QRegularExpressionPrivate objects; when the private is copied
+    // (i.e. a detach happened) it is reset. compiledPattern is compiled->code.
+    QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled;
     pcre2_code_16 *compiledPattern;
     int errorCode;
     qsizetype errorOffset;
@@ -870,7 +908,7 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
 */
 void QRegularExpressionPrivate::cleanCompiledPattern()
 {
-    pcre2_code_free_16(compiledPattern);
+    compiled.reset();
     compiledPattern = nullptr;
     errorCode = 0;
     errorOffset = -1;
@@ -878,6 +916,76 @@ void QRegularExpressionPrivate::cleanCompiledPattern()
     usingCrLfNewlines = false;
 }
 
+namespace {
+struct CompiledPatternCacheKey
+{
+    QString pattern;
+    QRegularExpression::PatternOptions patternOptions;
+
+    friend bool operator==(const CompiledPatternCacheKey &lhs,
+                           const CompiledPatternCacheKey &rhs) noexcept
+    {
+        return lhs.patternOptions == rhs.patternOptions && lhs.pattern == rhs.pattern;
+    }
+    friend size_t qHash(const CompiledPatternCacheKey &key, size_t seed = 0) noexcept
+    {
+        return qHashMulti(seed, key.pattern, key.patternOptions.toInt());
+    }
+};
+
+/*
+    The process-wide cache of compiled patterns, so that constructing the same
+    regular expression in several places compiles (and JIT-compiles) it only
+    once. It keeps the most recently used patterns alive even when no
+    QRegularExpression refers to them any more; entries that are still in use
+    survive eviction, as they are reference-counted.
+*/
+struct CompiledPatternCache
+{
+    static constexpr qsizetype MaxCost = 256;
+
+    struct Entry
+    {
+        QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled;
+    };
+
+    QBasicMutex mutex;
+    QCache<CompiledPatternCacheKey, Entry> cache{MaxCost};
+};
+Q_GLOBAL_STATIC(CompiledPatternCache, compiledPatternCache)
+}
+
+/*!
+    \internal
+
+    Returns the compiled form of \a pattern with \a patternOptions, from the
+    cache if possible.
+*/
+static QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern>
+compiledPatternFor(const QString &pattern, QRegularExpression::PatternOptions patternOptions)
+{
+    using Compiled = QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern>;
+    CompiledPatternCache *cache = compiledPatternCache();
+    if (!cache) // during application shutdown
+        return Compiled(new QRegularExpressionCompiledPattern(pattern, patternOptions));
+
+    CompiledPatternCacheKey key{pattern, patternOptions};
+    {
+        const QMutexLocker lock(&cache->mutex);
+        if (const CompiledPatternCache::Entry *entry = cache->cache.object(key))
+            return entry->compiled;
+    }
+
+    // compile without holding the lock; if another thread was faster, use
+    // its result instead
+    Compiled compiled(new QRegularExpressionCompiledPattern(pattern, patternOptions));
+    const QMutexLocker lock(&cache->mutex);
+    if (const CompiledPatternCache::Entry *entry = cache->cache.object(key))
+        return entry->compiled;
+    cache->cache.insert(std::move(key), new CompiledPatternCache::Entry{compiled});
+    return compiled;
+}
+
 /*!
     \internal
 */
@@ -891,18 +999,32 @@ void QRegularExpressionPrivate::compilePattern()
     isDirty = false;
     cleanCompiledPattern();
 
+    compiled = compiledPatternFor(pattern, patternOptions);
+    compiledPattern = compiled->code;
+    errorCode = compiled->errorCode;
+    errorOffset = compiled->errorOffset;
+    capturingCount = compiled->capturingCount;
+    usingCrLfNewlines = compiled->usingCrLfNewlines;
+}
+
+/*!
+    \internal
+*/
+QRegularExpressionCompiledPattern::QRegularExpressionCompiledPattern(
+        const QString &pattern, QRegularExpression::PatternOptions patternOptions)
+{
     int options = convertToPcreOptions(patternOptions);
     options |= PCRE2_UTF;
 
     PCRE2_SIZE patternErrorOffset;
-    compiledPattern = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.constData()),
-                                       pattern.size(),
-                                       options,
-                                       &errorCode,
-                                       &patternErrorOffset,
-                                       nullptr);
-
-    if (!compiledPattern) {
+    code = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.constData()),
+                            pattern.size(),
+                            options,
+                            &errorCode,
+                            &patternErrorOffset,
+                            nullptr);
+
+    if (!code) {
         errorOffset = qsizetype(patternErrorOffset);
         return;
     } else {
@@ -911,21 +1033,29 @@ void QRegularExpressionPrivate::compilePattern()
     }
 
     optimizePattern();
-    getPatternInfo();
+    getPatternInfo(pattern);
 }
 
 /*!
     \internal
 */
-void QRegularExpressionPrivate::getPatternInfo()
+QRegularExpressionCompiledPattern::~QRegularExpressionCompiledPattern()
 {
-    Q_ASSERT(compiledPattern);
+    pcre2_code_free_16(code);
+}
 
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
+/*!
+    \internal
+*/
+void QRegularExpressionCompiledPattern::getPatternInfo(const QString &pattern)
+{
+    Q_ASSERT(code);
+
+    pcre2_pattern_info_16(code, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
 
     // detect the settings for the newline
     unsigned int patternNewlineSetting;
-    if (pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
+    if (pcre2_pattern_info_16(code, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
         // no option was specified in the regexp, grab PCRE build defaults
         pcre2_config_16(PCRE2_CONFIG_NEWLINE, &patternNewlineSetting);
     }
@@ -935,7 +1065,7 @@ void QRegularExpressionPrivate::getPatternInfo()
             (patternNewlineSetting == PCRE2_NEWLINE_ANYCRLF);
 
     unsigned int hasJOptionChanged;
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
+    pcre2_pattern_info_16(code, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
     if (Q_UNLIKELY(hasJOptionChanged)) {
         qWarning("QRegularExpressionPrivate::getPatternInfo(): the pattern '%ls'\n    is using the (?J) option; duplicate capturing group names are not supported by Qt",
                  qUtf16Printable(pattern));
@@ -994,19 +1124,19 @@ static bool isJitEnabled()
     The purpose of the function is to call pcre2_jit_compile_16, which
     JIT-compiles the pattern.
 
-    It gets called when a pattern is recompiled by us (in compilePattern()),
-    under mutex protection.
+    It gets called once when a pattern is compiled, before the compiled
+    pattern is shared.
 */
-void QRegularExpressionPrivate::optimizePattern()
+void QRegularExpressionCompiledPattern::optimizePattern()
 {
-    Q_ASSERT(compiledPattern);
+    Q_ASSERT(code);
 
     static const bool enableJit = isJitEnabled();
 
     if (!enableJit)
         return;
 
-    pcre2_jit_compile_16(compiledPattern, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
+    pcre2_jit_compile_16(code, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
 }
 
 /*!
@@ -1726,6 +1856,9 @@ QRegularExpressionMatchIterator QRegularExpression::globalMatchView(QStringView
     Compiles the pattern immediately, including JIT compiling it (if
     the JIT is enabled) for optimization.
 
+    If another QRegularExpression with the same pattern and pattern options
+    has been compiled recently, its compiled form is reused.
+
     \sa isValid(), {Debugging Code that Uses QRegularExpression}
 */
 void QRegularExpression::optimize() const
@@ -2743,6 +2876,450 @@ QtPrivate::QRegularExpressionMatchIteratorRangeBasedForIterator begin(const QReg
   \internal
 */
 
+/*!
+    \class QRegularExpressionSet
+    \inmodule QtCore
+    \reentrant
+    \since 6.10
+
+    \brief The QRegularExpressionSet class matches a string against many
+    regular expressions at once.
+
+    \ingroup tools
+    \ingroup shared
+    \ingroup string-processing
+
+    A QRegularExpressionSet holds a list of patterns, all sharing the same
+    pattern options. The matchingPatterns() function reports which of them
+    match a subject string, and matchesAny() whether at least one does:
+
+    \snippet code/src_corelib_text_qregularexpression.cpp 37
+
+    Instead of trying each pattern in turn, the set compiles the patterns into
+    a single regular expression and finds all the matching ones in one pass
+    over the subject. This is considerably faster than a loop over many
+    QRegularExpression objects, for instance when classifying log lines.
+
+    A pattern matches if QRegularExpression::match() with the same pattern
+    and options would report a match. Patterns that cannot be combined with
+    others (for instance, because they use backreferences, named capturing
+    groups, recursion or backtracking control verbs) are still supported, but
+    are matched separately.
+
+    A QRegularExpressionSet is valid only if all of its patterns are valid.
+    invalidPatternIndex() and errorString() tell which pattern is invalid and
+    why.
+
+    \sa QRegularExpression
+*/
+
+/*!
+    \internal
+
+    Returns true if \a pattern may be used as one alternative of the combined
+    pattern of a QRegularExpressionSet. This is a conservative textual check:
+    it rejects anything that refers to capturing groups by number, controls
+    the backtracking of the whole match, uses callouts, or may switch the
+    extended syntax on or off (which changes the meaning of the text we append
+    after the pattern).
+*/
+static bool canCombinePattern(QStringView pattern)
+{
+    static constexpr QStringView Forbidden[] = {
+        u"(*", u"(?C", u"(?(", u"(?R", u"(?&", u"(?P>", u"\\g<", u"\\g'",
+    };
+    for (QStringView forbidden : Forbidden) {
+        if (pattern.contains(forbidden))
+            return false;
+    }
+
+    for (qsizetype i = pattern.indexOf(u"(?"); i >= 0; i = pattern.indexOf(u"(?", i + 2)) {
+        qsizetype j = i + 2;
+        if (j < pattern.size() && (pattern[j] == u'+' || pattern[j] == u'-'))
+            ++j;
+        if (j < pattern.size() && pattern[j].isDigit())
+            return false; // subroutine call by number
+
+        // option settings, like (?i) or (?-x:...)
+        bool changesExtendedSyntax = false;
+        for (j = i + 2; j < pattern.size(); ++j) {
+            const char16_t c = pattern[j].unicode();
+            if (c == u')' || c == u':') {
+                if (changesExtendedSyntax)
+                    return false;
+                break;
+            }
+            if (c == u'x' || c == u'^')
+                changesExtendedSyntax = true;
+            else if (c != u'-' && !QtMiscUtils::isAsciiLetterOrNumber(c))
+                break;
+        }
+    }
+    return true;
+}
+
+struct QRegularExpressionSetPrivate : QSharedData
+{
+    QRegularExpressionSetPrivate(const QStringList &patterns,
+                                 QRegularExpression::PatternOptions patternOptions);
+
+    enum MatchMode {
+        FindAll,
+        FindFirst
+    };
+    QList<bool> match(QStringView subject, MatchMode mode) const;
+    void matchSeparately(QStringView subject, QList<bool> &matched,
+                         const QList<qsizetype> &indexes, MatchMode mode) const;
+
+    // PCRE2 stops analyzing very large patterns, losing the optimizations
+    // that skip impossible starting positions, so we combine at most this
+    // many patterns into one
+    static constexpr qsizetype MaxCombinedPatterns = 64;
+
+    struct CombinedPattern
+    {
+        QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled;
+        QList<qsizetype> indexes;
+    };
+
+    QStringList patterns;
+    QRegularExpression::PatternOptions patternOptions;
+    QList<QRegularExpression> expressions;
+    qsizetype invalidPatternIndex = -1;
+
+    QList<CombinedPattern> combinedPatterns;
+    QList<qsizetype> separatePatterns; // the patterns that can't be combined
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QRegularExpressionSetPrivate)
+
+/*!
+    \internal
+
+    Validates all the patterns, and builds the combined patterns
+
+    \c{(?:(?>p0\E)(?C{0})|(?>p1\E)(?C{1})|...)(*FAIL)}
+
+    where pN is the pattern with index N. The callout records a match of the
+    pattern before it; (*FAIL) then makes PCRE2 try every alternative at every
+    position of the subject, unless the callout aborts the match because
+    there is nothing left to find. The atomic groups stop PCRE2 from retrying
+    a pattern that matched in a different way at the same position, and \E
+    terminates a \Q that the pattern may have left open.
+*/
+QRegularExpressionSetPrivate::QRegularExpressionSetPrivate(
+        const QStringList &patterns, QRegularExpression::PatternOptions patternOptions)
+    : patterns(patterns),
+      patternOptions(patternOptions)
+{
+    expressions.reserve(patterns.size());
+    for (const QString &pattern : patterns)
+        expressions.emplace_back(pattern, patternOptions);
+
+    QList<qsizetype> combinable;
+    for (qsizetype i = 0; i < patterns.size(); ++i) {
+        const QString &pattern = patterns.at(i);
+        const auto compiled = compiledPatternFor(pattern, patternOptions);
+        if (!compiled->code) {
+            invalidPatternIndex = i;
+            return;
+        }
+
+        uint32_t backReferenceMax = 0;
+        uint32_t nameCount = 0;
+        pcre2_pattern_info_16(compiled->code, PCRE2_INFO_BACKREFMAX, &backReferenceMax);
+        pcre2_pattern_info_16(compiled->code, PCRE2_INFO_NAMECOUNT, &nameCount);
+        if (backReferenceMax || nameCount || !canCombinePattern(pattern))
+            separatePatterns.append(i);
+        else
+            combinable.append(i);
+    }
+
+    for (qsizetype from = 0; from < combinable.size(); from += MaxCombinedPatterns) {
+        const QList<qsizetype> indexes = combinable.mid(from, MaxCombinedPatterns);
+        QString combinedPattern = u"(?:"_s;
+        for (qsizetype index : indexes) {
+            if (index != indexes.front())
+                combinedPattern += u'|';
+            combinedPattern += "(?>"_L1 + patterns.at(index) + "\\E"_L1;
+            if (patternOptions & QRegularExpression::ExtendedPatternSyntaxOption)
+                combinedPattern += u'\n'; // terminates a trailing comment
+            combinedPattern += ")(?C{"_L1 + QString::number(index) + "})"_L1;
+        }
+        combinedPattern += ")(*FAIL)"_L1;
+
+        // Not cached: the combined pattern is only ever used by this set.
+        QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled(
+                new QRegularExpressionCompiledPattern(combinedPattern, patternOptions));
+        if (Q_LIKELY(compiled->code))
+            combinedPatterns.append({ std::move(compiled), indexes });
+        else // e.g. PCRE2's limits were hit; the patterns still work on their own
+            separatePatterns += indexes;
+    }
+    std::sort(separatePatterns.begin(), separatePatterns.end());
+}
+
+namespace {
+struct SetCalloutState
+{
+    QList<bool> *matched;
+    qsizetype remaining;
+    bool stopAtFirstMatch;
+};
+}
+
+extern "C" {
+static int qt_regularexpressionset_callout(pcre2_callout_block_16 *block, void *data)
+{
+    auto *state = static_cast<SetCalloutState *>(data);
+    const QStringView string(reinterpret_cast<const char16_t *>(block->callout_string),
+                             qsizetype(block->callout_string_length));
+    bool &matched = (*state->matched)[string.toLongLong()];
+    if (!matched) {
+        matched = true;
+        if (--state->remaining == 0 || state->stopAtFirstMatch)
+            return PCRE2_ERROR_CALLOUT;
+    }
+    return 1; // backtrack into the next alternative
+}
+}
+
+/*!
+    \internal
+*/
+void QRegularExpressionSetPrivate::matchSeparately(QStringView subject, QList<bool> &matched,
+                                                   const QList<qsizetype> &indexes,
+                                                   MatchMode mode) const
+{
+    for (qsizetype index : indexes) {
+        if (mode == FindFirst && matched.contains(true))
+            return;
+        if (!matched.at(index))
+            matched[index] = expressions.at(index).matchView(subject).hasMatch();
+    }
+}
+
+/*!
+    \internal
+
+    Returns, for each pattern, whether it matches \a subject. In FindFirst
+    \a mode, stops after the first matching pattern is found.
+*/
+QList<bool> QRegularExpressionSetPrivate::match(QStringView subject, MatchMode mode) const
+{
+    QList<bool> matched(patterns.size(), false);
+    if (!combinedPatterns.isEmpty()) {
+        pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(nullptr);
+        pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, nullptr);
+        pcre2_match_data_16 *matchData = pcre2_match_data_create_16(1, nullptr);
+
+        // see QRegularExpressionPrivate::doMatch()
+        const char16_t dummySubject = 0;
+        const char16_t *subjectUtf16 = subject.utf16() ? subject.utf16() : &dummySubject;
+
+        for (const CombinedPattern &combined : combinedPatterns) {
+            SetCalloutState state = { &matched, combined.indexes.size(), mode == FindFirst };
+            pcre2_set_callout_16(matchContext, &qt_regularexpressionset_callout, &state);
+            const int result = safe_pcre2_match_16(combined.compiled->code,
+                                                   reinterpret_cast<PCRE2_SPTR16>(subjectUtf16),
+                                                   subject.size(), 0, 0,
+                                                   matchData, matchContext);
+
+            if (result <= PCRE2_ERROR_UTF16_ERR1 && result >= PCRE2_ERROR_UTF16_ERR3) {
+                // invalid subject: QRegularExpression would not match either
+                break;
+            }
+            if (result != PCRE2_ERROR_NOMATCH && result != PCRE2_ERROR_CALLOUT) {
+                // e.g. the match limit was hit; what was recorded so far are
+                // genuine matches, try the rest on their own
+                matchSeparately(subject, matched, combined.indexes, mode);
+            }
+            if (mode == FindFirst && matched.contains(true))
+                break;
+        }
+
+        pcre2_match_data_free_16(matchData);
+        pcre2_match_context_free_16(matchContext);
+    }
+    matchSeparately(subject, matched, separatePatterns, mode);
+    return matched;
+}
+
+/*!
+    Constructs an empty QRegularExpressionSet. It is valid and matches
+    nothing.
+*/
+QRegularExpressionSet::QRegularExpressionSet()
+    : d(new QRegularExpressionSetPrivate({}, QRegularExpression::NoPatternOption))
+{
+}
+
+/*!
+    Constructs a QRegularExpressionSet of the given \a patterns, each using
+    the pattern \a options.
+
+    All the patterns are compiled immediately.
+
+    \sa isValid()
+*/
+QRegularExpressionSet::QRegularExpressionSet(const QStringList &patterns,
+                                             QRegularExpression::PatternOptions options)
+    : d(new QRegularExpressionSetPrivate(patterns, options))
+{
+}
+
+/*!
+    Constructs a QRegularExpressionSet as a copy of \a other.
+*/
+QRegularExpressionSet::QRegularExpressionSet(const QRegularExpressionSet &other) noexcept = default;
+
+/*!
+    \fn QRegularExpressionSet::QRegularExpressionSet(QRegularExpressionSet &&other)
+
+    Constructs a QRegularExpressionSet by moving from \a other.
+
+    Note that a moved-from QRegularExpressionSet can only be destroyed or
+    assigned to.
+*/
+
+/*!
+    Destroys the QRegularExpressionSet object.
+*/
+QRegularExpressionSet::~QRegularExpressionSet() = default;
+
+/*!
+    Assigns \a other to this object, and returns a reference to the copy.
+*/
+QRegularExpressionSet &QRegularExpressionSet::operator=(const QRegularExpressionSet &other) noexcept = default;
+
+/*!
+    \fn QRegularExpressionSet &QRegularExpressionSet::operator=(QRegularExpressionSet &&other)
+
+    Move-assigns \a other to this object, and returns a reference to the
+    result.
+*/
+
+/*!
+    \fn void QRegularExpressionSet::swap(QRegularExpressionSet &other)
+    \memberswap{set}
+*/
+
+/*!
+    Returns the patterns of this set.
+*/
+QStringList QRegularExpressionSet::patterns() const
+{
+    return d->patterns;
+}
+
+/*!
+    Returns the pattern options used by all the patterns of this set.
+*/
+QRegularExpression::PatternOptions QRegularExpressionSet::patternOptions() const
+{
+    return d->patternOptions;
+}
+
+/*!
+    Returns the number of patterns in this set.
+
+    \sa isEmpty()
+*/
+qsizetype QRegularExpressionSet::size() const
+{
+    return d->patterns.size();
+}
+
+/*!
+    \fn bool QRegularExpressionSet::isEmpty() const
+
+    Returns \c true if this set has no patterns; otherwise returns \c false.
+
+    \sa size()
+*/
+
+/*!
+    Returns \c true if all the patterns of this set are valid; otherwise
+    returns \c false.
+
+    \sa invalidPatternIndex(), errorString()
+*/
+bool QRegularExpressionSet::isValid() const
+{
+    return d->invalidPatternIndex < 0;
+}
+
+/*!
+    Returns the index of the first invalid pattern of this set, or -1 if all
+    the patterns are valid.
+
+    \sa isValid(), errorString()
+*/
+qsizetype QRegularExpressionSet::invalidPatternIndex() const
+{
+    return d->invalidPatternIndex;
+}
+
+/*!
+    Returns a textual description of the error found in the first invalid
+    pattern of this set, or "no error" if all the patterns are valid.
+
+    \sa isValid(), invalidPatternIndex(), QRegularExpression::errorString()
+*/
+QString QRegularExpressionSet::errorString() const
+{
+    if (d->invalidPatternIndex >= 0)
+        return d->expressions.at(d->invalidPatternIndex).errorString();
+    return QRegularExpression().errorString();
+}
+
+/*!
+    Returns the indexes, in ascending order, of the patterns of this set that
+    match \a subject.
+
+    Calling this function on an invalid set prints a warning and returns an
+    empty list.
+
+    \sa matchesAny(), QRegularExpression::matchView()
+*/
+QList<qsizetype> QRegularExpressionSet::matchingPatterns(QStringView subject) const
+{
+    QList<qsizetype> result;
+    if (Q_UNLIKELY(!isValid())) {
+        qtWarnAboutInvalidRegularExpression(d->patterns.at(d->invalidPatternIndex),
+                                            "QRegularExpressionSet::matchingPatterns");
+        return result;
+    }
+
+    const QList<bool> matched = d->match(subject, QRegularExpressionSetPrivate::FindAll);
+    for (qsizetype i = 0; i < matched.size(); ++i) {
+        if (matched.at(i))
+            result.append(i);
+    }
+    return result;
+}
+
+/*!
+    Returns \c true if at least one of the patterns of this set matches
+    \a subject; otherwise returns \c false. This is faster than checking
+    whether matchingPatterns() is empty, as the matching stops at the first
+    pattern that matches.
+
+    Calling this function on an invalid set prints a warning and returns
+    \c false.
+
+    \sa matchingPatterns()
+*/
+bool QRegularExpressionSet::matchesAny(QStringView subject) const
+{
+    if (Q_UNLIKELY(!isValid())) {
+        qtWarnAboutInvalidRegularExpression(d->patterns.at(d->invalidPatternIndex),
+                                            "QRegularExpressionSet::matchesAny");
+        return false;
+    }
+    return d->match(subject, QRegularExpressionSetPrivate::FindFirst).contains(true);
+}
+
 #ifndef QT_NO_DATASTREAM
 /*!
     \relates QRegularExpression
@@ -397,6 +397,44 @@ private:
 
 Q_DECLARE_SHARED(QRegularExpressionMatchIterator)
 
+struct QRegularExpressionSetPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QRegularExpressionSetPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QRegularExpressionSet
+{
+public:
+    QRegularExpressionSet();
+    explicit QRegularExpressionSet(const QStringList &patterns,
+                                   QRegularExpression::PatternOptions options = QRegularExpression::NoPatternOption);
+    QRegularExpressionSet(const QRegularExpressionSet &other) noexcept;
+    QRegularExpressionSet(QRegularExpressionSet &&other) = default;
+    ~QRegularExpressionSet();
+    QRegularExpressionSet &operator=(const QRegularExpressionSet &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QRegularExpressionSet)
+
+    void swap(QRegularExpressionSet &other) noexcept { d.swap(other.d); }
+
+    QStringList patterns() const;
+    QRegularExpression::PatternOptions patternOptions() const;
+    qsizetype size() const;
+    bool isEmpty() const { return size() == 0; }
+
+    [[nodiscard]]
+    bool isValid() const;
+    qsizetype invalidPatternIndex() const;
+    QString errorString() const;
+
+    [[nodiscard]]
+    QList<qsizetype> matchingPatterns(QStringView subject) const;
+    [[nodiscard]]
+    bool matchesAny(QStringView subject) const;
+
+private:
+    QExplicitlySharedDataPointer<QRegularExpressionSetPrivate> d;
+};
+
+Q_DECLARE_SHARED(QRegularExpressionSet)
+
 QT_END_NAMESPACE
 
 #endif // QREGULAREXPRESSION_H
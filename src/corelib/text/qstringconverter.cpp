@@ -48,7 +48,7 @@ static_assert(std::is_nothrow_move_assignable_v<QStringEncoder>);
 static_assert(std::is_nothrow_move_constructible_v<QStringDecoder>);
 static_assert(std::is_nothrow_move_assignable_v<QStringDecoder>);
 
-enum { Endian = 0, Data = 1 };
+enum { Endian = 0, Data = 1, Surrogate = 2 };
 
 static const uchar utf8bom[] = { 0xef, 0xbb, 0xbf };
 
@@ -1139,17 +1139,318 @@ int QUtf8::compareUtf8(QByteArrayView lhs, QByteArrayView rhs, Qt::CaseSensitivi
 }
 
 #ifndef QT_BOOTSTRAPPED
+// The byte-swapping UTF-16 and UTF-32 converters convert runs of code units
+// with SIMD and stop *at* the first one that needs the scalar code below:
+// unpaired surrogates for UTF-16, and anything outside the BMP for UTF-32.
+// They store whole blocks, so the output buffers must be sized for the worst
+// case.
+static Q_ALWAYS_INLINE bool utf16NeedsSwap(DataEndianness endian) noexcept
+{
+    return (endian == BigEndianness) != (QSysInfo::ByteOrder == QSysInfo::BigEndian);
+}
+
+// Checks the surrogates in a block of \c Units UTF-16 code units, given as
+// masks of the high and low surrogates. \a carry is set if the previous block
+// ended in a high surrogate. Returns the index of the first code unit the
+// scalar code has to look at, which is -1 if the previous block's last code
+// unit is an unpaired high surrogate, or \c Units if the block is valid.
+template <int Units> static Q_ALWAYS_INLINE int
+utf16CheckSurrogates(uint high, uint low, uint &carry) noexcept
+{
+    const uint expectedLow = ((high << 1) | carry) & ((1u << Units) - 1);
+    const uint mismatch = low ^ expectedLow;
+    carry = high >> (Units - 1);
+    if (Q_LIKELY(!mismatch))
+        return Units;
+    // stop at the high surrogate preceding the error, if there is one
+    const int index = qCountTrailingZeroBits(mismatch);
+    return (expectedLow >> index) & 1 ? index - 1 : index;
+}
+
+#if defined(__SSE2__)
+static Q_ALWAYS_INLINE __m128i simdSwap16(__m128i v) noexcept
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static Q_ALWAYS_INLINE __m128i simdSwap32(__m128i v) noexcept
+{
+    v = simdSwap16(v);
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+static Q_ALWAYS_INLINE __m128i simdIsSurrogate(__m128i v) noexcept
+{
+    const __m128i mask = _mm_set1_epi16(short(0xf800));
+    const __m128i surrogate = _mm_set1_epi16(short(0xd800));
+    return _mm_cmpeq_epi16(_mm_and_si128(v, mask), surrogate);
+}
+
+// Copies UTF-16 code units from src to dst, swapping bytes if Swap, until the
+// first unpaired surrogate. CheckOutput selects whether the output (decoding)
+// or the input (encoding) is in host byte order.
+template <bool Swap, bool CheckOutput> static Q_ALWAYS_INLINE void
+simdCopyUtf16(uchar *&dst, const uchar *&src, const uchar *end) noexcept
+{
+    const __m128i surrogateMask = _mm_set1_epi16(short(0xfc00));
+    const __m128i highSurrogate = _mm_set1_epi16(short(0xd800));
+    const __m128i lowSurrogate = _mm_set1_epi16(short(0xdc00));
+    uint carry = 0;
+
+    // do sixteen code units at a time
+    for ( ; end - src >= 32; src += 32, dst += 32) {
+        const __m128i data1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i data2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        const __m128i swapped1 = Swap ? simdSwap16(data1) : data1;
+        const __m128i swapped2 = Swap ? simdSwap16(data2) : data2;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), swapped1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 16), swapped2);
+
+        const __m128i hostOrder1 = CheckOutput ? swapped1 : data1;
+        const __m128i hostOrder2 = CheckOutput ? swapped2 : data2;
+        const __m128i surrogates = _mm_or_si128(simdIsSurrogate(hostOrder1),
+                                                simdIsSurrogate(hostOrder2));
+        if (Q_LIKELY(!carry && !_mm_movemask_epi8(surrogates)))
+            continue;
+
+        // one bit per code unit
+        const __m128i masked1 = _mm_and_si128(hostOrder1, surrogateMask);
+        const __m128i masked2 = _mm_and_si128(hostOrder2, surrogateMask);
+        const uint high = _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(masked1, highSurrogate),
+                                                            _mm_cmpeq_epi16(masked2, highSurrogate)));
+        const uint low = _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(masked1, lowSurrogate),
+                                                           _mm_cmpeq_epi16(masked2, lowSurrogate)));
+        const int offset = utf16CheckSurrogates<16>(high, low, carry);
+        if (offset < 16) {
+            src += 2 * offset;
+            dst += 2 * offset;
+            return;
+        }
+    }
+    // let the scalar code pair the trailing high surrogate
+    src -= 2 * carry;
+    dst -= 2 * carry;
+}
+
+// Widens UTF-16 code units to UTF-32 until the first surrogate.
+template <bool Swap> static Q_ALWAYS_INLINE void
+simdUtf32FromUtf16(uchar *&dst, const char16_t *&src, const char16_t *end) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    for ( ; end - src >= 8; src += 8, dst += 32) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        uint mask = _mm_movemask_epi8(simdIsSurrogate(data));
+        __m128i lo, hi;
+        if (Swap) {
+            // 0x0000XXYY in big endian is 00 00 XX YY
+            const __m128i swapped = simdSwap16(data);
+            lo = _mm_unpacklo_epi16(zero, swapped);
+            hi = _mm_unpackhi_epi16(zero, swapped);
+        } else {
+            lo = _mm_unpacklo_epi16(data, zero);
+            hi = _mm_unpackhi_epi16(data, zero);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 16), hi);
+        if (mask) {
+            const uint offset = qCountTrailingZeroBits(mask) / 2;
+            src += offset;
+            dst += 4 * offset;
+            return;
+        }
+    }
+}
+
+// Narrows UTF-32 code points to UTF-16 until the first one that is not a
+// non-surrogate BMP code point.
+template <bool Swap> static Q_ALWAYS_INLINE void
+simdUtf16FromUtf32(char16_t *&dst, const uchar *&src, const uchar *end) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    for ( ; end - src >= 32; src += 32, dst += 8) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        if (Swap) {
+            lo = simdSwap32(lo);
+            hi = simdSwap32(hi);
+        }
+
+        // SSE2 only has a signed 32-to-16 bit pack, so sign-extend the low
+        // halves first to have them packed unchanged
+        const __m128i units = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                                              _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        const __m128i upper = _mm_packs_epi32(_mm_srli_epi32(lo, 16), _mm_srli_epi32(hi, 16));
+        const __m128i valid = _mm_andnot_si128(simdIsSurrogate(units), _mm_cmpeq_epi16(upper, zero));
+        uint mask = ~_mm_movemask_epi8(valid) & 0xffffu;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), units);
+        if (mask) {
+            const uint offset = qCountTrailingZeroBits(mask) / 2;
+            src += 4 * offset;
+            dst += offset;
+            return;
+        }
+    }
+}
+#elif defined(__ARM_NEON__)
+static inline uint16x8_t simdIsSurrogate(uint16x8_t v) noexcept
+{
+    return vceqq_u16(vandq_u16(v, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800));
+}
+
+// returns whether any element of a comparison result is set; unlike
+// vmaxvq_u16(), this is also available on 32-bit ARM
+static inline bool simdAnySet(uint16x8_t v) noexcept
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(v)), 0) != 0;
+}
+
+// returns the index of the first set element, or 8 if none is set
+static inline uint simdFirstSet(uint16x8_t v) noexcept
+{
+    const uint16x8_t bits = qvsetq_n_u16(1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7);
+    return qCountTrailingZeroBits(uint(vaddvq_u16(vandq_u16(v, bits))) | 0x100u);
+}
+
+template <bool Swap, bool CheckOutput> static inline void
+simdCopyUtf16(uchar *&dst, const uchar *&src, const uchar *end) noexcept
+{
+    const uint16x8_t bits = qvsetq_n_u16(1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7);
+    uint carry = 0;
+    for ( ; end - src >= 16; src += 16, dst += 16) {
+        const uint8x16_t data = vld1q_u8(src);
+        const uint8x16_t swapped = Swap ? vrev16q_u8(data) : data;
+        const uint16x8_t masked = vandq_u16(vreinterpretq_u16_u8(CheckOutput ? swapped : data),
+                                            vdupq_n_u16(0xfc00));
+        vst1q_u8(dst, swapped);
+
+        const uint16x8_t isHigh = vceqq_u16(masked, vdupq_n_u16(0xd800));
+        const uint16x8_t isLow = vceqq_u16(masked, vdupq_n_u16(0xdc00));
+        if (Q_LIKELY(!carry && !simdAnySet(vorrq_u16(isHigh, isLow))))
+            continue;
+
+        const uint high = vaddvq_u16(vandq_u16(isHigh, bits));
+        const uint low = vaddvq_u16(vandq_u16(isLow, bits));
+        const int offset = utf16CheckSurrogates<8>(high, low, carry);
+        if (offset < 8) {
+            src += 2 * offset;
+            dst += 2 * offset;
+            return;
+        }
+    }
+    src -= 2 * carry;
+    dst -= 2 * carry;
+}
+
+template <bool Swap> static inline void
+simdUtf32FromUtf16(uchar *&dst, const char16_t *&src, const char16_t *end) noexcept
+{
+    for ( ; end - src >= 8; src += 8, dst += 32) {
+        const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(src));
+        const uint16x8_t surrogates = simdIsSurrogate(data);
+        uint8x16_t lo = vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(data)));
+        uint8x16_t hi = vreinterpretq_u8_u32(vmovl_u16(vget_high_u16(data)));
+        if (Swap) {
+            lo = vrev32q_u8(lo);
+            hi = vrev32q_u8(hi);
+        }
+        vst1q_u8(dst, lo);
+        vst1q_u8(dst + 16, hi);
+        if (simdAnySet(surrogates)) {
+            const uint offset = simdFirstSet(surrogates);
+            src += offset;
+            dst += 4 * offset;
+            return;
+        }
+    }
+}
+
+template <bool Swap> static inline void
+simdUtf16FromUtf32(char16_t *&dst, const uchar *&src, const uchar *end) noexcept
+{
+    for ( ; end - src >= 32; src += 32, dst += 8) {
+        uint8x16_t lo = vld1q_u8(src);
+        uint8x16_t hi = vld1q_u8(src + 16);
+        if (Swap) {
+            lo = vrev32q_u8(lo);
+            hi = vrev32q_u8(hi);
+        }
+        const uint32x4_t lo32 = vreinterpretq_u32_u8(lo);
+        const uint32x4_t hi32 = vreinterpretq_u32_u8(hi);
+        const uint16x8_t units = vcombine_u16(vmovn_u32(lo32), vmovn_u32(hi32));
+        const uint16x8_t upper = vcombine_u16(vshrn_n_u32(lo32, 16), vshrn_n_u32(hi32, 16));
+        const uint16x8_t invalid = vorrq_u16(vtstq_u16(upper, upper), simdIsSurrogate(units));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dst), units);
+        if (simdAnySet(invalid)) {
+            const uint offset = simdFirstSet(invalid);
+            src += 4 * offset;
+            dst += offset;
+            return;
+        }
+    }
+}
+#else
+template <bool Swap, bool CheckOutput> static inline void
+simdCopyUtf16(uchar *&, const uchar *&, const uchar *) noexcept
+{
+}
+
+template <bool Swap> static inline void
+simdUtf32FromUtf16(uchar *&, const char16_t *&, const char16_t *) noexcept
+{
+}
+
+template <bool Swap> static inline void
+simdUtf16FromUtf32(char16_t *&, const uchar *&, const uchar *) noexcept
+{
+}
+#endif
+
+// Passes the UTF-16 code unit \a c to \a append, pairing surrogates and
+// replacing the unpaired ones. \a pendingHigh is the high surrogate that is
+// still waiting for its low surrogate, or 0.
+static inline char16_t utf16Replacement(const QStringConverter::State *state) noexcept
+{
+    return state->flags & QStringConverter::Flag::ConvertInvalidToNull
+            ? u'\0' : char16_t(QChar::ReplacementCharacter);
+}
+
+template <typename Append> static inline void
+appendValidatedUtf16(char16_t c, char16_t &pendingHigh, QStringConverter::State *state,
+                     Append &&append)
+{
+    const char16_t replacement = utf16Replacement(state);
+    if (pendingHigh) {
+        if (QChar::isLowSurrogate(c)) {
+            append(pendingHigh);
+            append(c);
+            pendingHigh = 0;
+            return;
+        }
+        append(replacement);
+        ++state->invalidChars;
+        pendingHigh = 0;
+    }
+    if (QChar::isHighSurrogate(c)) {
+        pendingHigh = c;
+    } else if (QChar::isLowSurrogate(c)) {
+        append(replacement);
+        ++state->invalidChars;
+    } else {
+        append(c);
+    }
+}
+
 QByteArray QUtf16::convertFromUnicode(QStringView in, QStringConverter::State *state, DataEndianness endian)
 {
     bool writeBom = !(state->internalState & HeaderDone) && state->flags & QStringConverter::Flag::WriteBom;
-    qsizetype length = 2 * in.size();
+    qsizetype length = 2 * (in.size() + state->remainingChars);
     if (writeBom)
         length += 2;
 
     QByteArray d(length, Qt::Uninitialized);
     char *end = convertFromUnicode(d.data(), in, state, endian);
-    Q_ASSERT(end - d.constData() == d.size());
-    Q_UNUSED(end);
+    d.truncate(end - d.constData());
     return d;
 }
 
@@ -1170,19 +1471,53 @@ char *QUtf16::convertFromUnicode(char *out, QStringView in, QStringConverter::St
             qToLittleEndian(bom.unicode(), out);
         out += 2;
     }
-    if (endian == BigEndianness)
-        qToBigEndian<char16_t>(in.data(), in.size(), out);
-    else
-        qToLittleEndian<char16_t>(in.data(), in.size(), out);
+
+    auto append = [&out, endian](char16_t c) {
+        if (endian == BigEndianness)
+            qToBigEndian(c, out);
+        else
+            qToLittleEndian(c, out);
+        out += 2;
+    };
+
+    const bool swap = utf16NeedsSwap(endian);
+    const uchar *src = reinterpret_cast<const uchar *>(in.utf16());
+    const uchar *end = src + 2 * in.size();
+    char16_t pendingHigh = state->remainingChars ? char16_t(state->state_data[Data]) : 0;
+    while (src < end) {
+        if (!pendingHigh) {
+            uchar *dst = reinterpret_cast<uchar *>(out);
+            if (swap)
+                simdCopyUtf16<true, false>(dst, src, end);
+            else
+                simdCopyUtf16<false, false>(dst, src, end);
+            out = reinterpret_cast<char *>(dst);
+            if (src == end)
+                break;
+        }
+        char16_t c;
+        memcpy(&c, src, sizeof(c));
+        src += 2;
+        appendValidatedUtf16(c, pendingHigh, state, append);
+    }
 
     state->remainingChars = 0;
+    if (pendingHigh) {
+        if (state->flags & QStringConverter::Flag::Stateless) {
+            append(utf16Replacement(state));
+            ++state->invalidChars;
+        } else {
+            state->remainingChars = 1;
+            state->state_data[Data] = pendingHigh;
+        }
+    }
     state->internalState |= HeaderDone;
-    return out + 2*in.size();
+    return out;
 }
 
 QString QUtf16::convertToUnicode(QByteArrayView in, QStringConverter::State *state, DataEndianness endian)
 {
-    QString result((in.size() + 1) >> 1, Qt::Uninitialized); // worst case
+    QString result(in.size() / 2 + 2, Qt::Uninitialized); // worst case
     QChar *qch = convertToUnicode(result.data(), in, state, endian);
     result.truncate(qch - result.constData());
     return result;
@@ -1200,23 +1535,30 @@ QChar *QUtf16::convertToUnicode(QChar *out, QByteArrayView in, QStringConverter:
 
     const char *end = chars + len;
 
+    // remainingChars counts the odd byte (1) and the high surrogate waiting
+    // for its pair (2) left over from the previous call
+    qsizetype remainingBytes = state->remainingChars & 1;
+    char16_t pendingHigh = state->remainingChars & 2 ? char16_t(state->state_data[Surrogate]) : 0;
+
     // make sure we can decode at least one char
-    if (state->remainingChars + len < 2) {
+    if (remainingBytes + len < 2) {
         if (len) {
-            Q_ASSERT(state->remainingChars == 0 && len == 1);
-            state->remainingChars = 1;
+            Q_ASSERT(remainingBytes == 0 && len == 1);
+            state->remainingChars |= 1;
             state->state_data[Data] = *chars;
         }
         return out;
     }
 
+    auto append = [&out](char16_t c) { *out++ = QChar(c); };
+
     bool headerdone = state && state->internalState & HeaderDone;
     if (state->flags & QStringConverter::Flag::ConvertInitialBom)
         headerdone = true;
 
-    if (!headerdone || state->remainingChars) {
+    if (!headerdone || remainingBytes) {
         uchar buf;
-        if (state->remainingChars)
+        if (remainingBytes)
             buf = state->state_data[Data];
         else
             buf = *chars++;
@@ -1241,29 +1583,55 @@ QChar *QUtf16::convertToUnicode(QChar *out, QByteArrayView in, QStringConverter:
         if (endian == BigEndianness)
             ch = QChar::fromUcs2((ch.unicode() >> 8) | ((ch.unicode() & 0xff) << 8));
         if (headerdone || ch != QChar::ByteOrderMark)
-            *out++ = ch;
+            appendValidatedUtf16(ch.unicode(), pendingHigh, state, append);
     } else if (endian == DetectEndianness) {
         endian = (QSysInfo::ByteOrder == QSysInfo::BigEndian) ? BigEndianness : LittleEndianness;
     }
 
-    qsizetype nPairs = (end - chars) >> 1;
-    if (endian == BigEndianness)
-        qFromBigEndian<char16_t>(chars, nPairs, out);
-    else
-        qFromLittleEndian<char16_t>(chars, nPairs, out);
-    out += nPairs;
+    const bool swap = utf16NeedsSwap(endian);
+    const uchar *src = reinterpret_cast<const uchar *>(chars);
+    const uchar *srcEnd = src + ((end - chars) & ~qsizetype(1));
+    while (src < srcEnd) {
+        if (!pendingHigh) {
+            uchar *dst = reinterpret_cast<uchar *>(out);
+            if (swap)
+                simdCopyUtf16<true, true>(dst, src, srcEnd);
+            else
+                simdCopyUtf16<false, true>(dst, src, srcEnd);
+            out = reinterpret_cast<QChar *>(dst);
+            if (src == srcEnd)
+                break;
+        }
+        char16_t c = endian == BigEndianness ? qFromBigEndian<char16_t>(src)
+                                             : qFromLittleEndian<char16_t>(src);
+        src += 2;
+        appendValidatedUtf16(c, pendingHigh, state, append);
+    }
+    chars = reinterpret_cast<const char *>(src);
 
     state->state_data[Endian] = endian;
     state->remainingChars = 0;
-    if ((end - chars) & 1) {
-        if (state->flags & QStringConverter::Flag::Stateless) {
-            *out++ = state->flags & QStringConverter::Flag::ConvertInvalidToNull ? QChar::Null : QChar::ReplacementCharacter;
-        } else {
-            state->remainingChars = 1;
-            state->state_data[Data] = *(end - 1);
+    if (state->flags & QStringConverter::Flag::Stateless) {
+        if (pendingHigh) {
+            append(utf16Replacement(state));
+            ++state->invalidChars;
+        }
+        if (chars != end) {
+            append(utf16Replacement(state));
+            ++state->invalidChars;
         }
-    } else {
         state->state_data[Data] = 0;
+    } else {
+        if (pendingHigh) {
+            state->remainingChars = 2;
+            state->state_data[Surrogate] = pendingHigh;
+        }
+        if (chars != end) {
+            state->remainingChars |= 1;
+            state->state_data[Data] = *chars;
+        } else {
+            state->state_data[Data] = 0;
+        }
     }
 
     return out;
@@ -1272,7 +1640,7 @@ QChar *QUtf16::convertToUnicode(QChar *out, QByteArrayView in, QStringConverter:
 QByteArray QUtf32::convertFromUnicode(QStringView in, QStringConverter::State *state, DataEndianness endian)
 {
     bool writeBom = !(state->internalState & HeaderDone) && state->flags & QStringConverter::Flag::WriteBom;
-    qsizetype length =  4*in.size();
+    qsizetype length =  4 * (in.size() + state->remainingChars);
     if (writeBom)
         length += 4;
     QByteArray ba(length, Qt::Uninitialized);
@@ -1306,6 +1674,7 @@ char *QUtf32::convertFromUnicode(char *out, QStringView in, QStringConverter::St
         state->internalState |= HeaderDone;
     }
 
+    const bool swap = utf16NeedsSwap(endian);
     const QChar *uc = in.data();
     const QChar *end = in.data() + in.size();
     QChar ch;
@@ -1320,6 +1689,18 @@ char *QUtf32::convertFromUnicode(char *out, QStringView in, QStringConverter::St
     }
 
     while (uc < end) {
+        {
+            uchar *dst = reinterpret_cast<uchar *>(out);
+            const char16_t *src = reinterpret_cast<const char16_t *>(uc);
+            if (swap)
+                simdUtf32FromUtf16<true>(dst, src, reinterpret_cast<const char16_t *>(end));
+            else
+                simdUtf32FromUtf16<false>(dst, src, reinterpret_cast<const char16_t *>(end));
+            out = reinterpret_cast<char *>(dst);
+            uc = reinterpret_cast<const QChar *>(src);
+            if (uc == end)
+                break;
+        }
         ch = *uc++;
         if (Q_LIKELY(!ch.isSurrogate())) {
             ucs4 = ch.unicode();
@@ -1328,6 +1709,7 @@ decode_surrogate:
             if (uc == end) {
                 if (state->flags & QStringConverter::Flag::Stateless) {
                     ucs4 = state->flags & QStringConverter::Flag::ConvertInvalidToNull ? 0 : QChar::ReplacementCharacter;
+                    ++state->invalidChars;
                 } else {
                     state->remainingChars = 1;
                     state->state_data[Data] = ch.unicode();
@@ -1337,9 +1719,11 @@ decode_surrogate:
                 ucs4 = QChar::surrogateToUcs4(ch, *uc++);
             } else {
                 ucs4 = state->flags & QStringConverter::Flag::ConvertInvalidToNull ? 0 : QChar::ReplacementCharacter;
+                ++state->invalidChars;
             }
         } else {
             ucs4 = state->flags & QStringConverter::Flag::ConvertInvalidToNull ? 0 : QChar::ReplacementCharacter;
+            ++state->invalidChars;
         }
         if (endian == BigEndianness)
             qToBigEndian(ucs4, out);
@@ -1351,6 +1735,20 @@ decode_surrogate:
     return out;
 }
 
+// Appends the UTF-16 representation of the UTF-32 code point \a code,
+// replacing surrogates and values beyond the Unicode range.
+static inline QChar *appendUtf32CodePoint(QChar *out, char32_t code, QStringConverter::State *state)
+{
+    if (Q_UNLIKELY(code > QChar::LastValidCodePoint || QChar::isSurrogate(code))) {
+        *out++ = QChar(utf16Replacement(state));
+        ++state->invalidChars;
+        return out;
+    }
+    for (char16_t c : QChar::fromUcs4(code))
+        *out++ = c;
+    return out;
+}
+
 QString QUtf32::convertToUnicode(QByteArrayView in, QStringConverter::State *state, DataEndianness endian)
 {
     QString result;
@@ -1411,14 +1809,8 @@ QChar *QUtf32::convertToUnicode(QChar *out, QByteArrayView in, QStringConverter:
             }
         }
         char32_t code = (endian == BigEndianness) ? qFromBigEndian<char32_t>(tuple) : qFromLittleEndian<char32_t>(tuple);
-        if (headerdone || code != QChar::ByteOrderMark) {
-            if (QChar::requiresSurrogates(code)) {
-                *out++ = QChar(QChar::highSurrogate(code));
-                *out++ = QChar(QChar::lowSurrogate(code));
-            } else {
-                *out++ = QChar(code);
-            }
-        }
+        if (headerdone || code != QChar::ByteOrderMark)
+            out = appendUtf32CodePoint(out, code, state);
         num = 0;
     } else if (endian == DetectEndianness) {
         endian = (QSysInfo::ByteOrder == QSysInfo::BigEndian) ? BigEndianness : LittleEndianness;
@@ -1426,19 +1818,30 @@ QChar *QUtf32::convertToUnicode(QChar *out, QByteArrayView in, QStringConverter:
     state->state_data[Endian] = endian;
     state->internalState |= HeaderDone;
 
-    while (chars < end) {
-        tuple[num++] = *chars++;
-        if (num == 4) {
-            char32_t code = (endian == BigEndianness) ? qFromBigEndian<char32_t>(tuple) : qFromLittleEndian<char32_t>(tuple);
-            for (char16_t c : QChar::fromUcs4(code))
-                *out++ = c;
-            num = 0;
-        }
+    const bool swap = utf16NeedsSwap(endian);
+    const uchar *src = reinterpret_cast<const uchar *>(chars);
+    const uchar *srcEnd = reinterpret_cast<const uchar *>(end);
+    while (srcEnd - src >= 4) {
+        char16_t *dst = reinterpret_cast<char16_t *>(out);
+        if (swap)
+            simdUtf16FromUtf32<true>(dst, src, srcEnd);
+        else
+            simdUtf16FromUtf32<false>(dst, src, srcEnd);
+        out = reinterpret_cast<QChar *>(dst);
+        if (srcEnd - src < 4)
+            break;
+        char32_t code = (endian == BigEndianness) ? qFromBigEndian<char32_t>(src) : qFromLittleEndian<char32_t>(src);
+        src += 4;
+        out = appendUtf32CodePoint(out, code, state);
     }
+    chars = reinterpret_cast<const char *>(src);
+    while (chars < end)
+        tuple[num++] = *chars++;
 
     if (num) {
         if (state->flags & QStringDecoder::Flag::Stateless) {
             *out++ = QChar::ReplacementCharacter;
+            ++state->invalidChars;
         } else {
             state->state_data[Endian] = endian;
             state->remainingChars = num;
@@ -2796,6 +3199,24 @@ const char *QStringConverter::nameForEncoding(QStringConverter::Encoding e)
     \sa requiredSpace()
 */
 
+/*!
+    \fn QByteArray &QStringEncoder::appendToBuffer(QByteArray &out, QStringView in)
+    \since 6.10
+    \overload
+
+    Encodes \a in and appends the encoded result to \a out. Returns a
+    reference to \a out.
+
+    The data is encoded directly into \a out, without a temporary QByteArray.
+    \a out only needs to be reallocated if its capacity is not large enough
+    for requiredSpace() more bytes, so a buffer that is reused for many
+    pieces of text quickly stops allocating memory:
+
+    \snippet code/src_corelib_text_qstringconverter.cpp 7
+
+    \sa requiredSpace(), QByteArray::reserve()
+*/
+
 /*!
     \class QStringDecoder
     \inmodule QtCore
@@ -2898,4 +3319,22 @@ const char *QStringConverter::nameForEncoding(QStringConverter::Encoding e)
     \overload
 */
 
+/*!
+    \fn QString &QStringDecoder::appendToBuffer(QString &out, QByteArrayView in)
+    \since 6.10
+    \overload
+
+    Decodes the sequence of bytes viewed by \a in and appends the decoded
+    result to \a out. Returns a reference to \a out.
+
+    The data is decoded directly into \a out, without a temporary QString.
+    \a out only needs to be reallocated if its capacity is not large enough
+    for requiredSpace() more code units, so a buffer that is reused for many
+    chunks of data quickly stops allocating memory:
+
+    \snippet code/src_corelib_text_qstringconverter.cpp 6
+
+    \sa requiredSpace(), QString::reserve()
+*/
+
 QT_END_NAMESPACE
@@ -63,6 +63,14 @@ public:
         }
         return iface->fromUtf16(out, in, &state);
     }
+    QByteArray &appendToBuffer(QByteArray &out, QStringView in)
+    {
+        const qsizetype size = out.size();
+        out.resize(size + requiredSpace(in.size()));
+        char *end = appendToBuffer(out.data() + size, in);
+        out.truncate(end - out.constData());
+        return out;
+    }
 private:
     QByteArray encodeAsByteArray(QStringView in)
     {
@@ -127,6 +135,14 @@ public:
     }
     char16_t *appendToBuffer(char16_t *out, QByteArrayView ba)
     { return reinterpret_cast<char16_t *>(appendToBuffer(reinterpret_cast<QChar *>(out), ba)); }
+    QString &appendToBuffer(QString &out, QByteArrayView ba)
+    {
+        const qsizetype size = out.size();
+        out.resize(size + requiredSpace(ba.size()));
+        QChar *end = appendToBuffer(out.data() + size, ba);
+        out.truncate(end - out.constData());
+        return out;
+    }
 
     Q_CORE_EXPORT static QStringDecoder decoderForHtml(QByteArrayView data);
 
@@ -178,23 +194,13 @@ struct QConcatenable<QStringEncoder::DecodedData<T>>
 template <typename T>
 QString &operator+=(QString &a, const QStringDecoder::EncodedData<T> &b)
 {
-    qsizetype len = a.size() + QConcatenable<QStringDecoder::EncodedData<T>>::size(b);
-    a.reserve(len);
-    QChar *it = a.data() + a.size();
-    QConcatenable<QStringDecoder::EncodedData<T>>::appendTo(b, it);
-    a.resize(qsizetype(it - a.constData())); //may be smaller than len
-    return a;
+    return b.decoder->appendToBuffer(a, b.data);
 }
 
 template <typename T>
 QByteArray &operator+=(QByteArray &a, const QStringEncoder::DecodedData<T> &b)
 {
-    qsizetype len = a.size() + QConcatenable<QStringEncoder::DecodedData<T>>::size(b);
-    a.reserve(len);
-    char *it = a.data() + a.size();
-    QConcatenable<QStringEncoder::DecodedData<T>>::appendTo(b, it);
-    a.resize(qsizetype(it - a.constData())); //may be smaller than len
-    return a;
+    return b.encoder->appendToBuffer(a, b.data);
 }
 #endif
 
@@ -37,6 +37,47 @@ void QPostEventList::addEvent(const QPostEvent &ev)
     }
 }
 
+/*!
+    \internal
+
+    Moves the events posted without locking the mutex into the list, in the
+    order in which they were posted. The mutex must be locked.
+*/
+void QPostEventList::takeIncoming()
+{
+    QAbstractMetaCallEvent *ev = incoming.exchange(nullptr, std::memory_order_acquire);
+    if (!ev)
+        return;
+
+    // the stack has the most recent event on top
+    QAbstractMetaCallEvent *reversed = nullptr;
+    while (ev) {
+        QAbstractMetaCallEvent *next = ev->nextIncoming_;
+        ev->nextIncoming_ = reversed;
+        reversed = ev;
+        ev = next;
+    }
+    while (reversed) {
+        QAbstractMetaCallEvent *current = reversed;
+        reversed = reversed->nextIncoming_;
+        current->nextIncoming_ = nullptr;
+        addEvent(QPostEvent(current->incomingReceiver_, current, current->incomingPriority_));
+    }
+}
+
+/*!
+    \internal
+
+    Waits until no thread is about to push onto the incoming stack with an
+    outdated idea of which thread a receiver lives in; see
+    QObject::moveToThread().
+*/
+void QPostEventList::waitForIncomingProducers() const noexcept
+{
+    while (incomingProducers.load(std::memory_order_acquire))
+        QThread::yieldCurrentThread();
+}
+
 
 /*
   QThreadData
@@ -65,6 +106,7 @@ QThreadData::~QThreadData()
     thread.storeRelease(nullptr);
     delete t;
 
+    postEventList.takeIncoming();
     for (qsizetype i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
@@ -73,10 +73,31 @@ public:
 
     QMutex mutex;
 
+    // Events posted without locking the mutex, most recent first; see
+    // QCoreApplication::postEvent(). They must be moved into the list with
+    // takeIncoming() whenever the mutex is locked to look at the list.
+    std::atomic<QAbstractMetaCallEvent *> incoming = nullptr;
+    // number of threads that are about to push onto incoming
+    std::atomic<int> incomingProducers = 0;
+
     inline QPostEventList() : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0) { }
 
     void addEvent(const QPostEvent &ev);
 
+    void pushIncoming(QObject *receiver, QAbstractMetaCallEvent *ev, int priority) noexcept
+    {
+        ev->incomingReceiver_ = receiver;
+        ev->incomingPriority_ = priority;
+        QAbstractMetaCallEvent *next = incoming.load(std::memory_order_relaxed);
+        do {
+            ev->nextIncoming_ = next;
+        } while (!incoming.compare_exchange_weak(next, ev, std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    }
+    bool hasIncoming() const noexcept { return incoming.load(std::memory_order_relaxed); }
+    void takeIncoming();
+    void waitForIncomingProducers() const noexcept;
+
 private:
     //hides because they do not keep that list sorted. addEvent must be used
     using QList<QPostEvent>::append;
@@ -348,7 +369,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && !postEventList.hasIncoming();
     }
 
     QStack<QEventLoop *> eventLoops;
@@ -366,6 +387,8 @@ public:
     int scopeLevel = 0;
 
     bool quitNow = false;
+    // not cleared by events posted without locking; event dispatchers must
+    // use canWaitLocked()
     bool canWait = true;
     bool isAdopted = false;
     bool requiresCoreApplication = true;
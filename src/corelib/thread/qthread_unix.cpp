@@ -16,6 +16,12 @@
 #  include <private/qeventdispatcher_wasm_p.h>
 #else
 #  include <private/qeventdispatcher_unix_p.h>
+#  if QT_CONFIG(epoll)
+#    include <private/qeventdispatcher_epoll_p.h>
+#  endif
+#  if QT_CONFIG(io_uring)
+#    include <private/qeventdispatcher_io_uring_p.h>
+#  endif
 #  if defined(Q_OS_DARWIN)
 #    include <private/qeventdispatcher_cf_p.h>
 #  elif !defined(QT_NO_GLIB)
@@ -287,7 +293,20 @@ QAbstractEventDispatcher *QThreadPrivate::createEventDispatcher(QThreadData *dat
         return new QEventDispatcherUNIX;
 #elif defined(Q_OS_WASM)
     return new QEventDispatcherWasm();
-#elif !defined(QT_NO_GLIB)
+#else
+#  if QT_CONFIG(io_uring)
+    if (qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_IO_URING") > 0
+        && QEventDispatcherIoUring::isSupported()) {
+        return new QEventDispatcherIoUring;
+    }
+#  endif
+#  if QT_CONFIG(epoll)
+    if (qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_EPOLL") > 0
+        && QEventDispatcherEpoll::isSupported()) {
+        return new QEventDispatcherEpoll;
+    }
+#  endif
+#  if !defined(QT_NO_GLIB)
     const bool isQtMainThread = data->thread.loadAcquire() == QCoreApplicationPrivate::mainThread();
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB")
         && (isQtMainThread || qEnvironmentVariableIsEmpty("QT_NO_THREADED_GLIB"))
@@ -295,8 +314,9 @@ QAbstractEventDispatcher *QThreadPrivate::createEventDispatcher(QThreadData *dat
         return new QEventDispatcherGlib;
     else
         return new QEventDispatcherUNIX;
-#else
+#  else
     return new QEventDispatcherUNIX;
+#  endif
 #endif
 }
 
@@ -17,6 +17,82 @@ QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
 
+/*
+    Runnables started by a pool thread in work stealing mode. The owning thread
+    pushes and pops at the back, so it continues with what it started last and
+    whose data is most likely still in its cache. Other threads steal from the
+    front, where the oldest and usually largest pieces of work are.
+
+    Only the owner ever pushes, so it can rely on isEmpty() without locking.
+*/
+class QThreadPoolLocalQueue
+{
+public:
+    // returns true if the queue was empty before
+    bool push(QRunnable *runnable)
+    {
+        QMutexLocker locker(&mutex);
+        runnables.append(runnable);
+        updateSize();
+        return runnables.size() == 1;
+    }
+
+    QRunnable *pop()
+    {
+        if (isEmpty())
+            return nullptr;
+        QMutexLocker locker(&mutex);
+        if (runnables.isEmpty())
+            return nullptr;
+        QRunnable *runnable = runnables.takeLast();
+        updateSize();
+        return runnable;
+    }
+
+    QRunnable *steal(bool *more)
+    {
+        if (isEmpty())
+            return nullptr;
+        QMutexLocker locker(&mutex);
+        if (runnables.isEmpty())
+            return nullptr;
+        QRunnable *runnable = runnables.takeFirst();
+        updateSize();
+        *more = !runnables.isEmpty();
+        return runnable;
+    }
+
+    bool tryTake(QRunnable *runnable)
+    {
+        if (isEmpty())
+            return false;
+        QMutexLocker locker(&mutex);
+        if (!runnables.removeOne(runnable))
+            return false;
+        updateSize();
+        return true;
+    }
+
+    QList<QRunnable *> takeAll()
+    {
+        if (isEmpty())
+            return {};
+        QMutexLocker locker(&mutex);
+        QList<QRunnable *> result = std::exchange(runnables, {});
+        updateSize();
+        return result;
+    }
+
+    bool isEmpty() const { return size.load(std::memory_order_relaxed) == 0; }
+
+private:
+    void updateSize() { size.store(runnables.size(), std::memory_order_relaxed); }
+
+    QMutex mutex;
+    QList<QRunnable *> runnables;
+    std::atomic<qsizetype> size = 0;
+};
+
 /*
     QThread wrapper, provides synchronization against a ThreadPool
 */
@@ -31,8 +107,11 @@ public:
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    QThreadPoolLocalQueue localQueue;
 };
 
+Q_CONSTINIT static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
 /*
     QThreadPool private class.
 */
@@ -52,6 +131,7 @@ QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
 */
 void QThreadPoolThread::run()
 {
+    currentPoolThread = this;
     QMutexLocker locker(&manager->mutex);
     for(;;) {
         QRunnable *r = runnable;
@@ -59,45 +139,50 @@ void QThreadPoolThread::run()
 
         do {
             if (r) {
-                // If autoDelete() is false, r might already be deleted after run(), so check status now.
-                const bool del = r->autoDelete();
-
-                // run the task
                 locker.unlock();
+                do {
+                    // If autoDelete() is false, r might already be deleted after run(), so check status now.
+                    const bool del = r->autoDelete();
+
+                    // run the task
 #ifndef QT_NO_EXCEPTIONS
-                try {
+                    try {
 #endif
-                    r->run();
+                        r->run();
 #ifndef QT_NO_EXCEPTIONS
-                } catch (...) {
-                    qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
-                             "This is not supported, exceptions thrown in worker threads must be\n"
-                             "caught before control returns to Qt Concurrent.");
-                    registerThreadInactive();
-                    throw;
-                }
+                    } catch (...) {
+                        qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
+                                 "This is not supported, exceptions thrown in worker threads must be\n"
+                                 "caught before control returns to Qt Concurrent.");
+                        registerThreadInactive();
+                        throw;
+                    }
 #endif
 
-                if (del)
-                    delete r;
+                    if (del)
+                        delete r;
+
+                    // continue with the runnables this thread started itself,
+                    // unless there is something more urgent in the queue
+                    r = manager->highPriorityQueued.load(std::memory_order_relaxed)
+                            ? nullptr : localQueue.pop();
+                } while (r);
                 locker.relock();
             }
 
-            // if too many threads are active, stop working in this one
-            if (manager->tooManyThreadsActive())
+            // if too many threads are active, stop working in this one and
+            // leave what it started itself to the others
+            if (manager->tooManyThreadsActive()) {
+                const QList<QRunnable *> started = localQueue.takeAll();
+                for (QRunnable *startedRunnable : started)
+                    manager->enqueueTask(startedRunnable);
                 break;
+            }
 
             // all work is done, time to wait for more
-            if (manager->queue.isEmpty())
+            r = manager->takeQueuedRunnable(this);
+            if (!r)
                 break;
-
-            QueuePage *page = manager->queue.constFirst();
-            r = page->pop();
-
-            if (page->isFinished()) {
-                manager->queue.removeFirst();
-                delete page;
-            }
         } while (true);
 
         // this thread is about to be deleted, do not wait or expire
@@ -142,9 +227,14 @@ void QThreadPoolThread::registerThreadInactive()
 QThreadPoolPrivate:: QThreadPoolPrivate()
 { }
 
+/*
+    \internal
+
+    If \a task is \nullptr, the thread that is woken up or started looks for
+    work in the queue and in the local queues of the other threads.
+*/
 bool QThreadPoolPrivate::tryStart(QRunnable *task)
 {
-    Q_ASSERT(task != nullptr);
     if (allThreads.isEmpty()) {
         // always create at least one thread
         startThread(task);
@@ -157,7 +247,8 @@ bool QThreadPoolPrivate::tryStart(QRunnable *task)
 
     if (!waitingThreads.isEmpty()) {
         // recycle an available thread
-        enqueueTask(task);
+        if (task)
+            enqueueTask(task);
         waitingThreads.takeFirst()->runnableReady.wakeOne();
         return true;
     }
@@ -195,11 +286,13 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     for (QueuePage *page : std::as_const(queue)) {
         if (page->priority() == priority && !page->isFull()) {
             page->push(runnable);
+            updateQueueHints();
             return;
         }
     }
     auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
+    updateQueueHints();
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -225,6 +318,115 @@ void QThreadPoolPrivate::tryToStartMoreThreads()
             delete page;
         }
     }
+    updateQueueHints();
+}
+
+/*!
+    \internal
+
+    Keeps the hints that pool threads check without holding the mutex up to
+    date. Must be called whenever the queue changes.
+*/
+void QThreadPoolPrivate::updateQueueHints()
+{
+    highPriorityQueued.store(!queue.isEmpty() && queue.constFirst()->priority() > 0,
+                             std::memory_order_relaxed);
+}
+
+/*!
+    \internal
+
+    Returns the next runnable for \a thread to run, or \nullptr if there is
+    none. Queued runnables with a priority above the default one come first,
+    followed by those \a thread started itself in work stealing mode, the rest
+    of the queue, and finally runnables stolen from other threads.
+*/
+QRunnable *QThreadPoolPrivate::takeQueuedRunnable(QThreadPoolThread *thread)
+{
+    const auto popQueue = [this] {
+        QueuePage *page = queue.constFirst();
+        QRunnable *runnable = page->pop();
+        if (page->isFinished()) {
+            queue.removeFirst();
+            delete page;
+        }
+        updateQueueHints();
+        return runnable;
+    };
+
+    if (!queue.isEmpty() && queue.constFirst()->priority() > 0)
+        return popQueue();
+    if (QRunnable *runnable = thread->localQueue.pop())
+        return runnable;
+    if (!queue.isEmpty())
+        return popQueue();
+    if (workStealing.load(std::memory_order_relaxed))
+        return stealRunnable(thread);
+    return nullptr;
+}
+
+/*!
+    \internal
+
+    Takes the oldest runnable from the local queue of another thread than
+    \a thief. If that leaves more behind, another thread is woken up to steal
+    as well, so that work started from one thread spreads over the pool.
+*/
+QRunnable *QThreadPoolPrivate::stealRunnable(QThreadPoolThread *thief)
+{
+    for (QThreadPoolThread *victim : std::as_const(allThreads)) {
+        if (victim == thief)
+            continue;
+        bool more = false;
+        if (QRunnable *runnable = victim->localQueue.steal(&more)) {
+            if (more)
+                tryStart(nullptr);
+            return runnable;
+        }
+    }
+    return nullptr;
+}
+
+/*!
+    \internal
+
+    Returns the calling thread if work stealing is enabled and the thread
+    belongs to this pool, so that it can keep the runnables it starts in its
+    local queue. Otherwise returns \nullptr.
+*/
+QThreadPoolThread *QThreadPoolPrivate::localQueueOwner() const
+{
+    if (!workStealing.load(std::memory_order_relaxed))
+        return nullptr;
+
+    QThreadPoolThread *thread = currentPoolThread;
+    if (!thread || thread->manager != this)
+        return nullptr;
+    return thread;
+}
+
+/*!
+    \internal
+
+    In work stealing mode, puts \a runnable into the local queue of the
+    calling thread if it belongs to this pool, and returns \c true. Otherwise
+    returns \c false and the caller needs to queue \a runnable as usual.
+
+    The mutex is only locked to find a thread for stealing when the local
+    queue was empty, so starting many runnables from one runnable does not
+    contend with the other threads of the pool.
+*/
+bool QThreadPoolPrivate::startLocally(QRunnable *runnable)
+{
+    QThreadPoolThread *thread = localQueueOwner();
+    if (!thread)
+        return false;
+
+    if (thread->localQueue.push(runnable)) {
+        QMutexLocker locker(&mutex);
+        tryStart(nullptr);
+    }
+    return true;
 }
 
 bool QThreadPoolPrivate::areAllThreadsActive() const
@@ -244,7 +446,6 @@ bool QThreadPoolPrivate::tooManyThreadsActive() const
 */
 void QThreadPoolPrivate::startThread(QRunnable *runnable)
 {
-    Q_ASSERT(runnable != nullptr);
     auto thread = std::make_unique<QThreadPoolThread>(this);
     if (objectName.isEmpty())
         objectName = u"Thread (pooled)"_s;
@@ -321,6 +522,16 @@ void QThreadPoolPrivate::clear()
         }
         delete page;
     }
+    updateQueueHints();
+
+    QList<QRunnable *> started;
+    for (QThreadPoolThread *thread : std::as_const(allThreads))
+        started += thread->localQueue.takeAll();
+    locker.unlock();
+    for (QRunnable *r : std::as_const(started)) {
+        if (r->autoDelete())
+            delete r;
+    }
 }
 
 /*!
@@ -354,10 +565,16 @@ bool QThreadPool::tryTake(QRunnable *runnable)
                 d->queue.removeOne(page);
                 delete page;
             }
+            d->updateQueueHints();
             return true;
         }
     }
 
+    for (QThreadPoolThread *thread : std::as_const(d->allThreads)) {
+        if (thread->localQueue.tryTake(runnable))
+            return true;
+    }
+
     return false;
 }
 
@@ -488,6 +705,8 @@ QThreadPool *QThreadPool::globalInstance()
     ownership of \a runnable remains with the caller. Note that
     changing the auto-deletion on \a runnable after calling this
     functions results in undefined behavior.
+
+    \sa setWorkStealingEnabled()
 */
 void QThreadPool::start(QRunnable *runnable, int priority)
 {
@@ -495,6 +714,9 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         return;
 
     Q_D(QThreadPool);
+    if (priority == 0 && d->startLocally(runnable))
+        return;
+
     QMutexLocker locker(&d->mutex);
 
     if (!d->tryStart(runnable))
@@ -541,6 +763,14 @@ bool QThreadPool::tryStart(QRunnable *runnable)
 
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
+    if (QThreadPoolThread *thread = d->localQueueOwner()) {
+        // Keep the runnable local like start() does, but only if there is a
+        // thread free to steal it: tryStart() must not queue.
+        if (d->areAllThreadsActive())
+            return false;
+        thread->localQueue.push(runnable);
+        return d->tryStart(nullptr);
+    }
     if (d->tryStart(runnable))
         return true;
 
@@ -775,6 +1005,52 @@ QThread::QualityOfService QThreadPool::serviceLevel() const
     return d->serviceLevel;
 }
 
+/*!
+    \since 6.10
+
+    Enables work stealing if \a enabled is \c true, and disables it otherwise.
+    Work stealing is disabled by default.
+
+    With work stealing, a runnable that one of the pool's threads starts with
+    the default priority of 0 is not added to the run queue shared by all
+    threads. Instead, the thread keeps it in a queue of its own and runs it,
+    most recently started first, once the current runnable returns. Threads
+    that run out of work take the oldest runnables from the others. This
+    avoids contention on the pool's internal lock when runnables start many
+    small runnables, for example in recursive divide-and-conquer algorithms,
+    and tends to run a runnable on the CPU whose cache holds the data it was
+    given.
+
+    tryStart() called from one of the pool's threads uses the local queue as
+    well, but it still only succeeds if a thread of the pool is free to take
+    the runnable; that thread or the calling one runs it, whichever gets to
+    it first.
+
+    Queued runnables with a priority greater than 0 still run first.
+    Runnables started from threads that do not belong to the pool, and
+    startOnReservedThread(), are not affected.
+
+    \sa isWorkStealingEnabled(), start(), tryStart()
+*/
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    d->workStealing.store(enabled, std::memory_order_relaxed);
+}
+
+/*!
+    \since 6.10
+
+    Returns \c true if work stealing is enabled.
+
+    \sa setWorkStealingEnabled()
+*/
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.load(std::memory_order_relaxed);
+}
+
 /*!
     Releases a thread previously reserved with reserveThread() and uses it
     to run \a runnable.
@@ -75,6 +75,9 @@ public:
     void setServiceLevel(QThread::QualityOfService serviceLevel);
     QThread::QualityOfService serviceLevel() const;
 
+    void setWorkStealingEnabled(bool enabled);
+    bool isWorkStealingEnabled() const;
+
     QT_CORE_INLINE_SINCE(6, 8)
     bool waitForDone(int msecs);
     bool waitForDone(QDeadlineTimer deadline = QDeadlineTimer::Forever);
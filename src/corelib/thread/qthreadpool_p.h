@@ -24,6 +24,8 @@
 #include "QtCore/qqueue.h"
 #include "private/qobject_p.h"
 
+#include <atomic>
+
 QT_REQUIRE_CONFIG(thread);
 
 QT_BEGIN_NAMESPACE
@@ -133,6 +135,12 @@ public:
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
 
+    QThreadPoolThread *localQueueOwner() const;
+    bool startLocally(QRunnable *runnable);
+    QRunnable *takeQueuedRunnable(QThreadPoolThread *thread);
+    QRunnable *stealRunnable(QThreadPoolThread *thief);
+    void updateQueueHints();
+
     mutable QMutex mutex;
     QSet<QThreadPoolThread *> allThreads;
     QQueue<QThreadPoolThread *> waitingThreads;
@@ -148,6 +156,10 @@ public:
     uint stackSize = 0;
     QThread::Priority threadPriority = QThread::InheritPriority;
     QThread::QualityOfService serviceLevel = QThread::QualityOfService::Auto;
+
+    // Work stealing mode. These can be read without holding the mutex.
+    std::atomic<bool> workStealing = false;
+    std::atomic<bool> highPriorityQueued = false;
 };
 
 QT_END_NAMESPACE
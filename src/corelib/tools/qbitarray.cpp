@@ -7,6 +7,7 @@
 #include <qdatastream.h>
 #include <qdebug.h>
 #include <qendian.h>
+#include <private/qsimd_p.h>
 
 #include <limits>
 
@@ -132,6 +133,190 @@ static void adjust_head_and_tail(char *data, qsizetype storageSize, qsizetype lo
         *(c + 1 + logicalSize / 8) &= (1 << (logicalSize & 7)) - 1;
 }
 
+/*
+    Bulk kernels
+
+    The bits are stored densely from d.data()[1] on, so whole-array
+    operations can work on machine words and SIMD registers rather than on
+    single bytes. The bits past size() in the last byte are always zero
+    (see adjust_head_and_tail()), which the functions below rely on.
+*/
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(AVX2)
+#  define QBITARRAY_AVX2
+#endif
+
+static inline quint64 wordOp(std::bit_and<>, quint64 a, quint64 b) { return a & b; }
+static inline quint64 wordOp(std::bit_or<>, quint64 a, quint64 b) { return a | b; }
+static inline quint64 wordOp(std::bit_xor<>, quint64 a, quint64 b) { return a ^ b; }
+
+#if defined(__SSE2__)
+static inline __m128i simdOp(std::bit_and<>, __m128i a, __m128i b) { return _mm_and_si128(a, b); }
+static inline __m128i simdOp(std::bit_or<>, __m128i a, __m128i b) { return _mm_or_si128(a, b); }
+static inline __m128i simdOp(std::bit_xor<>, __m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+#elif defined(__ARM_NEON__)
+static inline uint8x16_t simdOp(std::bit_and<>, uint8x16_t a, uint8x16_t b) { return vandq_u8(a, b); }
+static inline uint8x16_t simdOp(std::bit_or<>, uint8x16_t a, uint8x16_t b) { return vorrq_u8(a, b); }
+static inline uint8x16_t simdOp(std::bit_xor<>, uint8x16_t a, uint8x16_t b) { return veorq_u8(a, b); }
+#endif
+
+#ifdef QBITARRAY_AVX2
+static inline QT_FUNCTION_TARGET(AVX2) __m256i simdOp(std::bit_and<>, __m256i a, __m256i b)
+{ return _mm256_and_si256(a, b); }
+static inline QT_FUNCTION_TARGET(AVX2) __m256i simdOp(std::bit_or<>, __m256i a, __m256i b)
+{ return _mm256_or_si256(a, b); }
+static inline QT_FUNCTION_TARGET(AVX2) __m256i simdOp(std::bit_xor<>, __m256i a, __m256i b)
+{ return _mm256_xor_si256(a, b); }
+
+// Returns the number of bytes processed, a multiple of 32.
+template <typename BitwiseOp> static QT_FUNCTION_TARGET(AVX2)
+qsizetype bitwiseOperationAvx2(uchar *dst, const uchar *p1, const uchar *p2, qsizetype n,
+                               BitwiseOp op)
+{
+    qsizetype i = 0;
+    for ( ; i + 64 <= n; i += 64) {
+        __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p1 + i));
+        __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p1 + i + 32));
+        __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p2 + i));
+        __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p2 + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), simdOp(op, a0, b0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), simdOp(op, a1, b1));
+    }
+    for ( ; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p1 + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p2 + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), simdOp(op, a, b));
+    }
+    return i;
+}
+#endif
+
+// Stores op(p1[i], p2[i]) in dst[i] for the n bytes. dst may be p1, but must
+// not overlap the sources otherwise.
+template <typename BitwiseOp> static
+void bitwiseOperation(uchar *dst, const uchar *p1, const uchar *p2, qsizetype n, BitwiseOp op)
+{
+    qsizetype i = 0;
+#ifdef QBITARRAY_AVX2
+    if (n >= 64 && qCpuHasFeature(AVX2))
+        i = bitwiseOperationAvx2(dst, p1, p2, n, op);
+#endif
+#if defined(__SSE2__)
+    for ( ; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p1 + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p2 + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), simdOp(op, a, b));
+    }
+#elif defined(__ARM_NEON__)
+    for ( ; i + 16 <= n; i += 16)
+        vst1q_u8(dst + i, simdOp(op, vld1q_u8(p1 + i), vld1q_u8(p2 + i)));
+#endif
+    for ( ; i + 8 <= n; i += 8) {
+        quint64 v = wordOp(op, qFromUnaligned<quint64>(p1 + i), qFromUnaligned<quint64>(p2 + i));
+        qToUnaligned(v, dst + i);
+    }
+    for ( ; i < n; ++i)
+        dst[i] = uchar(op(p1[i], p2[i]));
+}
+
+// Stores ~src[i] in dst[i] for the n bytes; dst may be src.
+static void invertBytes(uchar *dst, const uchar *src, qsizetype n)
+{
+    qsizetype i = 0;
+#if defined(__SSE2__)
+    const __m128i ones = _mm_set1_epi32(-1);
+    for ( ; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(v, ones));
+    }
+#elif defined(__ARM_NEON__)
+    for ( ; i + 16 <= n; i += 16)
+        vst1q_u8(dst + i, vmvnq_u8(vld1q_u8(src + i)));
+#endif
+    for ( ; i + 8 <= n; i += 8)
+        qToUnaligned(quint64(~qFromUnaligned<quint64>(src + i)), dst + i);
+    for ( ; i < n; ++i)
+        dst[i] = uchar(~src[i]);
+}
+
+// Four independent accumulators let the CPU overlap the popcounts.
+Q_ALWAYS_INLINE static qsizetype populationCountWords(const uchar *p, qsizetype n)
+{
+    qsizetype c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    qsizetype i = 0;
+    for ( ; i + 32 <= n; i += 32) {
+        c0 += qPopulationCount(qFromUnaligned<quint64>(p + i));
+        c1 += qPopulationCount(qFromUnaligned<quint64>(p + i + 8));
+        c2 += qPopulationCount(qFromUnaligned<quint64>(p + i + 16));
+        c3 += qPopulationCount(qFromUnaligned<quint64>(p + i + 24));
+    }
+    for ( ; i + 8 <= n; i += 8)
+        c0 += qPopulationCount(qFromUnaligned<quint64>(p + i));
+    for ( ; i < n; ++i)
+        c1 += qPopulationCount(p[i]);
+    return c0 + c1 + c2 + c3;
+}
+
+#ifdef QBITARRAY_AVX2
+// Counts the bits with a nibble lookup table (Mula, Kurz and Lemire, "Faster
+// Population Counts Using AVX2 Instructions"), which beats POPCNT on long
+// arrays. The byte counters are folded into 64-bit sums every 31 vectors,
+// before they can overflow.
+static QT_FUNCTION_TARGET(ARCH_HASWELL) qsizetype populationCountAvx2(const uchar *p, qsizetype n)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    qsizetype i = 0;
+    while (i + 32 <= n) {
+        __m256i bytes = _mm256_setzero_si256();
+        for (int k = 0; k < 31 && i + 32 <= n; ++k, i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+            const __m256i lo = _mm256_and_si256(v, lowNibbles);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles);
+            bytes = _mm256_add_epi8(bytes, _mm256_shuffle_epi8(lookup, lo));
+            bytes = _mm256_add_epi8(bytes, _mm256_shuffle_epi8(lookup, hi));
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+    }
+    // _mm_cvtsi128_si64() and _mm_extract_epi64() don't exist on 32-bit x86
+    alignas(16) quint64 lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes),
+                    _mm_add_epi64(_mm256_castsi256_si128(total),
+                                  _mm256_extracti128_si256(total, 1)));
+    return qsizetype(lanes[0] + lanes[1]) + populationCountWords(p + i, n - i);
+}
+
+static QT_FUNCTION_TARGET(POPCNT) qsizetype populationCountPopcnt(const uchar *p, qsizetype n)
+{
+    return populationCountWords(p, n);
+}
+#endif
+
+// Returns the number of set bits in the n bytes at p.
+static qsizetype populationCount(const uchar *p, qsizetype n)
+{
+#ifdef QBITARRAY_AVX2
+    if (n >= 256 && qCpuHasFeature(ArchHaswell))
+        return populationCountAvx2(p, n);
+    if (qCpuHasFeature(POPCNT))
+        return populationCountPopcnt(p, n);
+#endif
+    return populationCountWords(p, n);
+}
+
+// Returns the 64-bit word \a index of the n bytes at bits, in little-endian
+// order, padded with zeroes past the end.
+static inline quint64 loadWord(const uchar *bits, qsizetype n, qsizetype index)
+{
+    const qsizetype offset = index * 8;
+    if (offset + 8 <= n)
+        return qFromLittleEndian<quint64>(bits + offset);
+    uchar buffer[8] = {};
+    memcpy(buffer, bits + offset, size_t(n - offset));
+    return qFromLittleEndian<quint64>(buffer);
+}
+
 /*!
     Constructs a bit array containing \a size bits. The bits are
     initialized with \a value, which defaults to false (0).
@@ -165,31 +350,8 @@ QBitArray::QBitArray(qsizetype size, bool value)
 */
 qsizetype QBitArray::count(bool on) const
 {
-    qsizetype numBits = 0;
-    const quint8 *bits = reinterpret_cast<const quint8 *>(d.data()) + 1;
-
-    // the loops below will try to read from *end
-    // it's the QByteArray implicit NUL, so it will not change the bit count
-    const quint8 *const end = reinterpret_cast<const quint8 *>(d.end());
-
-    while (bits + 7 <= end) {
-        quint64 v = qFromUnaligned<quint64>(bits);
-        bits += 8;
-        numBits += qsizetype(qPopulationCount(v));
-    }
-    if (bits + 3 <= end) {
-        quint32 v = qFromUnaligned<quint32>(bits);
-        bits += 4;
-        numBits += qsizetype(qPopulationCount(v));
-    }
-    if (bits + 1 < end) {
-        quint16 v = qFromUnaligned<quint16>(bits);
-        bits += 2;
-        numBits += qsizetype(qPopulationCount(v));
-    }
-    if (bits < end)
-        numBits += qsizetype(qPopulationCount(bits[0]));
-
+    const qsizetype numBits = d.isEmpty() ? 0
+            : populationCount(reinterpret_cast<const uchar *>(d.constData()) + 1, d.size() - 1);
     return on ? numBits : size() - numBits;
 }
 
@@ -283,6 +445,81 @@ void QBitArray::fill(bool value, qsizetype begin, qsizetype end)
         setBit(begin++, value);
 }
 
+/*!
+    \since 6.10
+
+    Returns the index position of the first bit with the value \a on in the
+    bit array, searching forward from index position \a from. Returns -1 if
+    there is no such bit.
+
+    If \a from is -1, the search starts at the last bit; if it is -2, at
+    the next to last bit, and so on.
+
+    This function looks at 64 bits at a time, so it is much faster than
+    calling testBit() in a loop, and allows visiting all set bits of a
+    sparse bit array efficiently:
+
+    \snippet code/src_corelib_tools_qbitarray.cpp 16
+
+    \sa lastIndexOf(), count()
+*/
+qsizetype QBitArray::indexOf(bool on, qsizetype from) const
+{
+    const qsizetype n = size();
+    if (from < 0)
+        from = qMax(from + n, qsizetype(0));
+    if (from >= n)
+        return -1;
+
+    const uchar *bits = reinterpret_cast<const uchar *>(d.constData()) + 1;
+    const qsizetype numBytes = d.size() - 1;
+    const qsizetype numWords = (numBytes + 7) / 8;
+    const quint64 flip = on ? 0 : ~quint64(0);
+    qsizetype w = from / 64;
+    quint64 word = (loadWord(bits, numBytes, w) ^ flip) & (~quint64(0) << (from % 64));
+    while (!word) {
+        if (++w == numWords)
+            return -1;
+        word = loadWord(bits, numBytes, w) ^ flip;
+    }
+    // when looking for zeroes, the padding past the end reads as ones
+    const qsizetype result = w * 64 + qCountTrailingZeroBits(word);
+    return result < n ? result : -1;
+}
+
+/*!
+    \since 6.10
+
+    Returns the index position of the last bit with the value \a on in the
+    bit array, searching backward from index position \a from. If \a from
+    is -1 (the default), the search starts at the last bit. Returns -1 if
+    there is no such bit.
+
+    \sa indexOf()
+*/
+qsizetype QBitArray::lastIndexOf(bool on, qsizetype from) const
+{
+    const qsizetype n = size();
+    if (from < 0)
+        from += n;
+    else if (from >= n)
+        from = n - 1;
+    if (from < 0)
+        return -1;
+
+    const uchar *bits = reinterpret_cast<const uchar *>(d.constData()) + 1;
+    const qsizetype numBytes = d.size() - 1;
+    const quint64 flip = on ? 0 : ~quint64(0);
+    qsizetype w = from / 64;
+    quint64 word = (loadWord(bits, numBytes, w) ^ flip) & (~quint64(0) >> (63 - from % 64));
+    while (!word) {
+        if (w-- == 0)
+            return -1;
+        word = loadWord(bits, numBytes, w) ^ flip;
+    }
+    return w * 64 + 63 - qCountLeadingZeroBits(word);
+}
+
 /*!
     \fn const char *QBitArray::bits() const
     \since 5.11
@@ -569,14 +806,19 @@ QBitArray &performBitwiseOperationHelper(QBitArray &out, const QBitArray &a1,
         std::swap(n1, n2);
         std::swap(p1, p2);
     }
-    for (qsizetype i = 1; i < n2; ++i)
-        dst[i] = op(p1[i], p2[i]);
+    if (n2 > 1)
+        bitwiseOperation(dst + 1, p1 + 1, p2 + 1, n2 - 1, op);
 
     // Tail: operate as if both arrays had the same data by padding zeroes to
     // the end of the shorter of the two (for std::bit_or and std::bit_xor, this is
     // a memmove; for std::bit_and, it's memset to 0).
-    for (qsizetype i = qMax(n2, qsizetype(1)); i < n1; ++i)
-        dst[i] = op(p1[i], uchar(0));
+    const qsizetype tailStart = qMax(n2, qsizetype(1));
+    if (tailStart < n1) {
+        if constexpr (std::is_same_v<BitwiseOp, std::bit_and<>>)
+            memset(dst + tailStart, 0, size_t(n1 - tailStart));
+        else if (dst != p1)
+            memcpy(dst + tailStart, p1 + tailStart, size_t(n1 - tailStart));
+    }
 
     return out;
 }
@@ -659,12 +901,12 @@ QBitArray &performBitwiseOperation(QBitArray &self, QBitArray &other, BitwiseOp
 
 QBitArray &QBitArray::operator&=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_and<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_and<>());
 }
 
 QBitArray &QBitArray::operator&=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_and<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_and<>());
 }
 
 /*!
@@ -687,12 +929,12 @@ QBitArray &QBitArray::operator&=(const QBitArray &other)
 
 QBitArray &QBitArray::operator|=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_or<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_or<>());
 }
 
 QBitArray &QBitArray::operator|=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_or<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_or<>());
 }
 
 /*!
@@ -715,12 +957,12 @@ QBitArray &QBitArray::operator|=(const QBitArray &other)
 
 QBitArray &QBitArray::operator^=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_xor<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_xor<>());
 }
 
 QBitArray &QBitArray::operator^=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_xor<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_xor<>());
 }
 
 /*!
@@ -752,8 +994,8 @@ Q_NEVER_INLINE QBitArray QBitArray::inverted_inplace() &&
     if (n)
         bitdiff = dst[0] = src[0];      // copy the count of bits in the last byte
 
-    for (qsizetype i = 1; i < n; ++i)
-        dst[i] = ~src[i];
+    if (n > 1)
+        invertBytes(dst + 1, src + 1, n - 1);
 
     if (int tailCount = 16 - bitdiff; tailCount != 8) {
         // zero the bits beyond our size in the last byte
@@ -787,7 +1029,7 @@ Q_NEVER_INLINE QBitArray QBitArray::inverted_inplace() &&
 QBitArray operator&(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_and<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_and<>());
     return tmp;
 }
 
@@ -813,7 +1055,7 @@ QBitArray operator&(const QBitArray &a1, const QBitArray &a2)
 QBitArray operator|(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_or<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_or<>());
     return tmp;
 }
 
@@ -839,7 +1081,7 @@ QBitArray operator|(const QBitArray &a1, const QBitArray &a2)
 QBitArray operator^(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_xor<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_xor<>());
     return tmp;
 }
 
@@ -884,6 +1126,181 @@ QBitArray operator^(const QBitArray &a1, const QBitArray &a2)
     Sets the value referenced by the QBitRef to \a v.
 */
 
+/*!
+    \class QBitArrayRankSelect
+    \inmodule QtCore
+    \since 6.10
+    \brief The QBitArrayRankSelect class answers rank and select queries on a
+    QBitArray in constant time.
+
+    \ingroup tools
+    \reentrant
+
+    Bitmap indexes often need to know how many bits are set before a given
+    position (\e rank), or where the n-th set bit is (\e select). QBitArray
+    can only answer these by counting bits from the start of the array, which
+    takes linear time. QBitArrayRankSelect keeps a copy of a bit array
+    together with a small directory of bit counts, so that rank() and
+    select() only look at a few words of the array:
+
+    \snippet code/src_corelib_tools_qbitarray.cpp 17
+
+    The directory stores the number of set bits before every 4096-bit
+    superblock and, relative to that, before every 512-bit block, which adds
+    about 5% to the memory used by the bit array. The position of every
+    8192nd set bit is recorded as well, to narrow down the search in
+    select().
+
+    Since QBitArray is \l{implicitly shared}, constructing a
+    QBitArrayRankSelect does not copy the bits. The index does not follow
+    later changes to the original bit array; construct a new one instead.
+
+    \sa QBitArray::count(), QBitArray::indexOf()
+*/
+
+/*!
+    \fn QBitArrayRankSelect::QBitArrayRankSelect()
+
+    Constructs an index for an empty bit array.
+*/
+
+/*!
+    Constructs an index for the bit array \a bits. This takes linear time.
+*/
+QBitArrayRankSelect::QBitArrayRankSelect(const QBitArray &bits)
+    : m_bits(bits)
+{
+    const qsizetype numBytes = m_bits.d.isEmpty() ? 0 : m_bits.d.size() - 1;
+    const uchar *data = reinterpret_cast<const uchar *>(m_bits.bits());
+    const qsizetype numBlocks = (numBytes + BlockBytes - 1) / BlockBytes;
+    m_superblockRanks.reserve(numBlocks / BlocksPerSuperblock + 1);
+    m_blockRanks.reserve(numBlocks);
+
+    qsizetype total = 0;
+    qsizetype superblockStart = 0;
+    for (qsizetype b = 0; b < numBlocks; ++b) {
+        if (b % BlocksPerSuperblock == 0) {
+            m_superblockRanks.append(total);
+            superblockStart = total;
+        }
+        m_blockRanks.append(quint16(total - superblockStart));
+        const qsizetype offset = b * BlockBytes;
+        const qsizetype ones = populationCount(data + offset, qMin(BlockBytes, numBytes - offset));
+        // record the block of every SelectSampleRate-th set bit
+        for (qsizetype next = m_selectSamples.size() * SelectSampleRate;
+             next < total + ones; next += SelectSampleRate) {
+            m_selectSamples.append(b);
+        }
+        total += ones;
+    }
+    m_count = total;
+}
+
+/*!
+    \fn const QBitArray &QBitArrayRankSelect::bitArray() const
+
+    Returns the bit array this index was constructed for.
+*/
+
+/*!
+    \fn qsizetype QBitArrayRankSelect::size() const
+
+    Returns the number of bits in the bit array.
+*/
+
+/*!
+    \fn qsizetype QBitArrayRankSelect::count() const
+
+    Returns the number of set bits in the bit array. This is the same as
+    QBitArray::count(true), but takes constant time.
+*/
+
+quint64 QBitArrayRankSelect::word(qsizetype index) const
+{
+    return loadWord(reinterpret_cast<const uchar *>(m_bits.bits()), m_bits.d.size() - 1, index);
+}
+
+qsizetype QBitArrayRankSelect::blockRank(qsizetype block) const
+{
+    return m_superblockRanks.at(block / BlocksPerSuperblock) + m_blockRanks.at(block);
+}
+
+/*!
+    Returns the number of set bits before index position \a i, that is, in
+    the range [0, \a i). The number of zero bits in that range is
+    \a i - rank(\a i).
+
+    \a i must be between 0 and size(), inclusive.
+
+    \sa select()
+*/
+qsizetype QBitArrayRankSelect::rank(qsizetype i) const
+{
+    Q_ASSERT_X(i >= 0 && i <= size(), "QBitArrayRankSelect::rank", "index out of range");
+    if (i == size())
+        return m_count;
+    const qsizetype block = i / BlockBits;
+    qsizetype result = blockRank(block);
+    qsizetype w = block * BlockWords;
+    for (const qsizetype last = i / 64; w < last; ++w)
+        result += qPopulationCount(word(w));
+    if (const int bit = int(i % 64))
+        result += qPopulationCount(word(w) & ((quint64(1) << bit) - 1));
+    return result;
+}
+
+// Returns the position of the set bit number n (counted from 0) in w.
+static int selectInWord(quint64 w, int n)
+{
+#if defined(__BMI2__) && defined(Q_PROCESSOR_X86_64)
+    return qCountTrailingZeroBits(_pdep_u64(quint64(1) << n, w));
+#else
+    int shift = 0;
+    for (int ones; n >= (ones = qPopulationCount(quint8(w >> shift))); shift += 8)
+        n -= ones;
+    uint byte = quint8(w >> shift);
+    for ( ; n; --n)
+        byte &= byte - 1;
+    return shift + qCountTrailingZeroBits(byte);
+#endif
+}
+
+/*!
+    Returns the index position of the set bit number \a n, counting from 0,
+    or -1 if the bit array has no more than \a n set bits. For all valid
+    \a n, rank(select(\a n)) is \a n.
+
+    \sa rank(), QBitArray::indexOf()
+*/
+qsizetype QBitArrayRankSelect::select(qsizetype n) const
+{
+    if (n < 0 || n >= m_count)
+        return -1;
+
+    // binary search for the last block that starts with at most n set bits,
+    // between the blocks holding the neighbouring samples
+    const qsizetype sample = n / SelectSampleRate;
+    qsizetype lo = m_selectSamples.at(sample);
+    qsizetype hi = sample + 1 < m_selectSamples.size() ? m_selectSamples.at(sample + 1)
+                                                      : m_blockRanks.size() - 1;
+    while (lo < hi) {
+        const qsizetype mid = lo + (hi - lo + 1) / 2;
+        if (blockRank(mid) <= n)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    qsizetype remaining = n - blockRank(lo);
+    for (qsizetype w = lo * BlockWords; ; ++w) {
+        const quint64 bits = word(w);
+        const int ones = qPopulationCount(bits);
+        if (remaining < ones)
+            return w * 64 + selectInWord(bits, int(remaining));
+        remaining -= ones;
+    }
+}
+
 /*****************************************************************************
   QBitArray stream functions
  *****************************************************************************/
@@ -5,6 +5,7 @@
 #define QBITARRAY_H
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -60,6 +61,8 @@ class Q_CORE_EXPORT QBitArray
 
     QBitArray inverted_inplace() &&;
 
+    friend class QBitArrayRankSelect;
+
 public:
     inline QBitArray() noexcept {}
     explicit QBitArray(qsizetype size, bool val = false);
@@ -132,6 +135,9 @@ public:
 
     quint32 toUInt32(QSysInfo::Endian endianness, bool *ok = nullptr) const noexcept;
 
+    qsizetype indexOf(bool on, qsizetype from = 0) const;
+    qsizetype lastIndexOf(bool on, qsizetype from = -1) const;
+
 public:
     typedef QByteArray::DataPointer DataPtr;
     inline DataPtr &data_ptr() { return d.data_ptr(); }
@@ -163,6 +169,36 @@ public:
 QBitRef QBitArray::operator[](qsizetype i)
 { Q_ASSERT(i >= 0); return QBitRef(*this, i); }
 
+class Q_CORE_EXPORT QBitArrayRankSelect
+{
+public:
+    QBitArrayRankSelect() = default;
+    explicit QBitArrayRankSelect(const QBitArray &bits);
+
+    const QBitArray &bitArray() const noexcept { return m_bits; }
+    qsizetype size() const { return m_bits.size(); }
+    qsizetype count() const noexcept { return m_count; }
+
+    qsizetype rank(qsizetype i) const;
+    qsizetype select(qsizetype n) const;
+
+private:
+    static constexpr qsizetype BlockBits = 512;
+    static constexpr qsizetype BlockBytes = BlockBits / 8;
+    static constexpr qsizetype BlockWords = BlockBits / 64;
+    static constexpr qsizetype BlocksPerSuperblock = 8;
+    static constexpr qsizetype SelectSampleRate = 8192;
+
+    quint64 word(qsizetype index) const;
+    qsizetype blockRank(qsizetype block) const;
+
+    QBitArray m_bits;
+    QList<qsizetype> m_superblockRanks;
+    QList<quint16> m_blockRanks;
+    QList<qsizetype> m_selectSamples;
+    qsizetype m_count = 0;
+};
+
 #ifndef QT_NO_DATASTREAM
 Q_CORE_EXPORT QDataStream &operator<<(QDataStream &, const QBitArray &);
 Q_CORE_EXPORT QDataStream &operator>>(QDataStream &, QBitArray &);
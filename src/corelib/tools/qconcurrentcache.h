@@ -0,0 +1,573 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTCACHE_H
+#define QCONCURRENTCACHE_H
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qconcurrentshards_impl.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmath.h>
+#include <QtCore/qmutex.h>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+// Count-min sketch with four rows of 4-bit counters, estimating how often
+// each hash value was seen recently. All counters are halved after a number
+// of increments proportional to the table size, so that old popularity
+// fades. This is the TinyLFU admission filter of QConcurrentCache.
+class CacheFrequencySketch
+{
+public:
+    void ensureCapacity(qsizetype entries)
+    {
+        const qsizetype wanted = qBound(qsizetype(8), entries, qsizetype(1) << 24);
+        if (wanted <= table.size())
+            return;
+        if (table.isEmpty()) {
+            table = QList<quint64>(qsizetype(qNextPowerOfTwo(quint32(wanted - 1))), 0);
+            return;
+        }
+        // A counter's word index gains one more bit of the hash with each
+        // doubling, so copying the table keeps all counts.
+        while (table.size() < wanted)
+            table.append(QList<quint64>(table));
+    }
+
+    int frequency(size_t hash) const noexcept
+    {
+        if (table.isEmpty())
+            return 0;
+        int result = 15;
+        for (int row = 0; row < Rows; ++row) {
+            const Counter c = counter(hash, row);
+            result = qMin(result, int((table.at(c.word) >> c.shift) & 15));
+        }
+        return result;
+    }
+
+    void increment(size_t hash) noexcept
+    {
+        if (table.isEmpty())
+            return;
+        bool added = false;
+        for (int row = 0; row < Rows; ++row) {
+            const Counter c = counter(hash, row);
+            quint64 &word = table[c.word];
+            if (((word >> c.shift) & 15) != 15) {
+                word += quint64(1) << c.shift;
+                added = true;
+            }
+        }
+        if (added && ++additions >= 10 * table.size())
+            age();
+    }
+
+private:
+    static constexpr int Rows = 4;
+    struct Counter
+    {
+        qsizetype word;
+        int shift;
+    };
+
+    Counter counter(size_t hash, int row) const noexcept
+    {
+        static constexpr quint64 seeds[Rows] = {
+            Q_UINT64_C(0xc3a5c85c97cb3127), Q_UINT64_C(0xb492b66fbe98f273),
+            Q_UINT64_C(0x9ae16a3b2f90404f), Q_UINT64_C(0xcbf29ce484222325)
+        };
+        quint64 h = (quint64(hash) + seeds[row]) * Q_UINT64_C(0x9e3779b97f4a7c15);
+        h ^= h >> 29;
+        return { qsizetype(h >> 4) & (table.size() - 1), int(h & 15) * 4 };
+    }
+
+    void age() noexcept
+    {
+        for (quint64 &word : table)
+            word = (word >> 1) & Q_UINT64_C(0x7777777777777777);
+        additions /= 2;
+    }
+
+    QList<quint64> table;
+    qsizetype additions = 0;
+};
+
+} // namespace QtPrivate
+
+template <class Key, class T>
+class QConcurrentCache
+{
+public:
+    struct Statistics
+    {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 evictions = 0;
+        qint64 expirations = 0;
+    };
+
+    enum { DefaultShardCount = 8 };
+
+private:
+    // Where a node lives in the W-TinyLFU layout: new entries go to a small
+    // LRU window; entries pushed out of it compete for the main area, whose
+    // probation segment holds entries seen once and whose protected segment
+    // holds entries that were accessed again there.
+    enum class Segment : quint8 { Window, Probation, Protected };
+
+    struct Node
+    {
+        Node *prev = nullptr;
+        Node *next = nullptr;
+        Key key;
+        T value;
+        qsizetype cost;
+        QDeadlineTimer expiry;
+        size_t hash;
+        Segment segment = Segment::Window;
+    };
+
+    // Intrusive LRU list; first is the least recently used node
+    struct List
+    {
+        Node *first = nullptr;
+        Node *last = nullptr;
+        qsizetype cost = 0;
+        qsizetype count = 0;
+
+        void append(Node *n) noexcept
+        {
+            n->prev = last;
+            n->next = nullptr;
+            (last ? last->next : first) = n;
+            last = n;
+            cost += n->cost;
+            ++count;
+        }
+        void remove(Node *n) noexcept
+        {
+            (n->prev ? n->prev->next : first) = n->next;
+            (n->next ? n->next->prev : last) = n->prev;
+            cost -= n->cost;
+            --count;
+        }
+        void moveToBack(Node *n) noexcept
+        {
+            if (n != last) {
+                remove(n);
+                append(n);
+            }
+        }
+    };
+
+    struct alignas(64) Shard
+    {
+        QMutex mutex;
+        QHash<Key, Node *> nodes;
+        List window;
+        List probation;
+        List protectedList;
+        QtPrivate::CacheFrequencySketch sketch;
+        qsizetype share = 0;    // this shard's fair part of the cache's budget
+        Statistics statistics;
+
+        ~Shard() { qDeleteAll(nodes); }
+
+        List &list(Segment segment) noexcept
+        {
+            switch (segment) {
+            case Segment::Window:
+                return window;
+            case Segment::Probation:
+                return probation;
+            case Segment::Protected:
+                break;
+            }
+            return protectedList;
+        }
+        qsizetype totalCost() const noexcept
+        { return window.cost + probation.cost + protectedList.cost; }
+        qsizetype windowMaxCost() const noexcept { return qMax(share / 100, qsizetype(1)); }
+        qsizetype protectedMaxCost() const noexcept
+        { return qMax(share - windowMaxCost(), qsizetype(0)) * 4 / 5; }
+    };
+
+public:
+    explicit QConcurrentCache(qsizetype maxCost = 100, qsizetype shardCount = DefaultShardCount)
+        : shardBits(QtPrivate::concurrentShardBits(shardCount))
+    {
+        shards.reset(new Shard[size_t(1) << shardBits]);
+        setMaxCost(maxCost);
+    }
+    ~QConcurrentCache() = default;
+
+    qsizetype shardCount() const noexcept { return qsizetype(1) << shardBits; }
+
+    qsizetype maxCost() const noexcept { return mx.loadRelaxed(); }
+    void setMaxCost(qsizetype cost)
+    {
+        cost = qMax(cost, qsizetype(0));
+        mx.storeRelaxed(cost);
+        const qsizetype count = shardCount();
+        for (qsizetype i = 0; i < count; ++i) {
+            Shard &shard = shards[i];
+            QMutexLocker locker(&shard.mutex);
+            shard.share = (cost + count - 1) / count;
+            trim(shard);
+        }
+        evictFromAnyShard();
+    }
+
+    std::chrono::milliseconds timeToLive() const noexcept
+    { return std::chrono::milliseconds(ttl.loadRelaxed()); }
+    void setTimeToLive(std::chrono::milliseconds timeToLive) noexcept
+    { ttl.storeRelaxed(qMax(timeToLive.count(), qint64(0))); }
+
+    qsizetype size() const
+    {
+        qsizetype total = 0;
+        for (qsizetype i = 0; i < shardCount(); ++i) {
+            QMutexLocker locker(&shards[i].mutex);
+            total += shards[i].nodes.size();
+        }
+        return total;
+    }
+    bool isEmpty() const { return size() == 0; }
+    qsizetype totalCost() const noexcept { return total.loadRelaxed(); }
+
+    void clear()
+    {
+        for (qsizetype i = 0; i < shardCount(); ++i) {
+            Shard &shard = shards[i];
+            QMutexLocker locker(&shard.mutex);
+            total.fetchAndSubRelaxed(shard.totalCost());
+            qDeleteAll(shard.nodes);
+            shard.nodes.clear();
+            shard.window = List();
+            shard.probation = List();
+            shard.protectedList = List();
+        }
+    }
+
+    bool insert(const Key &key, const T &value, qsizetype cost = 1)
+    {
+        return insert(key, value, cost, timeToLive());
+    }
+    bool insert(const Key &key, const T &value, qsizetype cost,
+                std::chrono::milliseconds timeToLive)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        if (!insertLocked(shard, key, value, cost, timeToLive, hash))
+            return false;
+        locker.unlock();
+        evictFromAnyShard();
+        locker.relock();
+        return shard.nodes.contains(key);
+    }
+
+    std::optional<T> find(const Key &key)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        if (Node *n = lookup(shard, key, hash))
+            return n->value;
+        return std::nullopt;
+    }
+    T value(const Key &key, const T &defaultValue = T())
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        if (Node *n = lookup(shard, key, hash))
+            return n->value;
+        return defaultValue;
+    }
+    template <typename Factory>
+    T findOrCompute(const Key &key, Factory &&factory, qsizetype cost = 1)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        if (Node *n = lookup(shard, key, hash))
+            return n->value;
+
+        // the factory may be slow or use the cache itself, so run it unlocked
+        locker.unlock();
+        T value = std::forward<Factory>(factory)();
+        locker.relock();
+        if (Node *n = shard.nodes.value(key); n && !n->expiry.hasExpired()) {
+            // another thread inserted the key meanwhile; keep its value
+            touch(shard, n);
+            return n->value;
+        }
+        insertLocked(shard, key, value, cost, timeToLive(), hash);
+        locker.unlock();
+        evictFromAnyShard();
+        return value;
+    }
+
+    bool contains(const Key &key) const
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        const Node *n = shard.nodes.value(key);
+        return n && !n->expiry.hasExpired();
+    }
+
+    bool remove(const Key &key)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        Node *n = shard.nodes.value(key);
+        if (!n)
+            return false;
+        erase(shard, n);
+        return true;
+    }
+    std::optional<T> take(const Key &key)
+    {
+        const size_t hash = hashOf(key);
+        Shard &shard = shardFor(hash);
+        QMutexLocker locker(&shard.mutex);
+        Node *n = shard.nodes.value(key);
+        if (!n)
+            return std::nullopt;
+        std::optional<T> result;
+        if (n->expiry.hasExpired())
+            ++shard.statistics.expirations;
+        else
+            result.emplace(std::move(n->value));
+        erase(shard, n);
+        return result;
+    }
+
+    qsizetype removeExpired()
+    {
+        qsizetype removed = 0;
+        for (qsizetype i = 0; i < shardCount(); ++i) {
+            Shard &shard = shards[i];
+            QMutexLocker locker(&shard.mutex);
+            for (auto it = shard.nodes.begin(); it != shard.nodes.end(); ) {
+                Node *n = it.value();
+                if (n->expiry.hasExpired()) {
+                    it = shard.nodes.erase(it);
+                    shard.list(n->segment).remove(n);
+                    total.fetchAndSubRelaxed(n->cost);
+                    delete n;
+                    ++shard.statistics.expirations;
+                    ++removed;
+                } else {
+                    ++it;
+                }
+            }
+        }
+        return removed;
+    }
+
+    Statistics statistics() const
+    {
+        Statistics result;
+        for (qsizetype i = 0; i < shardCount(); ++i) {
+            QMutexLocker locker(&shards[i].mutex);
+            const Statistics &s = shards[i].statistics;
+            result.hits += s.hits;
+            result.misses += s.misses;
+            result.evictions += s.evictions;
+            result.expirations += s.expirations;
+        }
+        return result;
+    }
+    void resetStatistics()
+    {
+        for (qsizetype i = 0; i < shardCount(); ++i) {
+            QMutexLocker locker(&shards[i].mutex);
+            shards[i].statistics = Statistics();
+        }
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QConcurrentCache)
+
+    static size_t hashOf(const Key &key)
+    {
+        return QHashPrivate::calculateHash(key, QHashSeed::globalSeed());
+    }
+    Shard &shardFor(size_t hash) const noexcept
+    {
+        return shards[QtPrivate::concurrentShardIndex(hash, shardBits)];
+    }
+
+    void erase(Shard &shard, Node *n)
+    {
+        shard.list(n->segment).remove(n);
+        total.fetchAndSubRelaxed(n->cost);
+        shard.nodes.remove(n->key);
+        delete n;
+    }
+
+    Node *lookup(Shard &shard, const Key &key, size_t hash)
+    {
+        shard.sketch.increment(hash);
+        Node *n = shard.nodes.value(key);
+        if (!n) {
+            ++shard.statistics.misses;
+            return nullptr;
+        }
+        if (n->expiry.hasExpired()) {
+            erase(shard, n);
+            ++shard.statistics.expirations;
+            ++shard.statistics.misses;
+            return nullptr;
+        }
+        ++shard.statistics.hits;
+        touch(shard, n);
+        return n;
+    }
+
+    static void touch(Shard &shard, Node *n)
+    {
+        switch (n->segment) {
+        case Segment::Window:
+            shard.window.moveToBack(n);
+            break;
+        case Segment::Probation:
+            // a second hit in the main area protects the entry; the least
+            // recently used protected entries make room by going back to
+            // probation
+            shard.probation.remove(n);
+            n->segment = Segment::Protected;
+            shard.protectedList.append(n);
+            while (shard.protectedList.cost > shard.protectedMaxCost()
+                   && shard.protectedList.first != n) {
+                Node *demoted = shard.protectedList.first;
+                shard.protectedList.remove(demoted);
+                demoted->segment = Segment::Probation;
+                shard.probation.append(demoted);
+            }
+            break;
+        case Segment::Protected:
+            shard.protectedList.moveToBack(n);
+            break;
+        }
+    }
+
+    bool insertLocked(Shard &shard, const Key &key, const T &value, qsizetype cost,
+                             std::chrono::milliseconds timeToLive, size_t hash)
+    {
+        Node *n = shard.nodes.value(key);
+        if (cost > maxCost()) {
+            // like QCache, refuse entries that can never fit
+            if (n)
+                erase(shard, n);
+            return false;
+        }
+
+        const QDeadlineTimer expiry = timeToLive.count() > 0
+                ? QDeadlineTimer(timeToLive)
+                : QDeadlineTimer(QDeadlineTimer::Forever);
+        shard.sketch.increment(hash);
+        if (n) {
+            n->value = value;
+            shard.list(n->segment).cost += cost - n->cost;
+            total.fetchAndAddRelaxed(cost - n->cost);
+            n->cost = cost;
+            n->expiry = expiry;
+            touch(shard, n);
+        } else {
+            n = new Node{ nullptr, nullptr, key, value, cost, expiry, hash, Segment::Window };
+            shard.nodes.insert(key, n);
+            shard.window.append(n);
+            total.fetchAndAddRelaxed(cost);
+            shard.sketch.ensureCapacity(shard.nodes.size());
+        }
+        trim(shard);
+        return shard.nodes.contains(key);
+    }
+
+    // Moves the overflow of the window to probation, then evicts while the
+    // cache is over its budget and this shard uses more than its share.
+    // Each entry leaving the window is only admitted if the sketch considers
+    // it more popular than the probation entry it would replace; this keeps
+    // one-off scans from flushing the hot set.
+    void trim(Shard &shard)
+    {
+        qsizetype candidates = 0;
+        while (shard.window.cost > shard.windowMaxCost() && shard.window.first) {
+            Node *n = shard.window.first;
+            shard.window.remove(n);
+            n->segment = Segment::Probation;
+            shard.probation.append(n);
+            ++candidates;
+        }
+
+        while (totalCost() > maxCost() && shard.totalCost() > shard.share) {
+            Node *victim = shard.probation.first;
+            if (!victim) {
+                victim = shard.protectedList.first ? shard.protectedList.first : shard.window.first;
+            } else if (candidates > 0) {
+                // candidates are the most recent arrivals at the back of probation
+                Node *candidate = shard.probation.last;
+                const bool victimIsCandidate = candidates >= shard.probation.count;
+                if (candidate != victim
+                    && shard.sketch.frequency(candidate->hash) <= shard.sketch.frequency(victim->hash)) {
+                    victim = candidate;
+                    --candidates;
+                } else if (victimIsCandidate) {
+                    --candidates;
+                }
+            }
+            erase(shard, victim);
+            ++shard.statistics.evictions;
+        }
+    }
+
+    // Shards may use more than their share while the cache as a whole is
+    // within budget, so that entries larger than a share fit. When a shard
+    // that is within its share overflows the cache, other shards make room:
+    // first those above their share, then any. Only one shard is locked at a
+    // time.
+    void evictFromAnyShard()
+    {
+        const qsizetype count = shardCount();
+        for (int pass = 0; pass < 2; ++pass) {
+            const qsizetype start = evictionCursor.fetchAndAddRelaxed(1);
+            for (qsizetype i = 0; i < count && totalCost() > maxCost(); ++i) {
+                Shard &shard = shards[(start + i) & (count - 1)];
+                QMutexLocker locker(&shard.mutex);
+                while (totalCost() > maxCost() && shard.totalCost() > (pass ? 0 : shard.share)) {
+                    Node *victim = shard.probation.first;
+                    if (!victim)
+                        victim = shard.protectedList.first ? shard.protectedList.first : shard.window.first;
+                    erase(shard, victim);
+                    ++shard.statistics.evictions;
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<Shard[]> shards;
+    const int shardBits;
+    QAtomicInteger<qsizetype> total;
+    QAtomicInteger<qsizetype> evictionCursor;
+    QAtomicInteger<qsizetype> mx;
+    QAtomicInteger<qint64> ttl;
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTCACHE_H
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTHASH_H
+#define QCONCURRENTHASH_H
+
+#include <QtCore/qconcurrentshards_impl.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qreadwritelock.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+template <class Key, class T>
+class QConcurrentHash
+{
+    // Each shard lives on its own cache line, so that threads working on
+    // different shards do not invalidate each other's lock.
+    struct alignas(64) Shard
+    {
+        mutable QReadWriteLock lock;
+        QHash<Key, T> hash;
+    };
+
+public:
+    enum { DefaultShardCount = 64 };
+
+    explicit QConcurrentHash(qsizetype shardCount = DefaultShardCount)
+        : shardBits(QtPrivate::concurrentShardBits(shardCount))
+    {
+        shards.reset(new Shard[size_t(1) << shardBits]);
+    }
+    ~QConcurrentHash() = default;
+
+    qsizetype shardCount() const noexcept { return qsizetype(1) << shardBits; }
+
+    qsizetype size() const
+    {
+        qsizetype total = 0;
+        for (const Shard &shard : shardRange()) {
+            QReadLocker locker(&shard.lock);
+            total += shard.hash.size();
+        }
+        return total;
+    }
+    bool isEmpty() const { return size() == 0; }
+    void clear()
+    {
+        for (Shard &shard : shardRange()) {
+            QWriteLocker locker(&shard.lock);
+            shard.hash.clear();
+        }
+    }
+
+    bool contains(const Key &key) const
+    {
+        const Shard &shard = shardFor(key);
+        QReadLocker locker(&shard.lock);
+        return shard.hash.contains(key);
+    }
+    std::optional<T> find(const Key &key) const
+    {
+        const Shard &shard = shardFor(key);
+        QReadLocker locker(&shard.lock);
+        const auto it = shard.hash.constFind(key);
+        if (it == shard.hash.cend())
+            return std::nullopt;
+        return *it;
+    }
+    T value(const Key &key) const
+    {
+        const Shard &shard = shardFor(key);
+        QReadLocker locker(&shard.lock);
+        return shard.hash.value(key);
+    }
+    T value(const Key &key, const T &defaultValue) const
+    {
+        const Shard &shard = shardFor(key);
+        QReadLocker locker(&shard.lock);
+        return shard.hash.value(key, defaultValue);
+    }
+
+    bool insert(const Key &key, const T &value)
+    {
+        Shard &shard = shardFor(key);
+        QWriteLocker locker(&shard.lock);
+        const qsizetype oldSize = shard.hash.size();
+        shard.hash.insert(key, value);
+        return shard.hash.size() != oldSize;
+    }
+    bool insertIfAbsent(const Key &key, const T &value)
+    {
+        Shard &shard = shardFor(key);
+        QWriteLocker locker(&shard.lock);
+        return shard.hash.tryEmplace(key, value).inserted;
+    }
+    template <typename Factory>
+    T findOrInsert(const Key &key, Factory &&factory)
+    {
+        Shard &shard = shardFor(key);
+        {
+            QReadLocker locker(&shard.lock);
+            const auto it = shard.hash.constFind(key);
+            if (it != shard.hash.cend())
+                return *it;
+        }
+        QWriteLocker locker(&shard.lock);
+        // another thread may have inserted the key while we were unlocked
+        auto it = shard.hash.find(key);
+        if (it == shard.hash.end())
+            it = shard.hash.insert(key, std::forward<Factory>(factory)());
+        return *it;
+    }
+    template <typename Function>
+    bool modify(const Key &key, Function &&function)
+    {
+        Shard &shard = shardFor(key);
+        QWriteLocker locker(&shard.lock);
+        const auto it = shard.hash.find(key);
+        if (it == shard.hash.end())
+            return false;
+        std::forward<Function>(function)(*it);
+        return true;
+    }
+
+    bool remove(const Key &key)
+    {
+        Shard &shard = shardFor(key);
+        QWriteLocker locker(&shard.lock);
+        return shard.hash.remove(key);
+    }
+    std::optional<T> take(const Key &key)
+    {
+        Shard &shard = shardFor(key);
+        QWriteLocker locker(&shard.lock);
+        const auto it = shard.hash.find(key);
+        if (it == shard.hash.end())
+            return std::nullopt;
+        std::optional<T> result(std::move(*it));
+        shard.hash.erase(it);
+        return result;
+    }
+
+    QHash<Key, T> toHash() const
+    {
+        QHash<Key, T> result;
+        for (const Shard &shard : shardRange()) {
+            QReadLocker locker(&shard.lock);
+            if (result.isEmpty())
+                result = shard.hash;
+            else
+                result.insert(shard.hash);
+        }
+        return result;
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QConcurrentHash)
+
+    template <typename S>
+    struct ShardRange
+    {
+        S *first;
+        S *last;
+        S *begin() const noexcept { return first; }
+        S *end() const noexcept { return last; }
+    };
+    ShardRange<Shard> shardRange() noexcept
+    { return { shards.get(), shards.get() + shardCount() }; }
+    ShardRange<const Shard> shardRange() const noexcept
+    { return { shards.get(), shards.get() + shardCount() }; }
+
+    size_t shardIndex(const Key &key) const
+    {
+        const size_t hash = QHashPrivate::calculateHash(key, QHashSeed::globalSeed());
+        return QtPrivate::concurrentShardIndex(hash, shardBits);
+    }
+    Shard &shardFor(const Key &key) { return shards[shardIndex(key)]; }
+    const Shard &shardFor(const Key &key) const { return shards[shardIndex(key)]; }
+
+    std::unique_ptr<Shard[]> shards;
+    const int shardBits;
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTHASH_H
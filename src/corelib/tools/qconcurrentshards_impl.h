@@ -0,0 +1,48 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#if 0
+#pragma qt_sync_skip_header_check
+#pragma qt_sync_stop_processing
+#endif
+
+#ifndef QCONCURRENTSHARDS_IMPL_H
+#define QCONCURRENTSHARDS_IMPL_H
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmath.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+// Shard selection shared by QConcurrentHash and QConcurrentCache
+namespace QtPrivate {
+
+// Returns the base-2 logarithm of the number of shards to create when
+// shardCount were requested: the next power of two, from 1 to 65536.
+inline int concurrentShardBits(qsizetype shardCount) noexcept
+{
+    const quint32 count = qNextPowerOfTwo(quint32(qBound(qsizetype(1), shardCount,
+                                                           qsizetype(1) << 16) - 1));
+    return int(qCountTrailingZeroBits(count));
+}
+
+// Returns which of the 2^shardBits shards holds the key with the given
+// hash. QHash picks buckets with the low bits of the same hash, so use the
+// high bits here to keep the keys of one shard spread over its buckets.
+// qHash() implementations only need good low bits (think of "id ^ seed"),
+// so mix the hash before looking at the high ones.
+inline size_t concurrentShardIndex(size_t hash, int shardBits) noexcept
+{
+    if (shardBits == 0)
+        return 0;
+    return QHashPrivate::hash(hash, 0) >> (std::numeric_limits<size_t>::digits - shardBits);
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTSHARDS_IMPL_H
@@ -6,6 +6,7 @@
 #include <qcryptographichash.h>
 #include <qmessageauthenticationcode.h>
 
+#include <QtCore/private/qsimd_p.h>
 #include <QtCore/private/qsmallbytearray_p.h>
 #include <qiodevice.h>
 #include <qmutex.h>
@@ -14,6 +15,7 @@
 #include <array>
 #include <climits>
 #include <numeric>
+#include <utility>
 
 #include "../../3rdparty/sha1/sha1.cpp"
 
@@ -181,6 +183,637 @@ static constexpr int maxHashLength()
 
 using HashResult = QSmallByteArray<maxHashLength()>;
 
+/*
+    Hardware-accelerated block functions.
+
+    The reference implementations above process one 64-byte block (128 bytes
+    for BLAKE2b) at a time in portable C. The functions below do the same
+    with the x86 SHA extensions (SHA-NI), and with SSSE3/AVX2 for BLAKE2.
+    They are selected at runtime, and only ever see whole blocks; buffering
+    of partial blocks, padding and length bookkeeping stay in the reference
+    code.
+*/
+#if !defined(QT_BOOTSTRAPPED)
+#  if QT_COMPILER_SUPPORTS_HERE(SHA) && QT_COMPILER_SUPPORTS_HERE(SSE4_1) && defined(Q_PROCESSOR_X86) \
+    && !defined(USING_OPENSSL30)
+#    define QCRYPTOGRAPHICHASH_SHA_KERNELS
+#    define QT_FUNCTION_TARGET_STRING_SHA_SSE4_1   QT_FUNCTION_TARGET_STRING_SHA "," QT_FUNCTION_TARGET_STRING_SSE4_1
+#  endif
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+#    define QCRYPTOGRAPHICHASH_AVX2
+#  endif
+#endif
+
+// only the SHA-NI and the multi-buffer SHA-256 kernels need the constants
+#if !defined(QT_CRYPTOGRAPHICHASH_ONLY_SHA1) && (defined(QCRYPTOGRAPHICHASH_SHA_KERNELS) \
+    || (defined(QCRYPTOGRAPHICHASH_AVX2) && !QT_CONFIG(openssl_hash)))
+alignas(16) static const quint32 sha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+#endif
+
+#if defined(QCRYPTOGRAPHICHASH_SHA_KERNELS) && defined(Q_PROCESSOR_X86)
+static bool hasShaKernels() noexcept
+{
+    return qCpuHasFeature(SHA) && qCpuHasFeature(SSE4_1);
+}
+
+// One group of four SHA-1 rounds. The message schedule for the later groups
+// is computed in msg[] as we go; see the Intel SHA extensions white paper.
+template <int G> static inline QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha1ShaNiRounds(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4])
+{
+    if constexpr (G == 0)
+        e[0] = _mm_add_epi32(e[0], msg[0]);
+    else
+        e[G % 2] = _mm_sha1nexte_epu32(e[G % 2], msg[G % 4]);
+    e[(G + 1) % 2] = abcd;
+    if constexpr (G >= 3 && G <= 18)
+        msg[(G + 1) % 4] = _mm_sha1msg2_epu32(msg[(G + 1) % 4], msg[G % 4]);
+    abcd = _mm_sha1rnds4_epu32(abcd, e[G % 2], G / 5);
+    if constexpr (G >= 1 && G <= 16)
+        msg[(G + 3) % 4] = _mm_sha1msg1_epu32(msg[(G + 3) % 4], msg[G % 4]);
+    if constexpr (G >= 2 && G <= 17)
+        msg[(G + 2) % 4] = _mm_xor_si128(msg[(G + 2) % 4], msg[G % 4]);
+}
+
+template <int... G> static inline QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha1ShaNiBlock(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4],
+                    std::integer_sequence<int, G...>)
+{
+    (sha1ShaNiRounds<G>(abcd, e, msg), ...);
+}
+
+static QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha1BlocksHw(quint32 (&state)[5], const uchar *data, size_t blocks) noexcept
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0x1b);
+    __m128i e[2] = { _mm_set_epi32(int(state[4]), 0, 0, 0), _mm_setzero_si128() };
+
+    for ( ; blocks; --blocks, data += 64) {
+        const __m128i abcdSaved = abcd;
+        const __m128i eSaved = e[0];
+        __m128i msg[4];
+        for (int i = 0; i < 4; ++i) {
+            msg[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i));
+            msg[i] = _mm_shuffle_epi8(msg[i], byteSwap);
+        }
+        sha1ShaNiBlock(abcd, e, msg, std::make_integer_sequence<int, 20>());
+        e[0] = _mm_sha1nexte_epu32(e[0], eSaved);
+        abcd = _mm_add_epi32(abcd, abcdSaved);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_shuffle_epi32(abcd, 0x1b));
+    state[4] = quint32(_mm_extract_epi32(e[0], 3));
+}
+
+#  ifndef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+// One group of four SHA-256 rounds, including the message schedule
+template <int G> static inline QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha256ShaNiRounds(__m128i &abef, __m128i &cdgh, __m128i (&msg)[4])
+{
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i *>(sha256RoundConstants + 4 * G));
+    k = _mm_add_epi32(msg[G % 4], k);
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+    if constexpr (G >= 3 && G <= 14) {
+        const __m128i tmp = _mm_alignr_epi8(msg[G % 4], msg[(G + 3) % 4], 4);
+        msg[(G + 1) % 4] = _mm_add_epi32(msg[(G + 1) % 4], tmp);
+        msg[(G + 1) % 4] = _mm_sha256msg2_epu32(msg[(G + 1) % 4], msg[G % 4]);
+    }
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0e));
+    if constexpr (G >= 1 && G <= 12)
+        msg[(G + 3) % 4] = _mm_sha256msg1_epu32(msg[(G + 3) % 4], msg[G % 4]);
+}
+
+template <int... G> static inline QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha256ShaNiBlock(__m128i &abef, __m128i &cdgh, __m128i (&msg)[4],
+                      std::integer_sequence<int, G...>)
+{
+    (sha256ShaNiRounds<G>(abef, cdgh, msg), ...);
+}
+
+static QT_FUNCTION_TARGET(SHA_SSE4_1)
+void sha256BlocksHw(uint32_t *state, const uchar *data, size_t blocks) noexcept
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // the SHA-NI instructions want the state as ABEF and CDGH
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0xb1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)), 0x1b);
+    __m128i abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    for ( ; blocks; --blocks, data += 64) {
+        const __m128i abefSaved = abef;
+        const __m128i cdghSaved = cdgh;
+        __m128i msg[4];
+        for (int i = 0; i < 4; ++i) {
+            msg[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i));
+            msg[i] = _mm_shuffle_epi8(msg[i], byteSwap);
+        }
+        sha256ShaNiBlock(abef, cdgh, msg, std::make_integer_sequence<int, 16>());
+        abef = _mm_add_epi32(abef, abefSaved);
+        cdgh = _mm_add_epi32(cdgh, cdghSaved);
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), _mm_alignr_epi8(cdgh, tmp, 8));
+}
+#  endif // QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+#endif // QCRYPTOGRAPHICHASH_SHA_KERNELS
+
+#ifndef USING_OPENSSL30
+// Like sha1Update(), but hands the whole blocks to the hardware if it can
+static void sha1AddData(Sha1State *state, const uchar *data, qint64 len) noexcept
+{
+#ifdef QCRYPTOGRAPHICHASH_SHA_KERNELS
+    if (len >= 64 && hasShaKernels()) {
+        if (const quint32 rest = quint32(state->messageSize & 63)) {
+            const qint64 fill = 64 - rest;
+            sha1Update(state, data, fill);
+            data += fill;
+            len -= fill;
+        }
+        if (const qint64 blocks = len / 64) {
+            quint32 h[5] = { state->h0, state->h1, state->h2, state->h3, state->h4 };
+            sha1BlocksHw(h, data, size_t(blocks));
+            state->h0 = h[0];
+            state->h1 = h[1];
+            state->h2 = h[2];
+            state->h3 = h[3];
+            state->h4 = h[4];
+            state->messageSize += quint64(blocks) * 64;
+            data += blocks * 64;
+            len -= blocks * 64;
+        }
+    }
+#endif
+    sha1Update(state, data, len);
+}
+#endif // !USING_OPENSSL30
+
+#if !defined(QT_CRYPTOGRAPHICHASH_ONLY_SHA1) && !QT_CONFIG(openssl_hash)
+// Like SHA256Input() (and SHA224Input()), but hands the whole blocks to the
+// hardware if it can
+static void sha256AddData(SHA256Context *context, const uchar *data, qsizetype len) noexcept
+{
+#ifdef QCRYPTOGRAPHICHASH_SHA_KERNELS
+    if (len >= 64 && !context->Computed && !context->Corrupted && hasShaKernels()) {
+        if (context->Message_Block_Index) {
+            const qsizetype fill = SHA256_Message_Block_Size - context->Message_Block_Index;
+            SHA256Input(context, data, unsigned(fill));
+            data += fill;
+            len -= fill;
+        }
+        if (const qsizetype blocks = len / 64) {
+            sha256BlocksHw(context->Intermediate_Hash, data, size_t(blocks));
+            const quint64 oldBits = quint64(context->Length_High) << 32 | context->Length_Low;
+            const quint64 bits = oldBits + quint64(blocks) * 512;
+            context->Length_High = uint32_t(bits >> 32);
+            context->Length_Low = uint32_t(bits);
+            if (bits < oldBits)
+                context->Corrupted = shaInputTooLong;
+            data += blocks * 64;
+            len -= blocks * 64;
+        }
+    }
+#endif
+    SHA256Input(context, data, unsigned(len));
+}
+#endif // !QT_CRYPTOGRAPHICHASH_ONLY_SHA1 && !openssl_hash
+
+#if !defined(QT_CRYPTOGRAPHICHASH_ONLY_SHA1) && !QT_CONFIG(openssl_hash) && defined(QCRYPTOGRAPHICHASH_AVX2)
+/*
+    Multi-buffer SHA-224/SHA-256: hashes eight independent messages at once,
+    one in each 32-bit lane of the AVX2 registers. Lanes that finish their
+    message are refilled with the next one, so all lanes stay busy until the
+    list runs dry.
+*/
+namespace {
+struct Sha256Lane
+{
+    const uchar *data;      // next whole block of the message
+    qsizetype dataBlocks;   // whole blocks left in data
+    int tailBlocks;         // padding blocks left in tail
+    int tailIndex;
+    qsizetype message;      // index of the message, or -1 if the lane is idle
+    uchar tail[2 * 64];     // the last partial block, padding and length
+
+    void start(qsizetype index, QByteArrayView msg) noexcept
+    {
+        message = index;
+        data = reinterpret_cast<const uchar *>(msg.data());
+        dataBlocks = msg.size() / 64;
+        const qsizetype rest = msg.size() % 64;
+        tailBlocks = rest < 56 ? 1 : 2;
+        tailIndex = 0;
+        memset(tail, 0, sizeof(tail));
+        if (rest)
+            memcpy(tail, data + dataBlocks * 64, size_t(rest));
+        tail[rest] = 0x80;
+        qToBigEndian(quint64(msg.size()) * 8, tail + tailBlocks * 64 - 8);
+    }
+
+    const uchar *nextBlock() noexcept
+    {
+        if (dataBlocks) {
+            --dataBlocks;
+            return std::exchange(data, data + 64);
+        }
+        --tailBlocks;
+        return tail + 64 * tailIndex++;
+    }
+
+    bool finished() const noexcept { return dataBlocks == 0 && tailBlocks == 0; }
+};
+} // unnamed namespace
+
+static inline QT_FUNCTION_TARGET(AVX2) __m256i sha256Rotate(__m256i x, int n)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+static inline QT_FUNCTION_TARGET(AVX2)
+void sha256Round(__m256i a, __m256i b, __m256i c, __m256i &d,
+                 __m256i e, __m256i f, __m256i g, __m256i &h, __m256i kw)
+{
+    const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(sha256Rotate(e, 6), sha256Rotate(e, 11)),
+                                        sha256Rotate(e, 25));
+    const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+    const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1), _mm256_add_epi32(ch, kw));
+    const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(sha256Rotate(a, 2), sha256Rotate(a, 13)),
+                                        sha256Rotate(a, 22));
+    const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b),
+                                        _mm256_and_si256(c, _mm256_or_si256(a, b)));
+    d = _mm256_add_epi32(d, t1);
+    h = _mm256_add_epi32(t1, _mm256_add_epi32(s0, maj));
+}
+
+// Loads 32 bytes from each of the eight blocks and transposes them, so that
+// w[i] holds big-endian word i (of those 32 bytes) of every lane
+static inline QT_FUNCTION_TARGET(AVX2)
+void sha256LoadWords(__m256i *w, const uchar *const (&blocks)[8], int offset)
+{
+    const __m256i byteSwap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i r[8];
+    for (int i = 0; i < 8; ++i)
+        r[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blocks[i] + offset));
+
+    __m256i t[8];
+    for (int i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    __m256i u[8];
+    for (int i = 0; i < 8; i += 4) {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        w[i] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i + 4], 0x20), byteSwap);
+        w[i + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i + 4], 0x31), byteSwap);
+    }
+}
+
+// Processes one block in each of the eight lanes; state[i][lane] is word i
+// of the lane's hash state
+static QT_FUNCTION_TARGET(AVX2)
+void sha256Blocks8(quint32 (&state)[8][8], const uchar *const (&blocks)[8]) noexcept
+{
+    __m256i w[16];
+    sha256LoadWords(w, blocks, 0);
+    sha256LoadWords(w + 8, blocks, 32);
+
+    __m256i v[8];
+    for (int i = 0; i < 8; ++i)
+        v[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(state[i]));
+    __m256i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+
+    for (int t = 0; t < 64; t += 8) {
+        __m256i kw[8];
+        for (int j = 0; j < 8; ++j) {
+            const int i = (t + j) & 15;
+            if (t >= 16) {
+                const __m256i w15 = w[(i + 1) & 15];
+                const __m256i w2 = w[(i + 14) & 15];
+                const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(sha256Rotate(w15, 7), sha256Rotate(w15, 18)),
+                                                    _mm256_srli_epi32(w15, 3));
+                const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(sha256Rotate(w2, 17), sha256Rotate(w2, 19)),
+                                                    _mm256_srli_epi32(w2, 10));
+                w[i] = _mm256_add_epi32(_mm256_add_epi32(w[i], s0),
+                                        _mm256_add_epi32(w[(i + 9) & 15], s1));
+            }
+            kw[j] = _mm256_add_epi32(w[i], _mm256_set1_epi32(int(sha256RoundConstants[t + j])));
+        }
+        sha256Round(a, b, c, d, e, f, g, h, kw[0]);
+        sha256Round(h, a, b, c, d, e, f, g, kw[1]);
+        sha256Round(g, h, a, b, c, d, e, f, kw[2]);
+        sha256Round(f, g, h, a, b, c, d, e, kw[3]);
+        sha256Round(e, f, g, h, a, b, c, d, kw[4]);
+        sha256Round(d, e, f, g, h, a, b, c, kw[5]);
+        sha256Round(c, d, e, f, g, h, a, b, kw[6]);
+        sha256Round(b, c, d, e, f, g, h, a, kw[7]);
+    }
+
+    const __m256i result[8] = { a, b, c, d, e, f, g, h };
+    for (int i = 0; i < 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(state[i]),
+                           _mm256_add_epi32(v[i], result[i]));
+    }
+}
+
+// Processes whole blocks, without touching the buffered data or the length
+static void sha256ProcessBlocks(SHA256Context *context, const uchar *data, size_t blocks) noexcept
+{
+#ifdef QCRYPTOGRAPHICHASH_SHA_KERNELS
+    if (hasShaKernels())
+        return sha256BlocksHw(context->Intermediate_Hash, data, blocks);
+#endif
+    SHA256Context copy = *context;
+    for ( ; blocks; --blocks, data += 64) {
+        memcpy(copy.Message_Block, data, 64);
+        SHA224_256ProcessMessageBlock(&copy);
+    }
+    memcpy(context->Intermediate_Hash, copy.Intermediate_Hash, sizeof(copy.Intermediate_Hash));
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+void sha256MultiBuffer(QSpan<const QByteArrayView> messages, const uint32_t *initialState,
+                       int hashLength, QByteArray *results)
+{
+    constexpr int Lanes = 8;
+    static const uchar idleBlock[64] = {};
+    Sha256Lane lanes[Lanes];
+    alignas(32) quint32 state[8][Lanes];
+    qsizetype nextMessage = 0;
+    int active = 0;
+
+    auto finish = [&](int lane, const quint32 *h, qsizetype stride) {
+        QByteArray &result = results[lanes[lane].message];
+        result.resize(hashLength);
+        for (int i = 0; i < hashLength / 4; ++i)
+            qToBigEndian(h[i * stride], result.data() + 4 * i);
+    };
+    auto startNext = [&](int lane) {
+        if (nextMessage == messages.size()) {
+            lanes[lane].message = -1;
+            return;
+        }
+        lanes[lane].start(nextMessage, messages[nextMessage]);
+        ++nextMessage;
+        ++active;
+        for (int i = 0; i < 8; ++i)
+            state[i][lane] = initialState[i];
+    };
+
+    for (int lane = 0; lane < Lanes; ++lane)
+        startNext(lane);
+
+    while (active) {
+        if (active == 1 && nextMessage == messages.size()) {
+            // one message left: finish it without the other seven lanes
+            int lane = 0;
+            while (lanes[lane].message < 0)
+                ++lane;
+            SHA256Context context = {};
+            for (int i = 0; i < 8; ++i)
+                context.Intermediate_Hash[i] = state[i][lane];
+            Sha256Lane &l = lanes[lane];
+            sha256ProcessBlocks(&context, l.data, size_t(l.dataBlocks));
+            sha256ProcessBlocks(&context, l.tail + 64 * l.tailIndex, size_t(l.tailBlocks));
+            finish(lane, context.Intermediate_Hash, 1);
+            break;
+        }
+
+        const uchar *blocks[Lanes];
+        for (int lane = 0; lane < Lanes; ++lane)
+            blocks[lane] = lanes[lane].message < 0 ? idleBlock : lanes[lane].nextBlock();
+        sha256Blocks8(state, blocks);
+
+        for (int lane = 0; lane < Lanes; ++lane) {
+            if (lanes[lane].message >= 0 && lanes[lane].finished()) {
+                finish(lane, &state[0][lane], Lanes);
+                --active;
+                startNext(lane);
+            }
+        }
+    }
+}
+#endif // multi-buffer SHA-256
+
+#if !defined(QT_CRYPTOGRAPHICHASH_ONLY_SHA1) && !QT_CONFIG(system_libb2) && defined(Q_PROCESSOR_X86)
+static inline QT_FUNCTION_TARGET(SSSE3) __m128i blake2sRotate(__m128i x, int n)
+{
+    return _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n));
+}
+
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(SSSE3)
+void blake2sG(__m128i &a, __m128i &b, __m128i &c, __m128i &d, __m128i x, __m128i y)
+{
+    const __m128i rotate16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m128i rotate8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    a = _mm_add_epi32(_mm_add_epi32(a, b), x);
+    d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotate16);
+    c = _mm_add_epi32(c, d);
+    b = blake2sRotate(_mm_xor_si128(b, c), 12);
+    a = _mm_add_epi32(_mm_add_epi32(a, b), y);
+    d = _mm_shuffle_epi8(_mm_xor_si128(d, a), rotate8);
+    c = _mm_add_epi32(c, d);
+    b = blake2sRotate(_mm_xor_si128(b, c), 7);
+}
+
+// One BLAKE2s round: the column step computes all four columns at once, then
+// the rows are rotated so that the diagonal step can do the same.
+template <int R> static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(SSSE3)
+void blake2sRound(__m128i &a, __m128i &b, __m128i &c, __m128i &d, const uint32_t *m)
+{
+    const uint8_t *s = blake2s_sigma[R];
+    blake2sG(a, b, c, d,
+             _mm_setr_epi32(int(m[s[0]]), int(m[s[2]]), int(m[s[4]]), int(m[s[6]])),
+             _mm_setr_epi32(int(m[s[1]]), int(m[s[3]]), int(m[s[5]]), int(m[s[7]])));
+    b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));
+    c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm_shuffle_epi32(d, _MM_SHUFFLE(2, 1, 0, 3));
+    blake2sG(a, b, c, d,
+             _mm_setr_epi32(int(m[s[8]]), int(m[s[10]]), int(m[s[12]]), int(m[s[14]])),
+             _mm_setr_epi32(int(m[s[9]]), int(m[s[11]]), int(m[s[13]]), int(m[s[15]])));
+    b = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));
+    c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm_shuffle_epi32(d, _MM_SHUFFLE(0, 3, 2, 1));
+}
+
+template <int... R> static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(SSSE3)
+void blake2sRounds(__m128i &a, __m128i &b, __m128i &c, __m128i &d, const uint32_t *m,
+                   std::integer_sequence<int, R...>)
+{
+    (blake2sRound<R>(a, b, c, d, m), ...);
+}
+
+// BLAKE2s with one row of the 4x4 state in each SSE register
+static QT_FUNCTION_TARGET(SSSE3)
+void blake2sCompressSsse3(blake2s_state *S, const uint8_t *block) noexcept
+{
+    uint32_t m[16];
+    memcpy(m, block, sizeof(m));
+
+    const __m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(S->h));
+    const __m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(S->h + 4));
+    __m128i a = h0;
+    __m128i b = h1;
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(blake2s_IV));
+    __m128i d = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(blake2s_IV + 4)),
+                              _mm_setr_epi32(int(S->t[0]), int(S->t[1]), int(S->f[0]), int(S->f[1])));
+    blake2sRounds(a, b, c, d, m, std::make_integer_sequence<int, 10>());
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(S->h), _mm_xor_si128(h0, _mm_xor_si128(a, c)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(S->h + 4), _mm_xor_si128(h1, _mm_xor_si128(b, d)));
+}
+
+#  ifdef QCRYPTOGRAPHICHASH_AVX2
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(AVX2)
+void blake2bG(__m256i &a, __m256i &b, __m256i &c, __m256i &d, __m256i x, __m256i y)
+{
+    const __m256i rotate24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                              3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+    const __m256i rotate16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                              2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);
+    d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1));
+    c = _mm256_add_epi64(c, d);
+    b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotate24);
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate16);
+    c = _mm256_add_epi64(c, d);
+    b = _mm256_xor_si256(b, c);
+    b = _mm256_or_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+}
+
+template <int R> static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(AVX2)
+void blake2bRound(__m256i &a, __m256i &b, __m256i &c, __m256i &d, const uint64_t *m)
+{
+    const uint8_t *s = blake2b_sigma[R];
+    blake2bG(a, b, c, d,
+             _mm256_setr_epi64x(qint64(m[s[0]]), qint64(m[s[2]]), qint64(m[s[4]]), qint64(m[s[6]])),
+             _mm256_setr_epi64x(qint64(m[s[1]]), qint64(m[s[3]]), qint64(m[s[5]]), qint64(m[s[7]])));
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+    c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+    blake2bG(a, b, c, d,
+             _mm256_setr_epi64x(qint64(m[s[8]]), qint64(m[s[10]]), qint64(m[s[12]]), qint64(m[s[14]])),
+             _mm256_setr_epi64x(qint64(m[s[9]]), qint64(m[s[11]]), qint64(m[s[13]]), qint64(m[s[15]])));
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+    c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+}
+
+template <int... R> static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(AVX2)
+void blake2bRounds(__m256i &a, __m256i &b, __m256i &c, __m256i &d, const uint64_t *m,
+                   std::integer_sequence<int, R...>)
+{
+    (blake2bRound<R>(a, b, c, d, m), ...);
+}
+
+// BLAKE2b with one row of the 4x4 state in each AVX2 register
+static QT_FUNCTION_TARGET(AVX2)
+void blake2bCompressAvx2(blake2b_state *S, const uint8_t *block) noexcept
+{
+    uint64_t m[16];
+    memcpy(m, block, sizeof(m));
+
+    const __m256i h0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(S->h));
+    const __m256i h1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(S->h + 4));
+    __m256i a = h0;
+    __m256i b = h1;
+    __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blake2b_IV));
+    __m256i d = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(blake2b_IV + 4)),
+                                 _mm256_setr_epi64x(qint64(S->t[0]), qint64(S->t[1]),
+                                                    qint64(S->f[0]), qint64(S->f[1])));
+    blake2bRounds(a, b, c, d, m, std::make_integer_sequence<int, 12>());
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(S->h), _mm256_xor_si256(h0, _mm256_xor_si256(a, c)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(S->h + 4), _mm256_xor_si256(h1, _mm256_xor_si256(b, d)));
+}
+#  endif // QCRYPTOGRAPHICHASH_AVX2
+#  define QCRYPTOGRAPHICHASH_BLAKE2_KERNELS
+#endif
+
+#ifndef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+// Like blake2b_update(), but using the SIMD compression function if the
+// CPU supports it
+static void blake2bAddData(blake2b_state *S, const uint8_t *in, size_t inlen) noexcept
+{
+#if defined(QCRYPTOGRAPHICHASH_BLAKE2_KERNELS) && defined(QCRYPTOGRAPHICHASH_AVX2)
+    // BLAKE2 keeps the last block buffered, as it has to be compressed with
+    // the finalization flag set. So only take over if there's more than that.
+    if (inlen > BLAKE2B_BLOCKBYTES && qCpuHasFeature(AVX2)) {
+        const size_t left = S->buflen;
+        const size_t fill = BLAKE2B_BLOCKBYTES - left;
+        if (inlen > fill) {
+            S->buflen = 0;
+            memcpy(S->buf + left, in, fill);
+            blake2b_increment_counter(S, BLAKE2B_BLOCKBYTES);
+            blake2bCompressAvx2(S, S->buf);
+            in += fill;
+            inlen -= fill;
+            while (inlen > BLAKE2B_BLOCKBYTES) {
+                blake2b_increment_counter(S, BLAKE2B_BLOCKBYTES);
+                blake2bCompressAvx2(S, in);
+                in += BLAKE2B_BLOCKBYTES;
+                inlen -= BLAKE2B_BLOCKBYTES;
+            }
+        }
+        memcpy(S->buf + S->buflen, in, inlen);
+        S->buflen += inlen;
+        return;
+    }
+#endif
+    blake2b_update(S, in, inlen);
+}
+
+// Like blake2s_update(), but using the SIMD compression function if the
+// CPU supports it
+static void blake2sAddData(blake2s_state *S, const uint8_t *in, size_t inlen) noexcept
+{
+#if defined(QCRYPTOGRAPHICHASH_BLAKE2_KERNELS)
+    if (inlen > BLAKE2S_BLOCKBYTES && qCpuHasFeature(SSSE3)) {
+        const size_t left = S->buflen;
+        const size_t fill = BLAKE2S_BLOCKBYTES - left;
+        if (inlen > fill) {
+            S->buflen = 0;
+            memcpy(S->buf + left, in, fill);
+            blake2s_increment_counter(S, BLAKE2S_BLOCKBYTES);
+            blake2sCompressSsse3(S, S->buf);
+            in += fill;
+            inlen -= fill;
+            while (inlen > BLAKE2S_BLOCKBYTES) {
+                blake2s_increment_counter(S, BLAKE2S_BLOCKBYTES);
+                blake2sCompressSsse3(S, in);
+                in += BLAKE2S_BLOCKBYTES;
+                inlen -= BLAKE2S_BLOCKBYTES;
+            }
+        }
+        memcpy(S->buf + S->buflen, in, inlen);
+        S->buflen += inlen;
+        return;
+    }
+#endif
+    blake2s_update(S, in, inlen);
+}
+#endif // QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+
 #ifdef USING_OPENSSL30
 static constexpr const char * methodToName(QCryptographicHash::Algorithm method) noexcept
 {
@@ -786,11 +1419,11 @@ void QCryptographicHashPrivate::State::addData(QCryptographicHash::Algorithm met
         } else if (method == QCryptographicHash::Blake2b_160 ||
                    method == QCryptographicHash::Blake2b_256 ||
                    method == QCryptographicHash::Blake2b_384) {
-            blake2b_update(&blake2bContext, reinterpret_cast<const uint8_t *>(data), length);
+            blake2bAddData(&blake2bContext, reinterpret_cast<const uint8_t *>(data), length);
         } else if (method == QCryptographicHash::Blake2s_128 ||
                 method == QCryptographicHash::Blake2s_160 ||
                 method == QCryptographicHash::Blake2s_224) {
-            blake2s_update(&blake2sContext, reinterpret_cast<const uint8_t *>(data), length);
+            blake2sAddData(&blake2sContext, reinterpret_cast<const uint8_t *>(data), length);
         } else if (!evp.initializationFailed) {
             EVP_DigestUpdate(evp.context.get(), (const unsigned char *)data, length);
         }
@@ -816,7 +1449,7 @@ void QCryptographicHashPrivate::State::addData(QCryptographicHash::Algorithm met
 #endif
         switch (method) {
         case QCryptographicHash::Sha1:
-            sha1Update(&sha1Context, (const unsigned char *)data, length);
+            sha1AddData(&sha1Context, (const unsigned char *)data, length);
             break;
 #ifdef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
         default:
@@ -831,10 +1464,10 @@ void QCryptographicHashPrivate::State::addData(QCryptographicHash::Algorithm met
             MD5Update(&md5Context, (const unsigned char *)data, length);
             break;
         case QCryptographicHash::Sha224:
-            SHA224Input(&sha224Context, reinterpret_cast<const unsigned char *>(data), length);
+            sha256AddData(&sha224Context, reinterpret_cast<const unsigned char *>(data), length);
             break;
         case QCryptographicHash::Sha256:
-            SHA256Input(&sha256Context, reinterpret_cast<const unsigned char *>(data), length);
+            sha256AddData(&sha256Context, reinterpret_cast<const unsigned char *>(data), length);
             break;
         case QCryptographicHash::Sha384:
             SHA384Input(&sha384Context, reinterpret_cast<const unsigned char *>(data), length);
@@ -856,13 +1489,13 @@ void QCryptographicHashPrivate::State::addData(QCryptographicHash::Algorithm met
         case QCryptographicHash::Blake2b_256:
         case QCryptographicHash::Blake2b_384:
         case QCryptographicHash::Blake2b_512:
-            blake2b_update(&blake2bContext, reinterpret_cast<const uint8_t *>(data), length);
+            blake2bAddData(&blake2bContext, reinterpret_cast<const uint8_t *>(data), length);
             break;
         case QCryptographicHash::Blake2s_128:
         case QCryptographicHash::Blake2s_160:
         case QCryptographicHash::Blake2s_224:
         case QCryptographicHash::Blake2s_256:
-            blake2s_update(&blake2sContext, reinterpret_cast<const uint8_t *>(data), length);
+            blake2sAddData(&blake2sContext, reinterpret_cast<const uint8_t *>(data), length);
             break;
 #endif
         case QCryptographicHash::NumAlgorithms:
@@ -1142,6 +1775,39 @@ QByteArrayView QCryptographicHash::hashInto(QSpan<std::byte> buffer,
     return buffer.first(result.size());
 }
 
+/*!
+    \since 6.10
+
+    Returns the hashes of each of the \a messages, calculated using \a method,
+    in the same order as the messages.
+
+    The result is the same as calling hash() for each message, but this
+    function can be considerably faster when hashing many messages: where the
+    CPU supports it, several messages are processed at once, each in its own
+    lane of the SIMD registers. Currently this is done for SHA-224 and SHA-256
+    on x86 processors with AVX2; other algorithms and processors hash the
+    messages one after the other.
+
+    \sa hash(), hashInto()
+*/
+QList<QByteArray> QCryptographicHash::hashMany(QSpan<const QByteArrayView> messages,
+                                               Algorithm method)
+{
+    QList<QByteArray> results(messages.size());
+#if !defined(QT_CRYPTOGRAPHICHASH_ONLY_SHA1) && !QT_CONFIG(openssl_hash) && defined(QCRYPTOGRAPHICHASH_AVX2)
+    // Eight lanes of AVX2 beat even the SHA extensions, which only work on
+    // one message at a time.
+    if ((method == Sha224 || method == Sha256) && messages.size() > 1 && qCpuHasFeature(AVX2)) {
+        sha256MultiBuffer(messages, method == Sha224 ? SHA224_H0 : SHA256_H0,
+                          hashLengthInternal(method), results.data());
+        return results;
+    }
+#endif
+    for (qsizetype i = 0; i < messages.size(); ++i)
+        results[i] = hash(messages[i], method);
+    return results;
+}
+
 /*!
   Returns the size of the output of the selected hash \a method in bytes.
 
@@ -7,6 +7,7 @@
 #define QCRYPTOGRAPHICHASH_H
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
 #include <QtCore/qobjectdefs.h>
 #include <QtCore/qspan.h>
 
@@ -104,6 +105,7 @@ public:
     static QByteArrayView hashInto(QSpan<uchar> buffer, QSpan<const QByteArrayView> data, Algorithm method) noexcept
     { return hashInto(as_writable_bytes(buffer), data, method); }
     static QByteArrayView hashInto(QSpan<std::byte> buffer, QSpan<const QByteArrayView> data, Algorithm method) noexcept;
+    static QList<QByteArray> hashMany(QSpan<const QByteArrayView> messages, Algorithm method);
 
     static int hashLength(Algorithm method);
     static bool supportsAlgorithm(Algorithm method);
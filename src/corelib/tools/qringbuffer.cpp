@@ -70,6 +70,31 @@ const char *QRingBuffer::readPointerAtPosition(qint64 pos, qint64 &length) const
     return nullptr;
 }
 
+/*!
+    \internal
+
+    Fills \a blocks with the buffered chunks in order, covering at most
+    \a maxLength bytes, and returns the part of \a blocks that was used.
+    This lets the whole buffer be written with one vectored system call.
+*/
+QSpan<QByteArrayView> QRingBuffer::readPointers(QSpan<QByteArrayView> blocks,
+                                                qint64 maxLength) const
+{
+    Q_ASSERT(maxLength >= 0);
+
+    qsizetype count = 0;
+    for (const QRingChunk &chunk : buffers) {
+        if (count == blocks.size() || maxLength == 0)
+            break;
+        const qint64 length = qMin(qint64(chunk.size()), maxLength);
+        if (length == 0)
+            continue;
+        blocks[count++] = QByteArrayView(chunk.data(), length);
+        maxLength -= length;
+    }
+    return blocks.first(count);
+}
+
 void QRingBuffer::free(qint64 bytes)
 {
     Q_ASSERT(bytes <= bufferSize);
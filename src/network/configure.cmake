@@ -125,6 +125,26 @@ socklen_t sctpInitMsgSize = sizeof(sctpInitMsg);
 "# FIXME: use: unmapped library: network
 )
 
+# sendmmsg
+qt_config_compile_test(sendmmsg
+    LABEL "sendmmsg() and recvmmsg()"
+    CODE
+"#define _GNU_SOURCE 1
+#include <sys/types.h>
+#include <sys/socket.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+struct mmsghdr msgs[2] = {};
+(void) sendmmsg(-1, msgs, 2, 0);
+(void) recvmmsg(-1, msgs, 2, MSG_DONTWAIT, 0);
+    /* END TEST: */
+    return 0;
+}
+"
+)
+
 # dtls
 qt_config_compile_test(dtls
     LABEL "DTLS support in OpenSSL"
@@ -215,6 +235,10 @@ qt_feature("linux-netlink" PRIVATE
     LABEL "Linux AF_NETLINK"
     CONDITION LINUX AND NOT ANDROID AND TEST_linux_netlink
 )
+qt_feature("sendmmsg" PRIVATE
+    LABEL "sendmmsg()/recvmmsg()"
+    CONDITION UNIX AND TEST_sendmmsg
+)
 qt_feature("res_setservers" PRIVATE
     LABEL "res_setservers()"
     CONDITION QT_FEATURE_libresolv AND TEST_res_setservers
@@ -377,6 +401,7 @@ qt_configure_add_summary_entry(
 qt_configure_add_summary_entry(ARGS "dtls")
 qt_configure_add_summary_entry(ARGS "ocsp")
 qt_configure_add_summary_entry(ARGS "sctp")
+qt_configure_add_summary_entry(ARGS "sendmmsg")
 qt_configure_add_summary_entry(ARGS "system-proxies")
 qt_configure_add_summary_entry(ARGS "gssapi")
 qt_configure_add_summary_entry(ARGS "brotli")
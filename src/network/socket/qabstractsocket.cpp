@@ -433,6 +433,7 @@
 #include "qabstractsocket_p.h"
 
 #include "private/qhostinfo_p.h"
+#include "private/qnativesocketengine_p.h"
 
 #include <qabstracteventdispatcher.h>
 #include <qhostaddress.h>
@@ -441,10 +442,15 @@
 #include <qpointer.h>
 #include <qtimer.h>
 #include <qdeadlinetimer.h>
+#include <qfile.h>
 #include <qscopedvaluerollback.h>
+#include <qscopeguard.h>
 #include <qvarlengtharray.h>
 
 #include <private/qthread_p.h>
+#ifdef Q_OS_UNIX
+#include <private/qcore_unix_p.h>
+#endif
 
 #ifdef QABSTRACTSOCKET_DEBUG
 #include <qdebug.h>
@@ -504,6 +510,7 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
 */
 QAbstractSocketPrivate::~QAbstractSocketPrivate()
 {
+    clearFileTransfers();
 }
 
 /*! \internal
@@ -517,6 +524,7 @@ void QAbstractSocketPrivate::resetSocketLayer()
 #endif
 
     hasPendingData = false;
+    clearFileTransfers();
     if (socketEngine) {
         socketEngine->close();
         socketEngine->disconnect();
@@ -741,7 +749,7 @@ void QAbstractSocketPrivate::connectionNotification()
 
 /*! \internal
 
-    Writes one pending data block in the write buffer to the socket.
+    Writes the pending data blocks in the write buffer to the socket.
 
     It is usually invoked by canWriteNotification after one or more
     calls to write().
@@ -751,7 +759,7 @@ void QAbstractSocketPrivate::connectionNotification()
 bool QAbstractSocketPrivate::writeToSocket()
 {
     Q_Q(QAbstractSocket);
-    if (!socketEngine || !socketEngine->isValid() || (writeBuffer.isEmpty()
+    if (!socketEngine || !socketEngine->isValid() || (!hasDataToWrite()
         && socketEngine->bytesToWrite() == 0)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocketPrivate::writeToSocket() nothing to do: valid ? %s, writeBuffer.isEmpty() ? %s",
@@ -769,11 +777,25 @@ bool QAbstractSocketPrivate::writeToSocket()
         return false;
     }
 
-    qint64 nextSize = writeBuffer.nextDataBlockSize();
-    const char *ptr = writeBuffer.readPointer();
-
-    // Attempt to write it all in one chunk.
-    qint64 written = nextSize ? socketEngine->write(ptr, nextSize) : Q_INT64_C(0);
+    qint64 written;
+    FileTransfer *transfer = fileTransfers.isEmpty() ? nullptr : &fileTransfers.first();
+    if (transfer && transfer->bufferOffset == 0) {
+        // Everything written before the file has been sent, so send the file.
+        written = socketEngine->writeFromFile(transfer->fd, transfer->offset, transfer->size);
+    } else {
+        // Hand as many buffered chunks as possible to the socket engine at
+        // once, so that many small writes cost a single system call.
+        QByteArrayView blocks[MaxWriteBlocks];
+        const QSpan<QByteArrayView> pending =
+                writeBuffer.readPointers(blocks, transfer ? transfer->bufferOffset : writeBuffer.size());
+        if (pending.isEmpty())
+            written = 0;
+        else if (pending.size() == 1)
+            written = socketEngine->write(pending[0].data(), pending[0].size());
+        else
+            written = socketEngine->writeBlocks(pending);
+        transfer = nullptr;
+    }
     if (written < 0) {
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug() << "QAbstractSocketPrivate::writeToSocket() write error, aborting."
@@ -792,13 +814,26 @@ bool QAbstractSocketPrivate::writeToSocket()
 
     if (written > 0) {
         // Remove what we wrote so far.
-        writeBuffer.free(written);
+        if (transfer) {
+            transfer->offset += written;
+            transfer->size -= written;
+            if (transfer->size == 0) {
+#ifdef Q_OS_UNIX
+                qt_safe_close(transfer->fd);
+#endif
+                fileTransfers.removeFirst();
+            }
+        } else {
+            writeBuffer.free(written);
+            for (FileTransfer &pending : fileTransfers)
+                pending.bufferOffset -= written;
+        }
 
         // Emit notifications.
         emitBytesWritten(written);
     }
 
-    if (writeBuffer.isEmpty() && socketEngine && !socketEngine->bytesToWrite())
+    if (!hasDataToWrite() && socketEngine && !socketEngine->bytesToWrite())
         socketEngine->setWriteNotificationEnabled(false);
     if (state == QAbstractSocket::ClosingState)
         q->disconnectFromHost();
@@ -816,12 +851,38 @@ bool QAbstractSocketPrivate::flush()
 {
     bool dataWasWritten = false;
 
-    while (!allWriteBuffersEmpty() && writeToSocket())
+    while ((!allWriteBuffersEmpty() || !fileTransfers.isEmpty()) && writeToSocket())
         dataWasWritten = true;
 
     return dataWasWritten;
 }
 
+/*! \internal
+
+    Returns the number of bytes of the files queued with sendFile() that
+    have not been written yet.
+*/
+qint64 QAbstractSocketPrivate::pendingFileBytes() const
+{
+    qint64 size = 0;
+    for (const FileTransfer &transfer : fileTransfers)
+        size += transfer.size;
+    return size;
+}
+
+/*! \internal
+
+    Drops the files queued with sendFile().
+*/
+void QAbstractSocketPrivate::clearFileTransfers()
+{
+#ifdef Q_OS_UNIX
+    for (const FileTransfer &transfer : std::as_const(fileTransfers))
+        qt_safe_close(transfer.fd);
+#endif
+    fileTransfers.clear();
+}
+
 #ifndef QT_NO_NETWORKPROXY
 /*! \internal
 
@@ -1740,7 +1801,8 @@ void QAbstractSocket::connectToHost(const QHostAddress &address, quint16 port,
 */
 qint64 QAbstractSocket::bytesToWrite() const
 {
-    const qint64 pendingBytes = QIODevice::bytesToWrite();
+    Q_D(const QAbstractSocket);
+    const qint64 pendingBytes = QIODevice::bytesToWrite() + d->pendingFileBytes();
 #if defined(QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocket::bytesToWrite() == %lld", pendingBytes);
 #endif
@@ -2165,7 +2227,7 @@ bool QAbstractSocket::waitForReadyRead(int msecs)
 
         bool readyToRead = false;
         bool readyToWrite = false;
-        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, !d->writeBuffer.isEmpty(),
+        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, d->hasDataToWrite(),
                                                  deadline)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2217,7 +2279,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         return false;
     }
 
-    if (d->writeBuffer.isEmpty())
+    if (!d->hasDataToWrite())
         return false;
 
     QDeadlineTimer deadline{msecs};
@@ -2233,7 +2295,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite,
                                   !d->readBufferMaxSize || d->buffer.size() < d->readBufferMaxSize,
-                                  !d->writeBuffer.isEmpty(),
+                                  d->hasDataToWrite(),
                                   deadline)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForBytesWritten(%i) failed (%i, %s)",
@@ -2312,7 +2374,7 @@ bool QAbstractSocket::waitForDisconnected(int msecs)
         bool readyToRead = false;
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, state() == ConnectedState,
-                                               !d->writeBuffer.isEmpty(),
+                                               d->hasDataToWrite(),
                                                deadline)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2379,6 +2441,83 @@ bool QAbstractSocket::flush()
     return d_func()->flush();
 }
 
+/*!
+    \since 6.10
+
+    Queues \a size bytes of \a file, starting at \a offset, for sending
+    after any data already written to the socket, and returns the number of
+    bytes queued, or -1 on error. If \a size is negative, the rest of the
+    file after \a offset is sent.
+
+    Like data passed to write(), the contents of the file are sent when
+    control returns to the event loop, or when flush() or
+    waitForBytesWritten() is called, and bytesWritten() is emitted as they
+    are. They are counted in bytesToWrite() until they have been sent.
+
+    Where possible, on a TCP socket that is connecting or connected without
+    a proxy, the socket keeps its own handle to the file, and the operating
+    system copies the data from the file to the network directly (using
+    \c sendfile() on Linux). \a file can then be closed, but it should not
+    be truncated until the data has been sent. Otherwise, for instance on
+    encrypted or proxied sockets, the range of the file is read right away
+    and written to the socket as with write(), without changing the
+    position of \a file.
+
+    \sa write(), bytesToWrite()
+*/
+qint64 QAbstractSocket::sendFile(QFile *file, qint64 offset, qint64 size)
+{
+    Q_D(QAbstractSocket);
+    if (!isWritable()) {
+        qWarning("QAbstractSocket::sendFile: device not open for writing");
+        return -1;
+    }
+    if (!file || !file->isReadable()) {
+        qWarning("QAbstractSocket::sendFile: file not open for reading");
+        return -1;
+    }
+
+    const qint64 fileSize = file->size();
+    if (offset < 0 || offset > fileSize)
+        return -1;
+    if (size < 0 || size > fileSize - offset)
+        size = fileSize - offset;
+    if (size == 0)
+        return 0;
+
+#ifdef Q_OS_UNIX
+    // Only the native engine writes straight to the socket; the proxy engines
+    // would read the file lazily through the default writeFromFile().
+    if (d->socketType == TcpSocket && qobject_cast<QNativeSocketEngine *>(d->socketEngine)
+        && file->handle() != -1) {
+        const int fd = qt_safe_dup(file->handle());
+        if (fd != -1) {
+            d->fileTransfers.append({ fd, offset, size, d->writeBuffer.size() });
+            d->socketEngine->setWriteNotificationEnabled(true);
+            return size;
+        }
+    }
+#endif
+
+    const qint64 position = file->pos();
+    const auto restorePosition = qScopeGuard([&] { file->seek(position); });
+    if (!file->seek(offset))
+        return -1;
+
+    QVarLengthArray<char, 16384> chunk(16384);
+    qint64 queued = 0;
+    while (queued < size) {
+        const qint64 read = file->read(chunk.data(), qMin(qint64(chunk.size()), size - queued));
+        if (read <= 0)
+            break;
+        const qint64 written = write(chunk.data(), read);
+        if (written < 0)
+            return queued ? queued : -1;
+        queued += written;
+    }
+    return queued;
+}
+
 /*! \reimp
 */
 qint64 QAbstractSocket::readData(char *data, qint64 maxSize)
@@ -2431,7 +2570,7 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
     }
 
     if (!d->isBuffered && d->socketType == TcpSocket
-        && d->socketEngine && d->writeBuffer.isEmpty()) {
+        && d->socketEngine && !d->hasDataToWrite()) {
         // This code is for the new Unbuffered QTcpSocket use case
         qint64 written = size ? d->socketEngine->write(data, size) : Q_INT64_C(0);
         if (written < 0) {
@@ -2659,7 +2798,7 @@ void QAbstractSocket::disconnectFromHost()
 
         // Wait for pending data to be written.
         if (d->socketEngine && d->socketEngine->isValid() && (!d->allWriteBuffersEmpty()
-            || d->socketEngine->bytesToWrite() > 0)) {
+            || !d->fileTransfers.isEmpty() || d->socketEngine->bytesToWrite() > 0)) {
             d->socketEngine->setWriteNotificationEnabled(true);
 
 #if defined(QABSTRACTSOCKET_DEBUG)
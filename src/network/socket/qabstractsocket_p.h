@@ -92,9 +92,27 @@ public:
 #endif
     inline void resolveProxy(quint16 port) { resolveProxy(QString(), port); }
 
+    // Upper bound for the write buffer chunks handed to the socket engine
+    // in one writeToSocket() call.
+    static constexpr qsizetype MaxWriteBlocks = 64;
+
     void resetSocketLayer();
     virtual bool flush();
 
+    // A range of a file queued with sendFile(), which goes out after the
+    // first bufferOffset bytes in the write buffer.
+    struct FileTransfer
+    {
+        int fd;
+        qint64 offset;
+        qint64 size;
+        qint64 bufferOffset;
+    };
+    QList<FileTransfer> fileTransfers;
+    qint64 pendingFileBytes() const;
+    void clearFileTransfers();
+    bool hasDataToWrite() const { return !writeBuffer.isEmpty() || !fileTransfers.isEmpty(); }
+
     bool initSocketLayer(QAbstractSocket::NetworkLayerProtocol protocol);
     virtual void configureCreatedSocket();
     void startConnectingByName(const QString &host);
@@ -7,6 +7,11 @@
 
 #include "qmutex.h"
 #include "qnetworkproxy.h"
+#include "qvarlengtharray.h"
+
+#ifdef Q_OS_UNIX
+#include <private/qcore_unix_p.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -233,6 +238,123 @@ int QAbstractSocketEngine::outboundStreamCount() const
     return d_func()->outboundStreamCount;
 }
 
+/*!
+    \internal
+
+    Writes up to \a len bytes, read from the file descriptor \a fd starting
+    at \a offset, to the socket. Returns the number of bytes written, or -1
+    if an error occurred, including reaching the end of the file early.
+
+    This implementation reads a bounded chunk of the file and calls write().
+    Socket engines that can copy from a file without going through user
+    space override it.
+*/
+qint64 QAbstractSocketEngine::writeFromFile(int fd, qint64 offset, qint64 len)
+{
+#ifdef Q_OS_UNIX
+    QVarLengthArray<char, 16384> chunk(16384);
+    ssize_t read;
+    QT_EINTR_LOOP(read, ::pread(fd, chunk.data(), size_t(qMin(qint64(chunk.size()), len)), off_t(offset)));
+    if (read <= 0) {
+        setError(QAbstractSocket::UnknownSocketError,
+                 read < 0 ? qt_error_string(errno)
+                          : QAbstractSocketEngine::tr("Unexpected end of file"));
+        return -1;
+    }
+    return write(chunk.data(), read);
+#else
+    Q_UNUSED(fd);
+    Q_UNUSED(offset);
+    Q_UNUSED(len);
+    setError(QAbstractSocket::UnsupportedSocketOperationError,
+             QAbstractSocketEngine::tr("Unsupported socket operation"));
+    return -1;
+#endif
+}
+
+/*!
+    \internal
+
+    Writes the \a blocks to the socket, in order, as one stream of data.
+    Returns the number of bytes written, which may end in the middle of a
+    block, or -1 if an error occurred before anything was written. An error
+    after some blocks were written is left for the next call to report.
+
+    This implementation calls write() for each block until one of them is
+    not written completely. Socket engines that can hand several buffers to
+    the system at once override it.
+*/
+qint64 QAbstractSocketEngine::writeBlocks(QSpan<const QByteArrayView> blocks)
+{
+    qint64 total = 0;
+    for (QByteArrayView block : blocks) {
+        const qint64 written = write(block.data(), block.size());
+        if (written < 0)
+            return total > 0 ? total : -1;
+        total += written;
+        if (written < block.size())
+            break;
+    }
+    return total;
+}
+
+#ifndef QT_NO_UDPSOCKET
+/*!
+    \internal
+
+    Receives up to \c{datagrams.size()} datagrams, each into its own
+    equally sized slot of \a buffer, and returns how many were received, or
+    -1 if an error occurred before any datagram was received.
+
+    This implementation calls readDatagram() for each datagram. Socket
+    engines that can receive several datagrams with one call override it.
+*/
+qsizetype QAbstractSocketEngine::readDatagrams(QSpan<char> buffer,
+                                               QSpan<QUdpSocket::BatchDatagram> datagrams)
+{
+    const qsizetype slotSize = buffer.size() / datagrams.size();
+    QIpPacketHeader header;
+    qsizetype count = 0;
+    while (count < datagrams.size() && hasPendingDatagrams()) {
+        char *slot = buffer.data() + count * slotSize;
+        const qint64 size = readDatagram(slot, slotSize, &header, WantDatagramSender);
+        if (size < 0) {
+            if (size == -1 && count == 0)
+                return -1;
+            break;
+        }
+        QUdpSocket::BatchDatagram &datagram = datagrams[count++];
+        datagram.data = QByteArrayView(slot, size);
+        datagram.address = header.senderAddress;
+        datagram.port = header.senderPort;
+    }
+    return count;
+}
+
+/*!
+    \internal
+
+    Sends \a datagrams and returns how many were sent, -2 if none could be
+    sent because the socket's buffer is full, or -1 if an error occurred
+    before any datagram was sent.
+
+    This implementation calls writeDatagram() for each datagram. Socket
+    engines that can send several datagrams with one call override it.
+*/
+qsizetype QAbstractSocketEngine::writeDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams)
+{
+    qsizetype count = 0;
+    for (const QUdpSocket::BatchDatagram &datagram : datagrams) {
+        QIpPacketHeader header(datagram.address, datagram.port);
+        const qint64 sent = writeDatagram(datagram.data.data(), datagram.data.size(), header);
+        if (sent < 0)
+            return count ? count : qsizetype(sent);
+        ++count;
+    }
+    return count;
+}
+#endif // QT_NO_UDPSOCKET
+
 QT_END_NAMESPACE
 
 #include "moc_qabstractsocketengine_p.cpp"
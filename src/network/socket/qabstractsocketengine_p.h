@@ -19,6 +19,7 @@
 #include <QtNetwork/private/qtnetworkglobal_p.h>
 #include "QtNetwork/qhostaddress.h"
 #include "QtNetwork/qabstractsocket.h"
+#include "QtNetwork/qudpsocket.h"
 #include <QtCore/qdeadlinetimer.h>
 #include "private/qnetworkdatagram_p.h"
 #include "private/qobject_p.h"
@@ -74,7 +75,8 @@ public:
         ReceivePacketInformation,
         ReceiveHopLimit,
         MaxStreamsSocketOption,
-        PathMtuInformation
+        PathMtuInformation,
+        PortReusable
     };
 
     enum PacketHeaderOption {
@@ -108,6 +110,8 @@ public:
 
     virtual qint64 read(char *data, qint64 maxlen) = 0;
     virtual qint64 write(const char *data, qint64 len) = 0;
+    virtual qint64 writeFromFile(int fd, qint64 offset, qint64 len);
+    virtual qint64 writeBlocks(QSpan<const QByteArrayView> blocks);
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -121,6 +125,9 @@ public:
 
     virtual bool hasPendingDatagrams() const = 0;
     virtual qint64 pendingDatagramSize() const = 0;
+
+    virtual qsizetype readDatagrams(QSpan<char> buffer, QSpan<QUdpSocket::BatchDatagram> datagrams);
+    virtual qsizetype writeDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams);
 #endif // QT_NO_UDPSOCKET
 
     virtual qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader *header = nullptr,
@@ -806,6 +806,57 @@ qint64 QNativeSocketEngine::pendingDatagramSize() const
 
     return d->nativePendingDatagramSize();
 }
+
+/*!
+    Receives up to \c{datagrams.size()} datagrams, each into its own
+    equally sized slot of \a buffer, and stores the payload and sender of
+    each in \a datagrams. Returns the number of datagrams received, which is
+    0 if none were pending, or -1 if an error occurred.
+
+    On platforms with recvmmsg(), all datagrams are received with a single
+    system call.
+
+    \sa writeDatagrams()
+*/
+qsizetype QNativeSocketEngine::readDatagrams(QSpan<char> buffer,
+                                             QSpan<QUdpSocket::BatchDatagram> datagrams)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::readDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::readDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+
+#if QT_CONFIG(sendmmsg)
+    return d->nativeReceiveDatagrams(buffer, datagrams);
+#else
+    return QAbstractSocketEngine::readDatagrams(buffer, datagrams);
+#endif
+}
+
+/*!
+    Sends \a datagrams, each to the address and port it contains, or to
+    the peer if its port is 0. Returns the number of datagrams sent, -2 if
+    none could be sent because the send buffer is full, or -1 if an error
+    occurred before any datagram was sent.
+
+    On platforms with sendmmsg(), all datagrams are sent with a single
+    system call.
+
+    \sa readDatagrams()
+*/
+qsizetype QNativeSocketEngine::writeDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::writeDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+
+#if QT_CONFIG(sendmmsg)
+    return d->nativeSendDatagrams(datagrams);
+#else
+    return QAbstractSocketEngine::writeDatagrams(datagrams);
+#endif
+}
 #endif // QT_NO_UDPSOCKET
 
 /*!
@@ -882,6 +933,45 @@ qint64 QNativeSocketEngine::write(const char *data, qint64 size)
     return d->nativeWrite(data, size);
 }
 
+/*!
+    Writes up to \a size bytes of the file \a fd, starting at \a offset, to
+    the socket. Returns the number of bytes written, or -1 if an error
+    occurred.
+
+    On Linux, the data is copied by the kernel without going through user
+    space.
+*/
+qint64 QNativeSocketEngine::writeFromFile(int fd, qint64 offset, qint64 size)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeFromFile(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeFromFile(), QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_LINUX
+    const qint64 written = d->nativeSendFile(fd, offset, size);
+    if (written != -2)
+        return written;
+#endif
+    return QAbstractSocketEngine::writeFromFile(fd, offset, size);
+}
+
+/*!
+    Writes the \a blocks to the socket as one stream of data. Returns the
+    number of bytes written, or -1 if an error occurred.
+
+    On Unix, all blocks are passed to a single writev() call.
+*/
+qint64 QNativeSocketEngine::writeBlocks(QSpan<const QByteArrayView> blocks)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeBlocks(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeBlocks(), QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_UNIX
+    return d->nativeWriteBlocks(blocks);
+#else
+    return QAbstractSocketEngine::writeBlocks(blocks);
+#endif
+}
+
 
 qint64 QNativeSocketEngine::bytesToWrite() const
 {
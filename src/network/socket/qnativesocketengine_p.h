@@ -123,6 +123,8 @@ public:
 
     qint64 read(char *data, qint64 maxlen) override;
     qint64 write(const char *data, qint64 len) override;
+    qint64 writeFromFile(int fd, qint64 offset, qint64 len) override;
+    qint64 writeBlocks(QSpan<const QByteArrayView> blocks) override;
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -136,6 +138,10 @@ public:
 
     bool hasPendingDatagrams() const override;
     qint64 pendingDatagramSize() const override;
+
+    qsizetype readDatagrams(QSpan<char> buffer,
+                            QSpan<QUdpSocket::BatchDatagram> datagrams) override;
+    qsizetype writeDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams) override;
 #endif // QT_NO_UDPSOCKET
 
     qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader * = nullptr,
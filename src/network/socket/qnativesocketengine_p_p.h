@@ -79,6 +79,11 @@ public:
 
     QSocketNotifier *readNotifier, *writeNotifier, *exceptNotifier;
 
+#if QT_CONFIG(sendmmsg)
+    // set when the kernel or the route refuses UDP segmentation offload
+    bool segmentationOffloadFailed = false;
+#endif
+
 #if defined(Q_OS_WIN)
     LPFN_WSASENDMSG sendmsg;
     LPFN_WSARECVMSG recvmsg;
@@ -144,8 +149,20 @@ public:
     qint64 nativeReceiveDatagram(char *data, qint64 maxLength, QIpPacketHeader *header,
                                  QAbstractSocketEngine::PacketHeaderOptions options);
     qint64 nativeSendDatagram(const char *data, qint64 length, const QIpPacketHeader &header);
+#if QT_CONFIG(sendmmsg)
+    qsizetype nativeReceiveDatagrams(QSpan<char> buffer,
+                                     QSpan<QUdpSocket::BatchDatagram> datagrams);
+    qsizetype nativeSendDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams);
+#endif
     qint64 nativeRead(char *data, qint64 maxLength);
     qint64 nativeWrite(const char *data, qint64 length);
+#ifdef Q_OS_UNIX
+    qint64 nativeWriteBlocks(QSpan<const QByteArrayView> blocks);
+    qint64 nativeWriteError();
+#endif
+#ifdef Q_OS_LINUX
+    qint64 nativeSendFile(int fd, qint64 offset, qint64 length);
+#endif
     int nativeSelect(QDeadlineTimer deadline, bool selectForRead) const;
     int nativeSelect(QDeadlineTimer deadline, bool checkRead, bool checkWrite,
                      bool *selectForRead, bool *selectForWrite) const;
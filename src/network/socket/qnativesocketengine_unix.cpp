@@ -17,9 +17,13 @@
 #include <time.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #ifdef Q_OS_INTEGRITY
 #include <sys/uio.h>
 #endif
+#ifdef Q_OS_LINUX
+#include <sys/sendfile.h>
+#endif
 
 #if defined QNATIVESOCKETENGINE_DEBUG
 #include <private/qdebug_p.h>
@@ -34,6 +38,11 @@
 #ifdef Q_OS_BSD4
 #  include <net/if_dl.h>
 #endif
+#if QT_CONFIG(sendmmsg)
+#  include <sys/socket.h>
+#  include <sys/uio.h>
+#  include <netinet/udp.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -93,6 +102,15 @@ static void convertToLevelAndOption(QNativeSocketEngine::SocketOption opt,
     case QNativeSocketEngine::AddressReusable:
         n = SO_REUSEADDR;
         break;
+    case QNativeSocketEngine::PortReusable:
+        // only where the kernel balances connections across the sockets;
+        // elsewhere, the last socket bound to the port gets all of them
+#if defined(SO_REUSEPORT_LB)
+        n = SO_REUSEPORT_LB;
+#elif defined(SO_REUSEPORT) && defined(Q_OS_LINUX)
+        n = SO_REUSEPORT;
+#endif
+        break;
     case QNativeSocketEngine::ReceiveOutOfBandData:
         n = SO_OOBINLINE;
         break;
@@ -1130,6 +1148,211 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     return qint64(sentBytes);
 }
 
+#if QT_CONFIG(sendmmsg)
+// bounds the stack and heap used for one call; the rest of a larger batch
+// is left for the caller's next call
+static constexpr qsizetype MaxDatagramsPerCall = 1024;
+
+qsizetype QNativeSocketEnginePrivate::nativeReceiveDatagrams(QSpan<char> buffer,
+                                                             QSpan<QUdpSocket::BatchDatagram> datagrams)
+{
+    const qsizetype count = qMin(datagrams.size(), MaxDatagramsPerCall);
+    const qsizetype slotSize = buffer.size() / datagrams.size();
+    QVarLengthArray<mmsghdr, 64> msgs(count);
+    QVarLengthArray<iovec, 64> vecs(count);
+    QVarLengthArray<qt_sockaddr, 64> addresses(count);
+    memset(msgs.data(), 0, count * sizeof(mmsghdr));
+
+    // we need to receive at least one byte, even if our user isn't interested in it
+    char c;
+    for (qsizetype i = 0; i < count; ++i) {
+        vecs[i].iov_base = slotSize ? buffer.data() + i * slotSize : &c;
+        vecs[i].iov_len = slotSize ? slotSize : 1;
+        msgs[i].msg_hdr.msg_iov = &vecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &addresses[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(qt_sockaddr);
+    }
+
+    // MSG_WAITFORONE: don't block for the rest of the batch once one
+    // datagram has arrived, even on a blocking socket
+    int received = 0;
+    do {
+        received = ::recvmmsg(socketDescriptor, msgs.data(), uint(count), MSG_WAITFORONE, nullptr);
+    } while (received == -1 && errno == EINTR);
+
+    if (received == -1) {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            // No datagram was available for reading
+            return 0;
+        case ECONNREFUSED:
+            setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+        }
+        return -1;
+    }
+
+    for (int i = 0; i < received; ++i) {
+        QUdpSocket::BatchDatagram &datagram = datagrams[i];
+        datagram.data = QByteArrayView(buffer.data() + i * slotSize,
+                                       slotSize ? qsizetype(msgs[i].msg_len) : 0);
+        qt_socket_getPortAndAddress(&addresses[i], &datagram.port, &datagram.address);
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagrams(%p, %lli, %lli) == %i",
+           buffer.data(), qlonglong(buffer.size()), qlonglong(datagrams.size()), received);
+#endif
+
+    return received;
+}
+
+qsizetype QNativeSocketEnginePrivate::nativeSendDatagrams(QSpan<const QUdpSocket::BatchDatagram> datagrams)
+{
+    const qsizetype count = qMin(datagrams.size(), MaxDatagramsPerCall);
+
+    // One message per datagram, unless UDP segmentation offload (GSO) is
+    // available: then consecutive datagrams of the same size for the same
+    // destination are gathered into one message, which the network stack
+    // splits up again as late as possible (possibly in the NIC). Only the
+    // last datagram of such a message may be shorter than the others.
+    QVarLengthArray<mmsghdr, 64> msgs(count);
+    QVarLengthArray<iovec, 64> vecs(count);
+    QVarLengthArray<qt_sockaddr, 64> addresses(count);
+    QVarLengthArray<qsizetype, 64> messageEnd(count);
+#ifdef UDP_SEGMENT
+    // limits from the kernel: UDP_MAX_SEGMENTS, and the size of an IPv6
+    // packet without extension headers
+    constexpr qsizetype MaxSegments = 64;
+    constexpr qsizetype MaxSegmentedSize = 0xffff - 40 - 8;
+    union SegmentControl {
+        cmsghdr header;
+        char buffer[CMSG_SPACE(sizeof(quint16))];
+    };
+    QVarLengthArray<SegmentControl, 64> controls(count);
+#endif
+
+    for (qsizetype i = 0; i < count; ++i) {
+        vecs[i].iov_base = const_cast<char *>(datagrams[i].data.data());
+        vecs[i].iov_len = datagrams[i].data.size();
+    }
+
+    const auto prepareMessages = [&](bool segment) {
+        qsizetype messages = 0;
+        for (qsizetype i = 0; i < count; ++messages) {
+            const QUdpSocket::BatchDatagram &first = datagrams[i];
+            mmsghdr &msg = msgs[messages];
+            memset(&msg, 0, sizeof(msg));
+            if (first.port != 0) {
+                msg.msg_hdr.msg_name = &addresses[messages].a;
+                setPortAndAddress(first.port, first.address, &addresses[messages],
+                                  &msg.msg_hdr.msg_namelen);
+            }
+
+            qsizetype end = i + 1;
+#ifdef UDP_SEGMENT
+            const qsizetype segmentSize = first.data.size();
+            if (segment && segmentSize > 0) {
+                qsizetype total = segmentSize;
+                while (end < count && end - i < MaxSegments) {
+                    const QUdpSocket::BatchDatagram &next = datagrams[end];
+                    const qsizetype size = next.data.size();
+                    if (size == 0 || size > segmentSize || total + size > MaxSegmentedSize
+                        || next.port != first.port || next.address != first.address) {
+                        break;
+                    }
+                    total += size;
+                    ++end;
+                    if (size < segmentSize)
+                        break;
+                }
+            }
+            if (end - i > 1) {
+                cmsghdr *cmsgptr = &controls[messages].header;
+                cmsgptr->cmsg_level = SOL_UDP;
+                cmsgptr->cmsg_type = UDP_SEGMENT;
+                cmsgptr->cmsg_len = CMSG_LEN(sizeof(quint16));
+                const quint16 size = quint16(segmentSize);
+                memcpy(CMSG_DATA(cmsgptr), &size, sizeof(size));
+                msg.msg_hdr.msg_control = cmsgptr;
+                msg.msg_hdr.msg_controllen = CMSG_SPACE(sizeof(quint16));
+            }
+#else
+            Q_UNUSED(segment);
+#endif
+            msg.msg_hdr.msg_iov = &vecs[i];
+            msg.msg_hdr.msg_iovlen = end - i;
+            messageEnd[messages] = end;
+            i = end;
+        }
+        return messages;
+    };
+
+    bool segment = false;
+#ifdef UDP_SEGMENT
+    segment = !segmentationOffloadFailed;
+#endif
+    qsizetype messages = prepareMessages(segment);
+    int sent = 0;
+    forever {
+        do {
+            sent = ::sendmmsg(socketDescriptor, msgs.data(), uint(messages), 0);
+        } while (sent == -1 && errno == EINTR);
+        if (sent != -1 || !segment || messages == count)
+            break;
+
+        // The first message was refused. If it was because of segmentation
+        // offload, send the datagrams one by one instead: EIO means the
+        // device can't compute the checksums, so don't try again; EINVAL
+        // means the segments don't fit into the path MTU.
+        if (errno != EIO && errno != EINVAL && errno != ENOPROTOOPT)
+            break;
+        if (errno != EINVAL)
+            segmentationOffloadFailed = true;
+        segment = false;
+        messages = prepareMessages(segment);
+    }
+
+    qsizetype result = 0;
+    if (sent >= 0) {
+        result = sent ? messageEnd[sent - 1] : 0;
+    } else {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            result = -2;
+            break;
+        case EMSGSIZE:
+            setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+            result = -1;
+            break;
+        case ECONNRESET:
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            result = -1;
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, SendDatagramErrorString);
+            result = -1;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeSendDatagrams(%lli) == %lli in %i of %lli messages",
+           qlonglong(datagrams.size()), qlonglong(result), sent, qlonglong(messages));
+#endif
+
+    return result;
+}
+#endif // QT_CONFIG(sendmmsg)
+
 bool QNativeSocketEnginePrivate::fetchConnectionParameters()
 {
     localPort = 0;
@@ -1262,41 +1485,124 @@ void QNativeSocketEnginePrivate::nativeClose()
 }
 
 qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
+{
+    qint64 writtenBytes = qt_safe_write_nosignal(socketDescriptor, data, len);
+    if (writtenBytes < 0)
+        writtenBytes = nativeWriteError();
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWrite(%p \"%s\", %llu) == %i", data,
+           QtDebugUtils::toPrintable(data, len, 16).constData(), len, (int) writtenBytes);
+#endif
+
+    return writtenBytes;
+}
+
+qint64 QNativeSocketEnginePrivate::nativeWriteBlocks(QSpan<const QByteArrayView> blocks)
+{
+    // the caller comes back for whatever does not fit
+#if defined(IOV_MAX) && IOV_MAX < 64
+    constexpr qsizetype MaxBlocks = IOV_MAX;
+#else
+    constexpr qsizetype MaxBlocks = 64;
+#endif
+    iovec iov[MaxBlocks];
+    const qsizetype count = qMin(blocks.size(), MaxBlocks);
+    for (qsizetype i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char *>(blocks[i].data());
+        iov[i].iov_len = size_t(blocks[i].size());
+    }
+
+    qint64 writtenBytes = qt_safe_writev_nosignal(socketDescriptor, iov, int(count));
+    if (writtenBytes < 0)
+        writtenBytes = nativeWriteError();
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteBlocks(%lli blocks) == %lli",
+           qint64(count), writtenBytes);
+#endif
+
+    return writtenBytes;
+}
+
+/*
+    Handles errno after a failed write. Returns 0 if the socket's send
+    buffer is full and -1 otherwise.
+*/
+qint64 QNativeSocketEnginePrivate::nativeWriteError()
+{
+    Q_Q(QNativeSocketEngine);
+
+    switch (errno) {
+    case EPIPE:
+    case ECONNRESET:
+        setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+        q->close();
+        break;
+#if EWOULDBLOCK != EAGAIN
+    case EWOULDBLOCK:
+#endif
+    case EAGAIN:
+        return 0;
+    case EMSGSIZE:
+        setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+        break;
+    default:
+        break;
+    }
+    return -1;
+}
+#ifdef Q_OS_LINUX
+/*
+    Returns -2 if sendfile() cannot be used with this socket or file, in
+    which case the caller copies the data itself.
+*/
+qint64 QNativeSocketEnginePrivate::nativeSendFile(int fd, qint64 offset, qint64 len)
 {
     Q_Q(QNativeSocketEngine);
 
-    ssize_t writtenBytes;
-    writtenBytes = qt_safe_write_nosignal(socketDescriptor, data, len);
+    // Linux transfers at most 0x7ffff000 bytes per call anyway
+    off_t fileOffset = offset;
+    ssize_t sentBytes;
+    qt_ignore_sigpipe();
+    QT_EINTR_LOOP(sentBytes, ::sendfile(socketDescriptor, fd, &fileOffset,
+                                        size_t(qMin(len, qint64(0x7ffff000)))));
 
-    if (writtenBytes < 0) {
+    if (sentBytes == 0) {
+        // the file is shorter than it was when the transfer was queued
+        setError(QAbstractSocket::UnknownSocketError, WriteErrorString);
+        return -1;
+    }
+    if (sentBytes < 0) {
         switch (errno) {
         case EPIPE:
         case ECONNRESET:
-            writtenBytes = -1;
             setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
             q->close();
-            break;
+            return -1;
 #if EWOULDBLOCK != EAGAIN
         case EWOULDBLOCK:
 #endif
         case EAGAIN:
-            writtenBytes = 0;
-            break;
-        case EMSGSIZE:
-            setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
-            break;
+            return 0;
+        case EINVAL:
+        case ENOSYS:
+            return -2;
         default:
-            break;
+            setError(QAbstractSocket::UnknownSocketError, WriteErrorString);
+            return -1;
         }
     }
 
 #if defined (QNATIVESOCKETENGINE_DEBUG)
-    qDebug("QNativeSocketEnginePrivate::nativeWrite(%p \"%s\", %llu) == %i", data,
-           QtDebugUtils::toPrintable(data, len, 16).constData(), len, (int) writtenBytes);
+    qDebug("QNativeSocketEnginePrivate::nativeSendFile(%d, %lld, %lld) == %lld", fd, offset, len,
+           qint64(sentBytes));
 #endif
 
-    return qint64(writtenBytes);
+    return qint64(sentBytes);
 }
+#endif // Q_OS_LINUX
+
 /*
 */
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
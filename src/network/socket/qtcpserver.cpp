@@ -317,6 +317,12 @@ bool QTcpServer::listen(const QHostAddress &address, quint16 port)
 
     d->configureCreatedSocket();
 
+    if (d->reusePort && !d->socketEngine->setOption(QAbstractSocketEngine::PortReusable, 1)) {
+        d->serverSocketError = QAbstractSocket::UnsupportedSocketOperationError;
+        d->serverSocketErrorString = tr("Sharing the port between servers is not supported");
+        return false;
+    }
+
     if (!d->socketEngine->bind(addr, port)) {
         d->serverSocketError = d->socketEngine->error();
         d->serverSocketErrorString = d->socketEngine->errorString();
@@ -672,6 +678,60 @@ int QTcpServer::listenBacklogSize() const
     return d_func()->listenBacklog;
 }
 
+/*!
+    \since 6.10
+
+    If \a enabled is true, listen() allows other servers with this option
+    enabled to listen on the same address and port at the same time, and
+    the operating system distributes the incoming connections among them.
+
+    This lets a multi-threaded server accept connections on several threads,
+    without a single thread accepting all of them and handing them out.
+    Create one QTcpServer per thread, in the thread that will use the
+    connections, enable this option, and call listen() with the same
+    address and port:
+
+    \code
+    void Worker::start(quint16 port) // runs in the worker's thread
+    {
+        server = new QTcpServer(this);
+        server->setReusePortEnabled(true);
+        server->listen(QHostAddress::Any, port);
+        connect(server, &QTcpServer::pendingConnectionAvailable, this, &Worker::accept);
+    }
+    \endcode
+
+    Each server then only sees the connections the operating system assigned
+    to it. To prevent other users from taking over the port, it can only be
+    shared by processes running as the same user.
+
+    This is supported on Linux, using \c SO_REUSEPORT, and on FreeBSD, using
+    \c SO_REUSEPORT_LB. On other platforms, listen() fails with
+    QAbstractSocket::UnsupportedSocketOperationError if this option is
+    enabled. It is disabled by default.
+
+    \note This property must be set prior to calling listen().
+
+    \sa isReusePortEnabled()
+*/
+void QTcpServer::setReusePortEnabled(bool enabled)
+{
+    d_func()->reusePort = enabled;
+}
+
+/*!
+    \since 6.10
+
+    Returns whether the port the server listens on can be shared with other
+    servers.
+
+    \sa setReusePortEnabled()
+*/
+bool QTcpServer::isReusePortEnabled() const
+{
+    return d_func()->reusePort;
+}
+
 /*!
     Returns an error code for the last error that occurred.
 
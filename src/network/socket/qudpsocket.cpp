@@ -494,6 +494,135 @@ qint64 QUdpSocket::readDatagram(char *data, qint64 maxSize, QHostAddress *addres
     return readBytes;
 }
 
+/*!
+    \struct QUdpSocket::BatchDatagram
+    \inmodule QtNetwork
+    \since 6.10
+
+    \brief Describes one datagram passed to readDatagrams() or writeDatagrams().
+
+    Unlike QNetworkDatagram, a BatchDatagram does not own its payload, so
+    datagrams can be sent and received in bulk without allocating memory for
+    each of them.
+
+    \sa readDatagrams(), writeDatagrams()
+*/
+
+/*!
+    \variable QUdpSocket::BatchDatagram::data
+
+    The payload of the datagram. It refers to the caller's memory.
+*/
+
+/*!
+    \variable QUdpSocket::BatchDatagram::address
+
+    The address the datagram was received from, or is sent to.
+*/
+
+/*!
+    \variable QUdpSocket::BatchDatagram::port
+
+    The port the datagram was received from, or is sent to. A port of 0 when
+    sending means that the socket's peer is the destination, which requires a
+    connected socket.
+*/
+
+/*!
+    \since 6.10
+
+    Receives up to \c{datagrams.size()} pending datagrams at once. The memory
+    in \a buffer is divided into equally sized slots, one for each entry in
+    \a datagrams, and each datagram is received into its own slot. The
+    \l{BatchDatagram::}{data} of the filled entries of \a datagrams refers to
+    those slots, and their \l{BatchDatagram::}{address} and
+    \l{BatchDatagram::}{port} are set to the sender's.
+
+    Returns the number of datagrams received, which is 0 if none were
+    pending, or -1 if an error occurred. A datagram larger than a slot is
+    truncated, the rest of it is lost.
+
+    On platforms that support it, such as Linux, this needs only a single
+    system call. Because no memory is allocated, reusing \a buffer and
+    \a datagrams is considerably faster than calling receiveDatagram() in a
+    loop when many small datagrams arrive.
+
+    \sa writeDatagrams(), readDatagram()
+*/
+qsizetype QUdpSocket::readDatagrams(QSpan<char> buffer, QSpan<BatchDatagram> datagrams)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::readDatagrams(%p, %lld, %lld)", buffer.data(), qlonglong(buffer.size()),
+           qlonglong(datagrams.size()));
+#endif
+    QT_CHECK_BOUND("QUdpSocket::readDatagrams()", -1);
+
+    if (datagrams.empty())
+        return 0;
+
+    const qsizetype received = d->socketEngine->readDatagrams(buffer, datagrams);
+    d->hasPendingData = false;
+    d->hasPendingDatagram = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+    if (received < 0)
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+    return received;
+}
+
+/*!
+    \since 6.10
+
+    Sends \a datagrams, each to the address and port given in it, and
+    returns the number of datagrams that were sent, or -1 if an error
+    occurred before any datagram was sent. Fewer datagrams than requested are
+    sent when the socket's send buffer fills up or an error occurs; in the
+    latter case, error() describes it.
+
+    On Linux, all datagrams are passed to the kernel with a single system
+    call. Consecutive datagrams of equal size for the same destination are
+    handed over as one buffer for the network stack to split up (UDP
+    segmentation offload), where the kernel supports it.
+
+    The bytesWritten() signal is emitted once, with the total size of the
+    datagrams that were sent.
+
+    \sa readDatagrams(), writeDatagram()
+*/
+qsizetype QUdpSocket::writeDatagrams(QSpan<const BatchDatagram> datagrams)
+{
+    Q_D(QUdpSocket);
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::writeDatagrams(%lld)", qlonglong(datagrams.size()));
+#endif
+    if (datagrams.empty())
+        return 0;
+    if (!d->doEnsureInitialized(QHostAddress::Any, 0, datagrams.front().address))
+        return -1;
+    if (state() == UnconnectedState)
+        bind();
+
+    qsizetype sent = d->socketEngine->writeDatagrams(datagrams);
+    d->cachedSocketDescriptor = d->socketEngine->socketDescriptor();
+
+    if (sent > 0) {
+        qint64 bytes = 0;
+        for (const BatchDatagram &datagram : datagrams.first(sent))
+            bytes += datagram.data.size();
+        emit bytesWritten(bytes);
+    } else if (sent < 0) {
+        if (sent == -2) {
+            // Socket engine reports EAGAIN. Treat as a temporary error.
+            d->setErrorAndEmit(QAbstractSocket::TemporaryError,
+                               tr("Unable to send a datagram"));
+            return -1;
+        }
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+    }
+    return sent;
+}
+
 #endif // QT_NO_UDPSOCKET
 
 QT_END_NAMESPACE
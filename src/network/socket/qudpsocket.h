@@ -8,6 +8,9 @@
 #include <QtNetwork/qabstractsocket.h>
 #include <QtNetwork/qhostaddress.h>
 
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qspan.h>
+
 QT_BEGIN_NAMESPACE
 
 
@@ -53,6 +56,15 @@ public:
     inline qint64 writeDatagram(const QByteArray &datagram, const QHostAddress &host, quint16 port)
         { return writeDatagram(datagram.constData(), datagram.size(), host, port); }
 
+    struct BatchDatagram
+    {
+        QByteArrayView data = {};
+        QHostAddress address = {};
+        quint16 port = 0;
+    };
+    qsizetype readDatagrams(QSpan<char> buffer, QSpan<BatchDatagram> datagrams);
+    qsizetype writeDatagrams(QSpan<const BatchDatagram> datagrams);
+
 private:
     Q_DISABLE_COPY_MOVE(QUdpSocket)
     Q_DECLARE_PRIVATE(QUdpSocket)
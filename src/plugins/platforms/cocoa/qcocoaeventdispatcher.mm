@@ -475,7 +475,7 @@ bool QCocoaEventDispatcher::processEvents(QEventLoop::ProcessEventsFlags flags)
             if (hadModalSession && !d->currentModalSessionCached)
                 interruptLater = true;
         }
-        bool canWait = (d->threadData.loadRelaxed()->canWait
+        bool canWait = (d->threadData.loadRelaxed()->canWaitLocked()
                 && !retVal
                 && !d->interrupt
                 && (d->processEventsFlags & QEventLoop::WaitForMoreEvents));
@@ -866,7 +866,7 @@ void QCocoaEventDispatcherPrivate::processPostedEvents()
     }
 
     int serial = serialNumber.loadRelaxed();
-    if (!threadData.loadRelaxed()->canWait || (serial != lastSerial)) {
+    if (!threadData.loadRelaxed()->canWaitLocked() || (serial != lastSerial)) {
         lastSerial = serial;
         QCoreApplication::sendPostedEvents();
         QWindowSystemInterface::sendWindowSystemEvents(QEventLoop::AllEvents);
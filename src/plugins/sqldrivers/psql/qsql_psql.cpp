@@ -114,6 +114,7 @@ protected:
     QVariant lastInsertId() const override;
     bool prepare(const QString &query) override;
     bool exec() override;
+    bool execBatch(bool arrayBind = false) override;
 };
 
 class QPSQLDriverPrivate final : public QSqlDriverPrivate
@@ -270,8 +271,15 @@ public:
     int currentSize = -1;
     bool canFetchMoreRows = false;
     bool preparedQueriesEnabled = false;
+    bool copyFromStdin = false;
 
     bool processResults();
+    bool execCommand(const char *command);
+    bool execBatchRows(bool arrayBind);
+    bool copyIn(const QList<QVariantList> &columns, qsizetype rowCount);
+#ifdef LIBPQ_HAS_PIPELINING
+    bool execPipelined(const QList<QVariantList> &columns, qsizetype rowCount);
+#endif
 };
 
 static QSqlError qMakeError(const QString &err, QSqlError::ErrorType type,
@@ -847,11 +855,27 @@ QString qMakePreparedStmtId()
     return id;
 }
 
+static bool qIsCopyFromStdin(const QString &query)
+{
+    static const QRegularExpression rx(
+            QStringLiteral("^\\s*COPY\\b.*\\bFROM\\s+STDIN\\b"),
+            QRegularExpression::CaseInsensitiveOption
+                    | QRegularExpression::DotMatchesEverythingOption);
+    return rx.match(query).hasMatch();
+}
+
 bool QPSQLResult::prepare(const QString &query)
 {
     Q_D(QPSQLResult);
-    if (!d->preparedQueriesEnabled)
+    // COPY cannot be prepared on the server; the values bound to the query
+    // are streamed to it as rows instead, see copyIn()
+    d->copyFromStdin = qIsCopyFromStdin(query);
+    if (d->copyFromStdin || !d->preparedQueriesEnabled) {
+        cleanup();
+        if (!d->preparedStmtId.isEmpty())
+            d->deallocatePreparedStmt();
         return QSqlResult::prepare(query);
+    }
 
     cleanup();
 
@@ -879,6 +903,13 @@ bool QPSQLResult::prepare(const QString &query)
 bool QPSQLResult::exec()
 {
     Q_D(QPSQLResult);
+    if (d->copyFromStdin) {
+        cleanup();
+        QList<QVariantList> columns;
+        for (const QVariant &value : std::as_const(boundValues()))
+            columns.append(QVariantList{ value });
+        return d->copyIn(columns, columns.isEmpty() ? 0 : 1);
+    }
     if (!d->preparedQueriesEnabled)
         return QSqlResult::exec();
 
@@ -910,6 +941,297 @@ bool QPSQLResult::exec()
     return d->processResults();
 }
 
+bool QPSQLResult::execBatch(bool arrayBind)
+{
+    Q_D(QPSQLResult);
+    // A COPY is a single statement. Other rows run in one transaction, so
+    // that a failing row stores none of them, whether they are pipelined
+    // or executed one at a time.
+    QPSQLDriverPrivate *driver = d->drv_d_func();
+    const bool ownTransaction = (arrayBind || !d->copyFromStdin) && driver
+            && PQtransactionStatus(driver->connection) == PQTRANS_IDLE;
+    if (ownTransaction && !d->execCommand("BEGIN"))
+        return false;
+    const bool ok = d->execBatchRows(arrayBind);
+    if (!ownTransaction)
+        return ok;
+    if (ok)
+        return d->execCommand("COMMIT");
+    PQclear(PQexec(driver->connection, "ROLLBACK"));
+    return false;
+}
+
+/*
+    Runs a statement that returns no rows, such as the commands that begin
+    and end a transaction. Unlike QPSQLDriverPrivate::exec(), this keeps the
+    current statement id, so the result of this query stays valid.
+*/
+bool QPSQLResultPrivate::execCommand(const char *command)
+{
+    Q_Q(QPSQLResult);
+    QPSQLDriverPrivate *driver = drv_d_func();
+    PGresult *commandResult = PQexec(driver->connection, command);
+    const bool ok = PQresultStatus(commandResult) == PGRES_COMMAND_OK
+            && qstrcmp(PQcmdStatus(commandResult), "ROLLBACK") != 0;
+    if (!ok) {
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to execute statement"), QSqlError::StatementError,
+                        driver, commandResult));
+    }
+    PQclear(commandResult);
+    driver->checkPendingNotifications();
+    return ok;
+}
+
+bool QPSQLResultPrivate::execBatchRows(bool arrayBind)
+{
+    Q_Q(QPSQLResult);
+#ifdef LIBPQ_HAS_PIPELINING
+    const bool pipelined = preparedQueriesEnabled;
+#else
+    const bool pipelined = false;
+#endif
+    if (arrayBind || (!copyFromStdin && !pipelined))
+        return q->QSqlResult::execBatch(arrayBind);
+
+    q->cleanup();
+
+    QList<QVariantList> columns;
+    columns.reserve(q->boundValues().size());
+    for (const QVariant &value : std::as_const(q->boundValues()))
+        columns.append(value.toList());
+    if (columns.isEmpty())
+        return false;
+    const qsizetype rowCount = columns.constFirst().size();
+    for (const QVariantList &column : std::as_const(columns)) {
+        if (column.size() != rowCount) {
+            q->setLastError(QSqlError(QCoreApplication::translate("QPSQLResult",
+                                      "Parameter count mismatch"), QString(),
+                                      QSqlError::StatementError));
+            return false;
+        }
+    }
+
+    if (copyFromStdin)
+        return copyIn(columns, rowCount);
+#ifdef LIBPQ_HAS_PIPELINING
+    return execPipelined(columns, rowCount);
+#else
+    Q_UNREACHABLE_RETURN(false);
+#endif
+}
+
+// Appends the text form of value to a row of COPY's text format, see
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.2
+static void qAppendCopyValue(QByteArray &row, const QVariant &value)
+{
+    if (QSqlResultPrivate::isVariantNull(value)) {
+        row += "\\N";
+        return;
+    }
+
+    QByteArray text;
+    switch (value.typeId()) {
+    case QMetaType::Bool:
+        text = value.toBool() ? "t" : "f";
+        break;
+    case QMetaType::QDateTime: {
+        const QDateTime dt = value.toDateTime();
+        if (!dt.isValid()) {
+            row += "\\N";
+            return;
+        }
+        text = dt.toOffsetFromUtc(dt.offsetFromUtc()).toString(Qt::ISODateWithMs).toLatin1();
+        break;
+    }
+    case QMetaType::QDate:
+        text = value.toDate().toString(Qt::ISODate).toLatin1();
+        break;
+    case QMetaType::QTime:
+        text = QLocale::c().toString(value.toTime(), u"hh:mm:ss.zzz").toLatin1();
+        break;
+    case QMetaType::Float:
+    case QMetaType::Double: {
+        const double d = value.toDouble();
+        if (qIsNaN(d))
+            text = "NaN";
+        else if (qIsInf(d))
+            text = d < 0 ? "-Infinity" : "Infinity";
+        else
+            text = QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+        break;
+    }
+    case QMetaType::QByteArray:
+        text = "\\x" + value.toByteArray().toHex();
+        break;
+    default:
+        text = value.toString().toUtf8();
+        break;
+    }
+
+    for (char c : std::as_const(text)) {
+        switch (c) {
+        case '\\':
+            row += "\\\\";
+            break;
+        case '\t':
+            row += "\\t";
+            break;
+        case '\n':
+            row += "\\n";
+            break;
+        case '\r':
+            row += "\\r";
+            break;
+        default:
+            row += c;
+            break;
+        }
+    }
+}
+
+/*
+    Runs the COPY ... FROM STDIN query of this result, sending rowCount rows
+    made of the values in columns.
+*/
+bool QPSQLResultPrivate::copyIn(const QList<QVariantList> &columns, qsizetype rowCount)
+{
+    Q_Q(QPSQLResult);
+    QPSQLDriverPrivate *driver = drv_d_func();
+    if (!driver || !q->driver()->isOpen() || q->driver()->isOpenError())
+        return false;
+
+    stmtId = driver->sendQuery(q->lastQuery());
+    if (stmtId == InvalidStatementId) {
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to send query"), QSqlError::StatementError, driver));
+        return false;
+    }
+    result = driver->getResult(stmtId);
+    if (PQresultStatus(result) != PGRES_COPY_IN)
+        return processResults();
+    PQclear(result);
+    result = nullptr;
+
+    // PQputCopyData() buffers little, so hand it larger blocks of rows
+    constexpr qsizetype BlockSize = 64 * 1024;
+    QByteArray block;
+    block.reserve(BlockSize + 1024);
+    bool ok = true;
+    for (qsizetype row = 0; ok && row < rowCount; ++row) {
+        for (qsizetype column = 0; column < columns.size(); ++column) {
+            if (column > 0)
+                block += '\t';
+            qAppendCopyValue(block, columns.at(column).at(row));
+        }
+        block += '\n';
+        if (block.size() >= BlockSize || row == rowCount - 1) {
+            ok = PQputCopyData(driver->connection, block.constData(), int(block.size())) == 1;
+            block.clear();
+        }
+    }
+    if (PQputCopyEnd(driver->connection, ok ? nullptr : "QPSQL: sending data failed") != 1)
+        ok = false;
+
+    result = driver->getResult(stmtId);
+    return processResults() && ok;
+}
+
+#ifdef LIBPQ_HAS_PIPELINING
+/*
+    Executes the prepared statement once per row, sending the rows in
+    pipeline mode so that there is one round trip per block of rows instead
+    of one per row. Each block is followed by a sync point and its results
+    are read before the next one is sent: with a blocking connection, the
+    server could otherwise stall writing results that are not read while
+    libpq is stalled writing statements. QPSQLResult::execBatch() runs the
+    rows in one transaction, so the sync points don't decide which rows are
+    stored when one of them fails.
+*/
+bool QPSQLResultPrivate::execPipelined(const QList<QVariantList> &columns, qsizetype rowCount)
+{
+    Q_Q(QPSQLResult);
+    QPSQLDriverPrivate *driver = drv_d_func();
+    if (!driver || !q->driver()->isOpen() || q->driver()->isOpenError())
+        return false;
+    if (rowCount == 0)
+        return true;
+
+    PGconn *connection = driver->connection;
+    driver->discardResults();
+    if (PQenterPipelineMode(connection) != 1) {
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to send query"), QSqlError::StatementError, driver));
+        return false;
+    }
+    stmtId = driver->currentStmtId = driver->generateStatementId();
+
+    constexpr qsizetype BlockSize = 256;
+    const QString executeStmt = QStringLiteral("EXECUTE ") + preparedStmtId;
+    QList<QVariant> values(columns.size());
+    bool ok = true;
+    for (qsizetype first = 0; ok && first < rowCount; first += BlockSize) {
+        const qsizetype end = qMin(rowCount, first + BlockSize);
+        qsizetype sent = first;
+        for (; sent < end; ++sent) {
+            for (qsizetype column = 0; column < columns.size(); ++column)
+                values[column] = columns.at(column).at(sent);
+            const QString params = qCreateParamString(values, q->driver());
+            const QString stmt = params.isEmpty() ? executeStmt
+                                                  : executeStmt + " ("_L1 + params + u')';
+            if (PQsendQueryParams(connection, stmt.toUtf8().constData(), 0, nullptr, nullptr,
+                                  nullptr, nullptr, 0) != 1) {
+                q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                "Unable to send query"), QSqlError::StatementError, driver));
+                ok = false;
+                break;
+            }
+        }
+        const bool synced = PQpipelineSync(connection) == 1;
+
+        // Each statement's results end with a null result; the statements
+        // after a failing one report PGRES_PIPELINE_ABORTED.
+        for (qsizetype i = first; i < sent; ++i) {
+            while (PGresult *stmtResult = PQgetResult(connection)) {
+                const ExecStatusType status = PQresultStatus(stmtResult);
+                if (ok && (status == PGRES_COMMAND_OK || status == PGRES_TUPLES_OK)) {
+                    PQclear(result);
+                    result = stmtResult;
+                    continue;
+                }
+                if (ok && status != PGRES_PIPELINE_ABORTED) {
+                    q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                    "Unable to execute statement"), QSqlError::StatementError,
+                                    driver, stmtResult));
+                    ok = false;
+                }
+                PQclear(stmtResult);
+            }
+        }
+        if (!synced) {
+            ok = false;
+            break;
+        }
+        PGresult *syncResult = PQgetResult(connection);
+        if (PQresultStatus(syncResult) != PGRES_PIPELINE_SYNC)
+            ok = false;
+        PQclear(syncResult);
+    }
+    PQexitPipelineMode(connection);
+    driver->checkPendingNotifications();
+
+    if (!ok) {
+        PQclear(result);
+        result = nullptr;
+        q->setSelect(false);
+        q->setActive(false);
+        return false;
+    }
+    // the result of the last row, as after a series of exec() calls
+    return processResults();
+}
+#endif // LIBPQ_HAS_PIPELINING
+
 ///////////////////////////////////////////////////////////////////
 
 bool QPSQLDriverPrivate::setEncodingUtf8()
@@ -16,11 +16,11 @@
 #include <QtSql/private/qsqldriver_p.h>
 #include <qstringlist.h>
 #include <qvariant.h>
-#if QT_CONFIG(regularexpression)
+#include <qvarlengtharray.h>
 #include <qcache.h>
+#if QT_CONFIG(regularexpression)
 #include <qregularexpression.h>
 #endif
-#include <QScopedValueRollback>
 
 #if defined Q_OS_WIN
 # include <qt_windows.h>
@@ -30,6 +30,7 @@
 
 #include <sqlite3.h>
 #include <functional>
+#include <memory>
 
 Q_DECLARE_OPAQUE_POINTER(sqlite3*)
 Q_DECLARE_METATYPE(sqlite3*)
@@ -105,9 +106,24 @@ public:
     QSqlIndex getTableInfo(QSqlQuery &query, const QString &tableName,
                            bool onlyPIndex = false) const;
 
+    sqlite3_stmt *takeCachedStatement(const QString &query);
+    void releaseStatement(const QString &query, sqlite3_stmt *stmt);
+
     sqlite3 *access = nullptr;
     QList<QSQLiteResult *> results;
     QStringList notificationid;
+
+    // Statements no longer used by any result, kept for the next prepare()
+    // of the same query, see QSQLITE_STATEMENT_CACHE_SIZE
+    struct CachedStatement
+    {
+        explicit CachedStatement(sqlite3_stmt *stmt) : stmt(stmt) {}
+        ~CachedStatement() { sqlite3_finalize(stmt); }
+        Q_DISABLE_COPY_MOVE(CachedStatement)
+
+        sqlite3_stmt *stmt;
+    };
+    QCache<QString, CachedStatement> statementCache{32};
 };
 
 bool QSQLiteDriverPrivate::isIdentifierEscaped(QStringView identifier) const
@@ -118,6 +134,20 @@ bool QSQLiteDriverPrivate::isIdentifierEscaped(QStringView identifier) const
                 || (identifier.startsWith(u'[') && identifier.endsWith(u']')));
 }
 
+sqlite3_stmt *QSQLiteDriverPrivate::takeCachedStatement(const QString &query)
+{
+    const std::unique_ptr<CachedStatement> cached(statementCache.take(query));
+    return cached ? std::exchange(cached->stmt, nullptr) : nullptr;
+}
+
+void QSQLiteDriverPrivate::releaseStatement(const QString &query, sqlite3_stmt *stmt)
+{
+    // QCache finalizes the statement right away if the cache is disabled
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    statementCache.insert(query, new CachedStatement(stmt));
+}
+
 QSqlIndex QSQLiteDriverPrivate::getTableInfo(QSqlQuery &query, const QString &tableName,
                                              bool onlyPIndex) const
 {
@@ -172,8 +202,11 @@ public:
     // initializes the recordInfo and the cache
     void initColumns(bool emptyResultset);
     void finalize();
+    bool mapParameters(qsizetype valueCount, QVarLengthArray<int> &map) const;
+    int bindValue(int index, const QVariant &value);
 
     sqlite3_stmt *stmt = nullptr;
+    QString query;
     QSqlRecord rInf;
     QList<QVariant> firstRow;
     bool skippedStatus = false; // the status of the fetchNext() that's skipped
@@ -197,10 +230,113 @@ void QSQLiteResultPrivate::finalize()
     if (!stmt)
         return;
 
-    sqlite3_finalize(stmt);
+    if (QSQLiteDriverPrivate *driver = drv_d_func())
+        driver->releaseStatement(query, stmt);
+    else
+        sqlite3_finalize(stmt);
     stmt = nullptr;
 }
 
+/*
+    Maps the parameters of the statement to the indexes of the bound values,
+    of which there are more than parameters when a named placeholder is used
+    more than once. Returns false if they don't match.
+*/
+bool QSQLiteResultPrivate::mapParameters(qsizetype valueCount, QVarLengthArray<int> &map) const
+{
+    const int paramCount = sqlite3_bind_parameter_count(stmt);
+    map.clear();
+    if (paramCount == valueCount) {
+        for (int i = 0; i < paramCount; ++i)
+            map.append(i);
+        return true;
+    }
+
+    bool valid = false;
+#if (SQLITE_VERSION_NUMBER >= 3003011)
+    // In the case of the reuse of a named placeholder
+    // We need to check explicitly that paramCount is greater than or equal to 1, as sqlite
+    // can end up in a case where for virtual tables it returns 0 even though it
+    // has parameters
+    if (paramCount >= 1 && paramCount < valueCount) {
+        const auto countIndexes = [](int counter, const QList<int> &indexList) {
+                                      return counter + indexList.size();
+                                  };
+
+        const int bindParamCount = std::accumulate(indexes.cbegin(),
+                                                   indexes.cend(),
+                                                   0,
+                                                   countIndexes);
+
+        valid = bindParamCount == valueCount;
+        // When using named placeholders, it will reuse the index for duplicated
+        // placeholders. So we need to ensure we bind only one instance of
+        // each value as SQLite will do the rest for us.
+        QList<int> handledIndexes;
+        for (int i = 0, currentIndex = 0; i < valueCount; ++i) {
+            if (handledIndexes.contains(i))
+                continue;
+            const char *parameterName = sqlite3_bind_parameter_name(stmt, currentIndex + 1);
+            if (!parameterName) {
+                valid = false;
+                continue;
+            }
+            const auto placeHolder = QString::fromUtf8(parameterName);
+            const auto &valueIndexes = indexes.value(placeHolder);
+            handledIndexes << valueIndexes;
+            map.append(valueIndexes.first());
+            ++currentIndex;
+        }
+    }
+#endif
+    return valid && map.size() == paramCount;
+}
+
+int QSQLiteResultPrivate::bindValue(int index, const QVariant &value)
+{
+    if (QSqlResultPrivate::isVariantNull(value))
+        return sqlite3_bind_null(stmt, index);
+
+    switch (value.userType()) {
+    case QMetaType::QByteArray: {
+        const QByteArray *ba = static_cast<const QByteArray*>(value.constData());
+        return sqlite3_bind_blob(stmt, index, ba->constData(), ba->size(), SQLITE_STATIC);
+    }
+    case QMetaType::Int:
+    case QMetaType::Bool:
+        return sqlite3_bind_int(stmt, index, value.toInt());
+    case QMetaType::Double:
+        return sqlite3_bind_double(stmt, index, value.toDouble());
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+        return sqlite3_bind_int64(stmt, index, value.toLongLong());
+    case QMetaType::QDateTime: {
+        const QDateTime dateTime = value.toDateTime();
+        const QString str = dateTime.toString(Qt::ISODateWithMs);
+        return sqlite3_bind_text16(stmt, index, str.data(), int(str.size() * sizeof(ushort)),
+                                   SQLITE_TRANSIENT);
+    }
+    case QMetaType::QTime: {
+        const QTime time = value.toTime();
+        const QString str = time.toString(u"hh:mm:ss.zzz");
+        return sqlite3_bind_text16(stmt, index, str.data(), int(str.size() * sizeof(ushort)),
+                                   SQLITE_TRANSIENT);
+    }
+    case QMetaType::QString: {
+        // lifetime of string == lifetime of its qvariant
+        const QString *str = static_cast<const QString*>(value.constData());
+        return sqlite3_bind_text16(stmt, index, str->unicode(),
+                                   int(str->size()) * sizeof(QChar), SQLITE_STATIC);
+    }
+    default: {
+        const QString str = value.toString();
+        // SQLITE_TRANSIENT makes sure that sqlite buffers the data
+        return sqlite3_bind_text16(stmt, index, str.data(), int(str.size()) * sizeof(QChar),
+                                   SQLITE_TRANSIENT);
+    }
+    }
+}
+
 void QSQLiteResultPrivate::initColumns(bool emptyResultset)
 {
     Q_Q(QSQLiteResult);
@@ -390,6 +526,11 @@ bool QSQLiteResult::prepare(const QString &query)
 
     setSelect(false);
 
+    d->query = query;
+    d->stmt = d->drv_d_func()->takeCachedStatement(query);
+    if (d->stmt)
+        return true;
+
     const void *pzTail = nullptr;
     const auto size = int((query.size() + 1) * sizeof(QChar));
 
@@ -409,7 +550,9 @@ bool QSQLiteResult::prepare(const QString &query)
     } else if (pzTail && !QString(reinterpret_cast<const QChar *>(pzTail)).trimmed().isEmpty()) {
         setLastError(qMakeError(d->drv_d_func()->access, QCoreApplication::translate("QSQLiteResult",
             "Unable to execute multiple statements at a time"), QSqlError::StatementError, SQLITE_MISUSE));
-        d->finalize();
+        // not d->finalize(), which would cache the statement for this query
+        sqlite3_finalize(d->stmt);
+        d->stmt = nullptr;
         return false;
     }
     return true;
@@ -418,24 +561,88 @@ bool QSQLiteResult::prepare(const QString &query)
 bool QSQLiteResult::execBatch(bool arrayBind)
 {
     Q_UNUSED(arrayBind);
-    Q_D(QSqlResult);
-    QScopedValueRollback<QList<QVariant>> valuesScope(d->values);
-    QList<QVariant> values = d->values;
-    if (values.size() == 0)
+    Q_D(QSQLiteResult);
+    const QList<QVariant> values = boundValues();
+    if (values.size() == 0 || !d->stmt)
+        return false;
+
+    QList<QVariantList> columns;
+    columns.reserve(values.size());
+    for (const QVariant &value : values)
+        columns.append(value.toList());
+    const qsizetype rowCount = columns.constFirst().size();
+    QVarLengthArray<int> parameters;
+    const bool valid = d->mapParameters(values.size(), parameters)
+            && std::all_of(columns.cbegin(), columns.cend(), [rowCount](const QVariantList &column) {
+                   return column.size() == rowCount;
+               });
+    if (!valid) {
+        setLastError(QSqlError(QCoreApplication::translate("QSQLiteResult",
+                        "Parameter count mismatch"), QString(), QSqlError::StatementError));
         return false;
+    }
 
-    for (int i = 0; i < values.at(0).toList().size(); ++i) {
-        d->values.clear();
-        QScopedValueRollback<QHash<QString, QList<int>>> indexesScope(d->indexes);
-        auto it = d->indexes.constBegin();
-        while (it != d->indexes.constEnd()) {
-            bindValue(it.key(), values.at(it.value().first()).toList().at(i), QSql::In);
-            ++it;
+    d->skippedStatus = false;
+    d->skipRow = false;
+    d->rInf.clear();
+    clearValues();
+    setLastError(QSqlError());
+    setSelect(false);
+
+    // Unless the application is in a transaction already, run all rows in
+    // one, rather than letting SQLite commit each of them to disk.
+    sqlite3 *access = d->drv_d_func()->access;
+    const bool ownTransaction = sqlite3_get_autocommit(access);
+    int res = ownTransaction ? sqlite3_exec(access, "BEGIN", nullptr, nullptr, nullptr)
+                             : SQLITE_OK;
+    if (res != SQLITE_OK) {
+        setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                     "Unable to execute statement"), QSqlError::StatementError, res));
+        setActive(false);
+        return false;
+    }
+
+    for (qsizetype row = 0; row < rowCount; ++row) {
+        sqlite3_reset(d->stmt);
+        for (qsizetype i = 0; i < parameters.size(); ++i) {
+            res = d->bindValue(int(i + 1), columns.at(parameters.at(i)).at(row));
+            if (res != SQLITE_OK) {
+                setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                             "Unable to bind parameters"), QSqlError::StatementError, res));
+                break;
+            }
+        }
+        if (res != SQLITE_OK)
+            break;
+
+        do {
+            res = sqlite3_step(d->stmt);
+        } while (res == SQLITE_ROW);
+        if (res != SQLITE_DONE) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to execute statement"), QSqlError::StatementError, res));
+            break;
         }
-        if (!exec())
-            return false;
+        res = SQLITE_OK;
     }
-    return true;
+    // the bindings point into columns
+    sqlite3_reset(d->stmt);
+    sqlite3_clear_bindings(d->stmt);
+
+    if (ownTransaction) {
+        if (res == SQLITE_OK) {
+            res = sqlite3_exec(access, "COMMIT", nullptr, nullptr, nullptr);
+            if (res != SQLITE_OK) {
+                setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                             "Unable to execute statement"), QSqlError::StatementError, res));
+            }
+        }
+        if (res != SQLITE_OK)
+            sqlite3_exec(access, "ROLLBACK", nullptr, nullptr, nullptr);
+    }
+
+    setActive(res == SQLITE_OK);
+    return res == SQLITE_OK;
 }
 
 bool QSQLiteResult::exec()
@@ -457,105 +664,10 @@ bool QSQLiteResult::exec()
         return false;
     }
 
-    int paramCount = sqlite3_bind_parameter_count(d->stmt);
-    bool paramCountIsValid = paramCount == values.size();
-
-#if (SQLITE_VERSION_NUMBER >= 3003011)
-    // In the case of the reuse of a named placeholder
-    // We need to check explicitly that paramCount is greater than or equal to 1, as sqlite
-    // can end up in a case where for virtual tables it returns 0 even though it
-    // has parameters
-    if (paramCount >= 1 && paramCount < values.size()) {
-        const auto countIndexes = [](int counter, const QList<int> &indexList) {
-                                      return counter + indexList.size();
-                                  };
-
-        const int bindParamCount = std::accumulate(d->indexes.cbegin(),
-                                                   d->indexes.cend(),
-                                                   0,
-                                                   countIndexes);
-
-        paramCountIsValid = bindParamCount == values.size();
-        // When using named placeholders, it will reuse the index for duplicated
-        // placeholders. So we need to ensure the QList has only one instance of
-        // each value as SQLite will do the rest for us.
-        QList<QVariant> prunedValues;
-        QList<int> handledIndexes;
-        for (int i = 0, currentIndex = 0; i < values.size(); ++i) {
-            if (handledIndexes.contains(i))
-                continue;
-            const char *parameterName = sqlite3_bind_parameter_name(d->stmt, currentIndex + 1);
-            if (!parameterName) {
-                paramCountIsValid = false;
-                continue;
-            }
-            const auto placeHolder = QString::fromUtf8(parameterName);
-            const auto &indexes = d->indexes.value(placeHolder);
-            handledIndexes << indexes;
-            prunedValues << values.at(indexes.first());
-            ++currentIndex;
-        }
-        values = prunedValues;
-    }
-#endif
-
-    if (paramCountIsValid) {
-        for (int i = 0; i < paramCount; ++i) {
-            res = SQLITE_OK;
-            const QVariant &value = values.at(i);
-
-            if (QSqlResultPrivate::isVariantNull(value)) {
-                res = sqlite3_bind_null(d->stmt, i + 1);
-            } else {
-                switch (value.userType()) {
-                case QMetaType::QByteArray: {
-                    const QByteArray *ba = static_cast<const QByteArray*>(value.constData());
-                    res = sqlite3_bind_blob(d->stmt, i + 1, ba->constData(),
-                                            ba->size(), SQLITE_STATIC);
-                    break; }
-                case QMetaType::Int:
-                case QMetaType::Bool:
-                    res = sqlite3_bind_int(d->stmt, i + 1, value.toInt());
-                    break;
-                case QMetaType::Double:
-                    res = sqlite3_bind_double(d->stmt, i + 1, value.toDouble());
-                    break;
-                case QMetaType::UInt:
-                case QMetaType::LongLong:
-                    res = sqlite3_bind_int64(d->stmt, i + 1, value.toLongLong());
-                    break;
-                case QMetaType::QDateTime: {
-                    const QDateTime dateTime = value.toDateTime();
-                    const QString str = dateTime.toString(Qt::ISODateWithMs);
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.data(),
-                                              int(str.size() * sizeof(ushort)),
-                                              SQLITE_TRANSIENT);
-                    break;
-                }
-                case QMetaType::QTime: {
-                    const QTime time = value.toTime();
-                    const QString str = time.toString(u"hh:mm:ss.zzz");
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.data(),
-                                              int(str.size() * sizeof(ushort)),
-                                              SQLITE_TRANSIENT);
-                    break;
-                }
-                case QMetaType::QString: {
-                    // lifetime of string == lifetime of its qvariant
-                    const QString *str = static_cast<const QString*>(value.constData());
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str->unicode(),
-                                              int(str->size()) * sizeof(QChar),
-                                              SQLITE_STATIC);
-                    break; }
-                default: {
-                    const QString str = value.toString();
-                    // SQLITE_TRANSIENT makes sure that sqlite buffers the data
-                    res = sqlite3_bind_text16(d->stmt, i + 1, str.data(),
-                                              int(str.size()) * sizeof(QChar),
-                                              SQLITE_TRANSIENT);
-                    break; }
-                }
-            }
+    QVarLengthArray<int> parameters;
+    if (d->mapParameters(values.size(), parameters)) {
+        for (qsizetype i = 0; i < parameters.size(); ++i) {
+            res = d->bindValue(int(i + 1), values.at(parameters.at(i)));
             if (res != SQLITE_OK) {
                 setLastError(qMakeError(d->drv_d_func()->access, QCoreApplication::translate("QSQLiteResult",
                              "Unable to bind parameters"), QSqlError::StatementError, res));
@@ -757,6 +869,7 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
     bool useQtVfs = false;
     bool useQtCaseFolding = false;
     bool openNoFollow = false;
+    int statementCacheSize = 32;
 #if QT_CONFIG(regularexpression)
     static const auto regexpConnectOption = "QSQLITE_ENABLE_REGEXP"_L1;
     bool defineRegexp = false;
@@ -774,6 +887,14 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
                 if (ok)
                     timeOut = nt;
             }
+        } else if (option.startsWith("QSQLITE_STATEMENT_CACHE_SIZE"_L1)) {
+            option = option.mid(28).trimmed();
+            if (option.startsWith(u'=')) {
+                bool ok;
+                const int size = option.mid(1).trimmed().toInt(&ok);
+                if (ok)
+                    statementCacheSize = qMax(size, 0);
+            }
         } else if (option == "QSQLITE_USE_QT_VFS"_L1) {
             useQtVfs = true;
         } else if (option == "QSQLITE_OPEN_READONLY"_L1) {
@@ -827,6 +948,7 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 
     if (res == SQLITE_OK) {
         sqlite3_busy_timeout(d->access, timeOut);
+        d->statementCache.setMaxCost(statementCacheSize);
         sqlite3_extended_result_codes(d->access, useExtendedResultCodes);
         setOpen(true);
         setOpenError(false);
@@ -865,6 +987,7 @@ void QSQLiteDriver::close()
     if (isOpen()) {
         for (QSQLiteResult *result : std::as_const(d->results))
             result->d_func()->finalize();
+        d->statementCache.clear();
 
         if (d->access && (d->notificationid.size() > 0)) {
             d->notificationid.clear();
@@ -0,0 +1,276 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QIODeviceLineReader>
+#include <QList>
+#ifndef QT_NO_NETWORK
+#include <QLocalServer>
+#include <QLocalSocket>
+#endif
+
+class tst_QIODeviceLineReader : public QObject
+{
+    Q_OBJECT
+private slots:
+    void readLines_data();
+    void readLines();
+    void readLinesInSmallChunks_data() { readLines_data(); }
+    void readLinesInSmallChunks();
+    void rangeFor();
+    void longLines();
+    void viewsStayValidUntilNextRead();
+    void utf8Line();
+    void noDevice();
+    void setDevice();
+    void partialLineFromSocket();
+};
+
+// Hands out at most three bytes per read() call, so that lines and line
+// terminators get split across buffer refills.
+class ChunkedDevice : public QIODevice
+{
+public:
+    explicit ChunkedDevice(const QByteArray &data) : data(data) {}
+    bool isSequential() const override { return true; }
+
+protected:
+    qint64 readData(char *out, qint64 maxlen) override
+    {
+        const qint64 n = qMin<qint64>(qMin<qint64>(maxlen, 3), data.size() - pos);
+        if (n <= 0)
+            return -1;
+        memcpy(out, data.constData() + pos, size_t(n));
+        pos += n;
+        return n;
+    }
+    qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+    QByteArray data;
+    qint64 pos = 0;
+};
+
+static QList<QByteArray> readAll(QIODeviceLineReader &reader)
+{
+    QList<QByteArray> lines;
+    while (reader.readNext()) {
+        if (reader.line().isNull())
+            return { "<null line>" };
+        lines.append(reader.line().toByteArray());
+    }
+    return lines;
+}
+
+void tst_QIODeviceLineReader::readLines_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QList<QByteArray>>("lines");
+
+    QTest::newRow("empty") << QByteArray() << QList<QByteArray>();
+    QTest::newRow("single-newline") << QByteArray("\n") << QList<QByteArray>{ "" };
+    QTest::newRow("no-terminator") << QByteArray("abc") << QList<QByteArray>{ "abc" };
+    QTest::newRow("lf") << QByteArray("a\nbb\nccc\n")
+                        << QList<QByteArray>{ "a", "bb", "ccc" };
+    QTest::newRow("crlf") << QByteArray("a\r\nbb\r\nccc\r\n")
+                          << QList<QByteArray>{ "a", "bb", "ccc" };
+    QTest::newRow("mixed") << QByteArray("a\r\nbb\nccc")
+                           << QList<QByteArray>{ "a", "bb", "ccc" };
+    QTest::newRow("empty-lines") << QByteArray("\n\r\n\nx\n\n")
+                                 << QList<QByteArray>{ "", "", "", "x", "" };
+    QTest::newRow("lone-cr") << QByteArray("a\rb\n") << QList<QByteArray>{ "a\rb" };
+    QTest::newRow("trailing-cr") << QByteArray("a\nb\r") << QList<QByteArray>{ "a", "b" };
+    QTest::newRow("nul-bytes") << QByteArray("a\0b\n\0\n", 6)
+                               << QList<QByteArray>{ QByteArray("a\0b", 3), QByteArray(1, '\0') };
+}
+
+void tst_QIODeviceLineReader::readLines()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QList<QByteArray>, lines);
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QIODeviceLineReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QVERIFY(!reader.atEnd());
+    QVERIFY(reader.line().isNull());
+
+    QCOMPARE(readAll(reader), lines);
+    QVERIFY(reader.atEnd());
+    QVERIFY(reader.line().isNull());
+    QVERIFY(!reader.readNext());
+}
+
+void tst_QIODeviceLineReader::readLinesInSmallChunks()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QList<QByteArray>, lines);
+
+    ChunkedDevice device(data);
+    QVERIFY(device.open(QIODevice::ReadOnly | QIODevice::Unbuffered));
+    QIODeviceLineReader reader(&device);
+    QCOMPARE(readAll(reader), lines);
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QIODeviceLineReader::rangeFor()
+{
+    QByteArray data("one\ntwo\r\nthree");
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QList<QByteArray> lines;
+    QIODeviceLineReader reader(&buffer);
+    for (QByteArrayView line : reader)
+        lines.append(line.toByteArray());
+    QCOMPARE(lines, (QList<QByteArray>{ "one", "two", "three" }));
+    QVERIFY(reader.atEnd());
+    QCOMPARE(reader.begin(), reader.end());
+}
+
+void tst_QIODeviceLineReader::longLines()
+{
+    // Lines longer than the reader's 64 KiB chunk, mixed with short ones,
+    // so that lines cross refills and the buffer has to grow.
+    QList<QByteArray> expected;
+    QByteArray data;
+    for (int i = 0; i < 20; ++i) {
+        const qsizetype length = (i % 4 == 0) ? 100'000 + i * 7919 : i * 13;
+        QByteArray line(length, char('a' + i));
+        expected.append(line);
+        data += line;
+        data += (i % 2) ? "\r\n" : "\n";
+    }
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QIODeviceLineReader reader(&buffer);
+    const QList<QByteArray> lines = readAll(reader);
+    QCOMPARE(lines.size(), expected.size());
+    for (qsizetype i = 0; i < lines.size(); ++i)
+        QCOMPARE(lines.at(i), expected.at(i));
+}
+
+void tst_QIODeviceLineReader::viewsStayValidUntilNextRead()
+{
+    QByteArray data;
+    for (int i = 0; i < 10'000; ++i)
+        data += QByteArray::number(i) + '\n';
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QIODeviceLineReader reader(&buffer);
+    for (int i = 0; i < 10'000; ++i) {
+        QVERIFY(reader.readNext());
+        const QByteArrayView line = reader.line();
+        // repeated access returns the same view
+        QCOMPARE(reader.line().data(), line.data());
+        QCOMPARE(line, QByteArray::number(i));
+    }
+    QVERIFY(!reader.readNext());
+}
+
+void tst_QIODeviceLineReader::utf8Line()
+{
+    QByteArray data("gr\xc3\xbc\xc3\x9f" "e\n\xe2\x82\xac\n");
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QIODeviceLineReader reader(&buffer);
+
+    QVERIFY(reader.readNext());
+    QCOMPARE(reader.utf8Line().size(), 7);
+    QCOMPARE(reader.utf8Line().toString(), u"grüße");
+    QCOMPARE(reader.utf8Line().data(), reinterpret_cast<const QUtf8StringView::storage_type *>(reader.line().data()));
+    QVERIFY(reader.readNext());
+    QCOMPARE(reader.utf8Line().toString(), u"€");
+    QVERIFY(!reader.readNext());
+    QVERIFY(reader.utf8Line().isNull());
+}
+
+void tst_QIODeviceLineReader::noDevice()
+{
+    QIODeviceLineReader reader;
+    QCOMPARE(reader.device(), nullptr);
+    QVERIFY(!reader.readNext());
+    QVERIFY(reader.atEnd());
+    QVERIFY(reader.line().isNull());
+    QCOMPARE(reader.begin(), reader.end());
+}
+
+void tst_QIODeviceLineReader::setDevice()
+{
+    QByteArray first("a\nb\nc\n");
+    QByteArray second("x\ny\n");
+    QBuffer buffer1(&first);
+    QBuffer buffer2(&second);
+    QVERIFY(buffer1.open(QIODevice::ReadOnly));
+    QVERIFY(buffer2.open(QIODevice::ReadOnly));
+
+    QIODeviceLineReader reader(&buffer1);
+    QVERIFY(reader.readNext());
+    QCOMPARE(reader.line(), "a");
+
+    // the rest of the first device's buffered data is discarded
+    reader.setDevice(&buffer2);
+    QCOMPARE(reader.device(), &buffer2);
+    QVERIFY(reader.line().isNull());
+    QCOMPARE(readAll(reader), (QList<QByteArray>{ "x", "y" }));
+    QVERIFY(reader.atEnd());
+
+    reader.setDevice(nullptr);
+    QVERIFY(!reader.atEnd());
+    QVERIFY(!reader.readNext());
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QIODeviceLineReader::partialLineFromSocket()
+{
+#ifdef QT_NO_NETWORK
+    QSKIP("This test requires QtNetwork");
+#else
+    QLocalServer server;
+    QVERIFY(server.listen(QLatin1StringView("tst_qiodevicelinereader_") + QString::number(QCoreApplication::applicationPid())));
+    QLocalSocket client;
+    client.connectToServer(server.serverName());
+    QVERIFY(client.waitForConnected());
+    QVERIFY(server.waitForNewConnection(5000));
+    QLocalSocket *socket = server.nextPendingConnection();
+    QVERIFY(socket);
+
+    QIODeviceLineReader reader(socket);
+    QVERIFY(!reader.readNext());
+    QVERIFY(!reader.atEnd());
+
+    // half a line is kept until the rest arrives
+    client.write("hello wor");
+    QVERIFY(client.waitForBytesWritten());
+    QVERIFY(socket->waitForReadyRead());
+    QVERIFY(!reader.readNext());
+    QVERIFY(!reader.atEnd());
+    QVERIFY(reader.line().isNull());
+
+    client.write("ld\r\nlast");
+    QVERIFY(client.waitForBytesWritten());
+    QVERIFY(socket->waitForReadyRead());
+    QVERIFY(reader.readNext());
+    QCOMPARE(reader.line(), "hello world");
+    QVERIFY(!reader.readNext());
+    QVERIFY(!reader.atEnd());
+
+    // the unterminated rest is the last line once the peer is gone
+    client.disconnectFromServer();
+    if (socket->state() != QLocalSocket::UnconnectedState)
+        QVERIFY(socket->waitForDisconnected());
+    QVERIFY(reader.readNext());
+    QCOMPARE(reader.line(), "last");
+    QVERIFY(!reader.readNext());
+    QVERIFY(reader.atEnd());
+#endif
+}
+
+QTEST_GUILESS_MAIN(tst_QIODeviceLineReader)
+#include "tst_qiodevicelinereader.moc"
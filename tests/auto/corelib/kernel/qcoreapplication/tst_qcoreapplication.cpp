@@ -511,6 +511,65 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+// Queued calls are posted without locking the receiving thread's event list;
+// check that none get lost or reordered, even when the receiver moves to
+// another thread while they are being posted.
+void tst_QCoreApplication::queuedCallsFromManyThreads()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    constexpr int ThreadCount = 4;
+    constexpr int CallsPerThread = 5000;
+
+    QObject receiver;
+    QMutex mutex;
+    QList<int> received[ThreadCount];
+    QAtomicInt total;
+    const auto post = [&](int thread) {
+        for (int i = 0; i < CallsPerThread; ++i) {
+            QMetaObject::invokeMethod(&receiver, [&, thread, i] {
+                QMutexLocker locker(&mutex);
+                received[thread].append(i);
+                total.ref();
+            }, Qt::QueuedConnection);
+        }
+    };
+
+    QThread target;
+    target.start();
+    const auto cleanup = qScopeGuard([&] {
+        target.quit();
+        target.wait();
+    });
+
+    std::unique_ptr<QThread> threads[ThreadCount];
+    for (int i = 0; i < ThreadCount; ++i) {
+        threads[i].reset(QThread::create(post, i));
+        threads[i]->start();
+    }
+
+    // deliver some in this thread, then move the receiver while the
+    // others are still being posted
+    QTRY_VERIFY(total.loadRelaxed() > 0);
+    receiver.moveToThread(&target);
+
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+    QTRY_COMPARE(total.loadRelaxed(), ThreadCount * CallsPerThread);
+
+    QMutexLocker locker(&mutex);
+    for (const QList<int> &calls : received) {
+        QCOMPARE(calls.size(), CallsPerThread);
+        QVERIFY(std::is_sorted(calls.cbegin(), calls.cend()));
+    }
+
+    // moveToThread() cannot be called from another thread
+    QMetaObject::invokeMethod(&receiver, [&] { receiver.moveToThread(app.thread()); },
+                              Qt::BlockingQueuedConnection);
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
@@ -18,6 +18,20 @@ static bool glibDisabled = []() {
 }();
 #endif
 
+#ifdef USE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_EPOLL", "1");
+    return true;
+}();
+#endif
+
+#ifdef USE_IO_URING
+static bool ioUringEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_IO_URING", "1");
+    return true;
+}();
+#endif
+
 #include <chrono>
 
 #ifndef QTEST_THROW_ON_FAIL
@@ -112,6 +126,12 @@ bool tst_QEventDispatcher::event(QEvent *e)
 // drain the system event queue after the test starts to avoid destabilizing the test functions
 void tst_QEventDispatcher::initTestCase()
 {
+    // the io_uring dispatcher falls back silently when the kernel lacks it
+#ifdef USE_IO_URING
+    if (!eventDispatcher->inherits("QEventDispatcherIoUring"))
+        QSKIP("io_uring is not supported on this system");
+#endif
+
     QDeadlineTimer deadline(CoarseTimerInterval);
     while (!deadline.hasExpired() && eventDispatcher->processEvents(QEventLoop::AllEvents))
         ;
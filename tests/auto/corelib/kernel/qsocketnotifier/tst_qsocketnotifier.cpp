@@ -5,6 +5,7 @@
 #include <QtTest/QSignalSpy>
 #include <QtTest/QTestEventLoop>
 
+#include <QtCore/QAbstractEventDispatcher>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QTimer>
 #include <QtCore/QSocketNotifier>
@@ -24,12 +25,27 @@
 #  undef min
 #endif // Q_CC_MSVC
 
+#ifdef USE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_EPOLL", "1");
+    return true;
+}();
+#endif
+
+#ifdef USE_IO_URING
+static bool ioUringEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_IO_URING", "1");
+    return true;
+}();
+#endif
+
 using namespace std::chrono_literals;
 
 class tst_QSocketNotifier : public QObject
 {
     Q_OBJECT
 private slots:
+    void initTestCase();
     void constructing();
     void unexpectedDisconnection();
     void mixingWithTimers();
@@ -62,6 +78,15 @@ static QHostAddress makeNonAny(const QHostAddress &address,
     return address;
 }
 
+void tst_QSocketNotifier::initTestCase()
+{
+    // the io_uring dispatcher falls back silently when the kernel lacks it
+#ifdef USE_IO_URING
+    if (!QAbstractEventDispatcher::instance()->inherits("QEventDispatcherIoUring"))
+        QSKIP("io_uring is not supported on this system");
+#endif
+}
+
 void tst_QSocketNotifier::constructing()
 {
     const qintptr fd = 15;
@@ -100,6 +100,9 @@ private Q_SLOTS:
     void parseTopLevelErrors_data();
     void parseTopLevelErrors();
     void testParser();
+    void parseWithArena_data();
+    void parseWithArena();
+    void arenaMutation();
 
     void assignToDocument();
 
@@ -2924,6 +2927,74 @@ void tst_QtJson::testParser()
     QVERIFY(!val.isUndefined());
 }
 
+void tst_QtJson::parseWithArena_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QTest::newRow("test.json") << QString("test.json");
+    QTest::newRow("test2.json") << QString("test2.json");
+    QTest::newRow("test3.json") << QString("test3.json");
+}
+
+void tst_QtJson::parseWithArena()
+{
+    QFETCH(QString, fileName);
+
+    QFile file(testDataDir + '/' + fileName);
+    QVERIFY(file.open(QFile::ReadOnly));
+    QByteArray testJson = file.readAll();
+
+    QJsonParseError error;
+    const QJsonDocument expected = QJsonDocument::fromJson(testJson, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    QJsonDocument doc = QJsonDocument::fromJson(testJson, QJsonDocument::ParseOption::UseArena,
+                                                &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QCOMPARE(doc, expected);
+    QCOMPARE(doc.toJson(), expected.toJson());
+
+    // errors are reported the same way
+    testJson.chop(testJson.size() / 2);
+    doc = QJsonDocument::fromJson(testJson, QJsonDocument::ParseOption::UseArena, &error);
+    QVERIFY(doc.isNull());
+    QJsonParseError heapError;
+    QJsonDocument::fromJson(testJson, &heapError);
+    QCOMPARE(error.error, heapError.error);
+    QCOMPARE(error.offset, heapError.offset);
+}
+
+void tst_QtJson::arenaMutation()
+{
+    const QByteArray json = R"({"a": [1, "xyz", {"b": "a string long enough not to be inlined"}],
+                                "c": true})";
+    QJsonDocument doc = QJsonDocument::fromJson(json, QJsonDocument::ParseOption::UseArena);
+    QVERIFY(doc.isObject());
+
+    // sub-values outlive the document
+    QJsonArray inner = doc.object().value(QLatin1String("a")).toArray();
+    QJsonObject innermost = inner.at(2).toObject();
+    doc = QJsonDocument();
+    QCOMPARE(inner.size(), 3);
+    QCOMPARE(inner.at(1).toString(), QLatin1String("xyz"));
+    QCOMPARE(innermost.value(QLatin1String("b")).toString(), QLatin1String("a string long enough not to be inlined"));
+
+    // mutating copies the container out of the arena, leaving others intact
+    QJsonArray copy = inner;
+    inner.append(QString("appended"));
+    inner[0] = 42;
+    QCOMPARE(inner.size(), 4);
+    QCOMPARE(inner.at(0).toInt(), 42);
+    QCOMPARE(inner.at(3).toString(), QLatin1String("appended"));
+    QCOMPARE(copy.size(), 3);
+    QCOMPARE(copy.at(0).toInt(), 1);
+
+    innermost.insert(QLatin1String("c"), false);
+    QCOMPARE(innermost.size(), 2);
+    QCOMPARE(innermost.value(QLatin1String("b")).toString(), QLatin1String("a string long enough not to be inlined"));
+    QCOMPARE(copy.at(2).toObject().size(), 1);
+}
+
 void tst_QtJson::assignToDocument()
 {
     {
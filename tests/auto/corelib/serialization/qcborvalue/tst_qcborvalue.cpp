@@ -103,6 +103,9 @@ private slots:
     void fromCborStreamReaderByteArray();
     void fromCborStreamReaderIODevice_data() { fromCbor_data(); }
     void fromCborStreamReaderIODevice();
+    void fromCborArena_data() { fromCbor_data(); }
+    void fromCborArena();
+    void arenaMutation();
     void validation_data();
     void validation();
     void extendedTypeValidation_data();
@@ -2481,6 +2484,63 @@ void tst_QCborValue::fromCborStreamReaderIODevice()
     fromCbor_common(doCheck);
 }
 
+void tst_QCborValue::fromCborArena()
+{
+    auto doCheck = [](const QCborValue &expected, const QByteArray &data) {
+        QCborParserError error;
+        QCborValue decoded =
+                QCborValue::fromCbor(data, QCborValue::DecodingOption::UseArena, &error);
+        QVERIFY2(error.error == QCborError(), qPrintable(error.errorString()));
+        QCOMPARE(error.offset, data.size());
+        QVERIFY(decoded == expected);
+        QVERIFY(expected == decoded);
+        QCOMPARE(decoded.toCbor(), expected.toCbor());
+    };
+
+    fromCbor_common(doCheck);
+}
+
+void tst_QCborValue::arenaMutation()
+{
+    // {"a": [1, "xyz", {"b": h'0102'}], "c": "long string that is not inlined"}
+    const QCborMap expected = {
+        { "a", QCborArray{ 1, "xyz", QCborMap{ { "b", QByteArray("\1\2") } } } },
+        { "c", "long string that is not inlined" },
+    };
+    const QByteArray data = expected.toCborValue().toCbor();
+
+    QCborValue decoded = QCborValue::fromCbor(data, QCborValue::DecodingOption::UseArena);
+    QCOMPARE(decoded, QCborValue(expected));
+
+    // sub-containers outlive the top-level value
+    QCborArray inner = decoded.toMap().value("a").toArray();
+    QCborMap innermost = inner.at(2).toMap();
+    decoded = QCborValue();
+    QCOMPARE(inner.size(), 3);
+    QCOMPARE(inner.at(1).toString(), "xyz");
+    QCOMPARE(innermost.value("b").toByteArray(), QByteArray("\1\2"));
+
+    // mutating copies the container out of the arena, leaving others intact
+    QCborArray copy = inner;
+    inner.append("appended");
+    inner[0] = 42;
+    QCOMPARE(inner.size(), 4);
+    QCOMPARE(inner.at(0).toInteger(), 42);
+    QCOMPARE(inner.at(3).toString(), "appended");
+    QCOMPARE(copy.size(), 3);
+    QCOMPARE(copy.at(0).toInteger(), 1);
+
+    innermost.insert(QLatin1StringView("c"), "d");
+    QCOMPARE(innermost.size(), 2);
+    QCOMPARE(innermost.value("b").toByteArray(), QByteArray("\1\2"));
+    QCOMPARE(copy.at(2).toMap().size(), 1);
+
+    QCborMap top = QCborValue::fromCbor(data, QCborValue::DecodingOption::UseArena).toMap();
+    top.remove(QLatin1StringView("a"));
+    QCOMPARE(top.size(), 1);
+    QCOMPARE(top.value("c").toString(), "long string that is not inlined");
+}
+
 #include "../cborlargedatavalidation.cpp"
 
 void tst_QCborValue::validation_data()
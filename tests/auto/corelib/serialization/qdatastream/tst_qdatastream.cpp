@@ -9,6 +9,8 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QtEndian>
+#include <QSpan>
+#include <QVarLengthArray>
 
 #include <QtGui/QBitmap>
 #include <QtGui/QPainter>
@@ -182,6 +184,11 @@ private slots:
 
     void status_QList_QVector();
 
+    void podContainers_data();
+    void podContainers();
+    void rawSpan_data() { podContainers_data(); }
+    void rawSpan();
+
     void streamToAndFromQByteArray();
 
     void streamRealDataTypes();
@@ -3239,6 +3246,212 @@ void tst_QDataStream::status_QList_QVector()
     }
 }
 
+enum class PodEnum : quint16 { A = 1, B = 0x1234 };
+
+// streamed in a narrower format than its underlying type
+enum class NarrowEnum : quint32 { A = 1, B = 200 };
+
+static QDataStream &operator<<(QDataStream &s, NarrowEnum e)
+{
+    return s << quint8(e);
+}
+
+static QDataStream &operator>>(QDataStream &s, NarrowEnum &e)
+{
+    quint8 v;
+    s >> v;
+    e = NarrowEnum(v);
+    return s;
+}
+
+template <typename T>
+static QByteArray elementWise(const QDataStream &format, const QList<T> &list, bool withSize)
+{
+    QByteArray ba;
+    QDataStream s(&ba, QIODevice::WriteOnly);
+    s.setVersion(format.version());
+    s.setByteOrder(format.byteOrder());
+    s.setFloatingPointPrecision(format.floatingPointPrecision());
+    if (withSize)
+        s << quint32(list.size());
+    for (const T &t : list)
+        s << t;
+    return ba;
+}
+
+template <typename T>
+static void checkPodList(const QDataStream &format, const QList<T> &list)
+{
+    const QByteArray expected = elementWise(format, list, true);
+
+    QByteArray ba;
+    {
+        QDataStream s(&ba, QIODevice::WriteOnly);
+        s.setVersion(format.version());
+        s.setByteOrder(format.byteOrder());
+        s.setFloatingPointPrecision(format.floatingPointPrecision());
+        s << list;
+        QCOMPARE(s.status(), QDataStream::Ok);
+    }
+    QCOMPARE(ba, expected);
+
+    // compare with reading element by element, which may lose precision
+    QList<T> expectedRead;
+    {
+        QDataStream s(ba);
+        s.setVersion(format.version());
+        s.setByteOrder(format.byteOrder());
+        s.setFloatingPointPrecision(format.floatingPointPrecision());
+        quint32 size;
+        s >> size;
+        for (quint32 i = 0; i < size; ++i) {
+            T t;
+            s >> t;
+            expectedRead << t;
+        }
+    }
+
+    QDataStream s(ba);
+    s.setVersion(format.version());
+    s.setByteOrder(format.byteOrder());
+    s.setFloatingPointPrecision(format.floatingPointPrecision());
+    QList<T> read;
+    s >> read;
+    QCOMPARE(s.status(), QDataStream::Ok);
+    QVERIFY(s.atEnd());
+    QCOMPARE(read, expectedRead);
+
+    // truncated data
+    QDataStream truncated(ba.first(ba.size() - 1));
+    truncated.setVersion(format.version());
+    truncated.setByteOrder(format.byteOrder());
+    truncated.setFloatingPointPrecision(format.floatingPointPrecision());
+    truncated >> read;
+    QCOMPARE(truncated.status(), QDataStream::ReadPastEnd);
+    QVERIFY(read.isEmpty());
+}
+
+void tst_QDataStream::podContainers_data()
+{
+    QTest::addColumn<QDataStream::ByteOrder>("byteOrder");
+    QTest::addColumn<QDataStream::FloatingPointPrecision>("precision");
+    QTest::addColumn<int>("version");
+
+    QTest::newRow("big-endian") << QDataStream::BigEndian << QDataStream::DoublePrecision
+                                << int(QDataStream::Qt_DefaultCompiledVersion);
+    QTest::newRow("little-endian") << QDataStream::LittleEndian << QDataStream::DoublePrecision
+                                   << int(QDataStream::Qt_DefaultCompiledVersion);
+    QTest::newRow("big-endian-single") << QDataStream::BigEndian << QDataStream::SinglePrecision
+                                       << int(QDataStream::Qt_DefaultCompiledVersion);
+    QTest::newRow("little-endian-single") << QDataStream::LittleEndian
+                                          << QDataStream::SinglePrecision
+                                          << int(QDataStream::Qt_DefaultCompiledVersion);
+    QTest::newRow("qt4.5") << QDataStream::BigEndian << QDataStream::DoublePrecision
+                           << int(QDataStream::Qt_4_5);
+}
+
+void tst_QDataStream::podContainers()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+    QFETCH(QDataStream::FloatingPointPrecision, precision);
+    QFETCH(int, version);
+
+    QDataStream format;
+    format.setByteOrder(byteOrder);
+    format.setFloatingPointPrecision(precision);
+    format.setVersion(version);
+
+    constexpr int Size = 10000;     // larger than the byte-swapping buffer
+    QList<char> chars;
+    QList<qint16> shorts;
+    QList<quint32> uints;
+    QList<qint64> longs;
+    QList<char16_t> utf16;
+    QList<float> floats;
+    QList<double> doubles;
+    QList<QPointF> points;
+    QList<PodEnum> enums;
+    QList<NarrowEnum> narrowEnums;
+    for (int i = 0; i < Size; ++i) {
+        chars << char(i);
+        shorts << qint16(i * 7 - Size);
+        uints << quint32(i) * 0x10001u;
+        longs << (qint64(i) << 33) - i;
+        utf16 << char16_t(0x1234 + i);
+        floats << i * 0.25f;
+        doubles << i * -1.5e10;
+        points << QPointF(i, -0.5 * i);
+        enums << (i & 1 ? PodEnum::A : PodEnum::B);
+        narrowEnums << (i & 1 ? NarrowEnum::A : NarrowEnum::B);
+    }
+
+    checkPodList(format, chars);
+    checkPodList(format, shorts);
+    checkPodList(format, uints);
+    checkPodList(format, longs);
+    checkPodList(format, utf16);
+    checkPodList(format, floats);
+    checkPodList(format, doubles);
+    checkPodList(format, points);
+    checkPodList(format, enums);
+    checkPodList(format, narrowEnums);
+    checkPodList(format, QList<qint32>());
+}
+
+void tst_QDataStream::rawSpan()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+    QFETCH(QDataStream::FloatingPointPrecision, precision);
+    QFETCH(int, version);
+
+    const std::vector<double> doubles = { 0.5, -1, 1e300, 42 };
+    const QVarLengthArray<qint32, 4> ints = { 1, -2, 0x12345678, 0 };
+    const QList<QString> strings = { u"a"_s, u"bc"_s };  // not trivially streamable
+
+    QByteArray ba;
+    {
+        QDataStream s(&ba, QIODevice::WriteOnly);
+        s.setByteOrder(byteOrder);
+        s.setFloatingPointPrecision(precision);
+        s.setVersion(version);
+        s.writeRawSpan(QSpan(doubles));
+        s.writeRawSpan(QSpan(ints));
+        s.writeRawSpan(QSpan(strings));
+        QCOMPARE(s.status(), QDataStream::Ok);
+
+        // no size prefix, elements encoded as by operator<<()
+        QDataStream format;
+        format.setByteOrder(byteOrder);
+        format.setFloatingPointPrecision(precision);
+        format.setVersion(version);
+        QCOMPARE(ba, elementWise(format, QList<double>(doubles.begin(), doubles.end()), false)
+                     + elementWise(format, QList<qint32>(ints.begin(), ints.end()), false)
+                     + elementWise(format, strings, false));
+    }
+
+    QDataStream s(ba);
+    s.setByteOrder(byteOrder);
+    s.setFloatingPointPrecision(precision);
+    s.setVersion(version);
+    std::vector<double> readDoubles(doubles.size());
+    QVarLengthArray<qint32, 4> readInts(ints.size());
+    QList<QString> readStrings(strings.size());
+    s.readRawSpan(QSpan(readDoubles));
+    s.readRawSpan(QSpan(readInts));
+    s.readRawSpan(QSpan(readStrings));
+    QCOMPARE(s.status(), QDataStream::Ok);
+    QVERIFY(s.atEnd());
+    if (precision == QDataStream::DoublePrecision || version < QDataStream::Qt_4_6)
+        QCOMPARE(readDoubles, doubles);
+    QCOMPARE(readInts, ints);
+    QCOMPARE(readStrings, strings);
+
+    // reading past the end zeroes the remainder
+    s.readRawSpan(QSpan(readInts));
+    QCOMPARE(s.status(), QDataStream::ReadPastEnd);
+    QCOMPARE(readInts, QVarLengthArray<qint32>(ints.size(), 0));
+}
+
 void tst_QDataStream::streamToAndFromQByteArray()
 {
     QByteArray data;
@@ -0,0 +1,556 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qjsonstreamreader.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QTest>
+#include <QBuffer>
+
+using namespace Qt::StringLiterals;
+
+Q_DECLARE_METATYPE(QJsonParseError::ParseError)
+
+class tst_QJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void scalars_data();
+    void scalars();
+    void strings_data();
+    void strings();
+    void containers();
+    void documents_data();
+    void documents();
+    void incremental_data() { documents_data(); }
+    void incremental();
+    void device_data() { documents_data(); }
+    void device();
+    void skip();
+    void skipIncremental();
+    void leaveEarly();
+    void sequence();
+    void errors_data();
+    void errors();
+    void prematureEnd();
+    void deepNesting();
+    void largeDevice();
+};
+
+// builds the value the reader is positioned on, the way QJsonDocument would
+static QJsonValue readValue(QJsonStreamReader &reader)
+{
+    QJsonValue result;
+    switch (reader.type()) {
+    case QJsonStreamReader::Null:
+        result = QJsonValue::Null;
+        break;
+    case QJsonStreamReader::Bool:
+        result = reader.toBool();
+        break;
+    case QJsonStreamReader::Number:
+        if (qint64 n = reader.toInteger(-1); n != -1 || reader.toDouble() == -1)
+            result = n;
+        else
+            result = reader.toDouble();
+        break;
+    case QJsonStreamReader::String:
+        result = reader.toString();
+        break;
+    case QJsonStreamReader::Array: {
+        QJsonArray array;
+        reader.enterContainer();
+        while (reader.hasNext())
+            array.append(readValue(reader));
+        if (reader.lastError().error != QJsonParseError::NoError || !reader.leaveContainer())
+            return QJsonValue::Undefined;
+        return array;
+    }
+    case QJsonStreamReader::Object: {
+        QJsonObject object;
+        reader.enterContainer();
+        while (reader.hasNext()) {
+            const QString key = reader.toString();
+            if (!reader.next())
+                return QJsonValue::Undefined;
+            object.insert(key, readValue(reader));
+        }
+        if (reader.lastError().error != QJsonParseError::NoError || !reader.leaveContainer())
+            return QJsonValue::Undefined;
+        return object;
+    }
+    case QJsonStreamReader::Invalid:
+        return QJsonValue::Undefined;
+    }
+    reader.next();
+    return result;
+}
+
+// logs what the reader finds, calling moreData() whenever it runs out of input
+template <typename MoreData>
+static QStringList tokens(QJsonStreamReader &reader, MoreData moreData)
+{
+    QStringList result;
+    for (;;) {
+        const QJsonParseError::ParseError error = reader.lastError().error;
+        if (error == QJsonParseError::PrematureEndOfDocument
+                || (reader.isInvalid() && !error && reader.containerDepth() == 0)) {
+            if (!moreData())
+                break;
+        } else if (error) {
+            result << u"error"_s;
+            break;
+        } else if (reader.isInvalid()) {
+            result << u"end"_s;
+            reader.leaveContainer();
+        } else if (reader.isContainer()) {
+            result << (reader.isArray() ? u"["_s : u"{"_s);
+            reader.enterContainer();
+        } else {
+            const QString value = reader.isString() ? reader.toString()
+                                                    : QString::fromLatin1(reader.rawValue());
+            result << QString::number(reader.type()) + u':' + value;
+            reader.next();
+        }
+    }
+    return result;
+}
+
+void tst_QJsonStreamReader::basics()
+{
+    QJsonStreamReader reader;
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.device(), nullptr);
+    QCOMPARE(reader.containerDepth(), 0);
+    QCOMPARE(reader.parentContainerType(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QVERIFY(!reader.hasNext());
+    QVERIFY(!reader.next());
+
+    reader.addData("  [] ");
+    QVERIFY(reader.isArray());
+    QCOMPARE(reader.currentOffset(), 2);
+
+    reader.clear();
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+
+    QBuffer buffer;
+    buffer.setData("{}");
+    buffer.open(QIODevice::ReadOnly);
+    reader.setDevice(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QVERIFY(reader.isObject());
+}
+
+void tst_QJsonStreamReader::scalars_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QJsonStreamReader::Type>("type");
+    QTest::addColumn<QByteArray>("raw");
+
+    QTest::newRow("null") << "null"_ba << QJsonStreamReader::Null << "null"_ba;
+    QTest::newRow("true") << "true"_ba << QJsonStreamReader::Bool << "true"_ba;
+    QTest::newRow("false") << " false"_ba << QJsonStreamReader::Bool << "false"_ba;
+    QTest::newRow("zero") << "0 "_ba << QJsonStreamReader::Number << "0"_ba;
+    QTest::newRow("negative") << "-12 "_ba << QJsonStreamReader::Number << "-12"_ba;
+    QTest::newRow("fraction") << "1.5\n"_ba << QJsonStreamReader::Number << "1.5"_ba;
+    QTest::newRow("exponent") << "-2.5e+3 "_ba << QJsonStreamReader::Number << "-2.5e+3"_ba;
+    QTest::newRow("string") << "\"abc\""_ba << QJsonStreamReader::String << "abc"_ba;
+    QTest::newRow("bom") << "\xef\xbb\xbf\"abc\""_ba << QJsonStreamReader::String << "abc"_ba;
+    // the data given on construction is complete, so numbers end with it
+    QTest::newRow("whole-integer") << "42"_ba << QJsonStreamReader::Number << "42"_ba;
+    QTest::newRow("whole-double") << "-1.5e3"_ba << QJsonStreamReader::Number << "-1.5e3"_ba;
+    QTest::newRow("whole-zero") << "0"_ba << QJsonStreamReader::Number << "0"_ba;
+}
+
+void tst_QJsonStreamReader::scalars()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QJsonStreamReader::Type, type);
+    QFETCH(QByteArray, raw);
+
+    QJsonStreamReader reader(data);
+    QCOMPARE(reader.type(), type);
+    QCOMPARE(reader.rawValue(), raw);
+    QCOMPARE(reader.containerDepth(), 0);
+    QVERIFY(reader.hasNext());
+
+    const QByteArray bom = "\xef\xbb\xbf";
+    const QByteArray json = data.startsWith(bom) ? data.sliced(bom.size()) : data;
+    const QJsonDocument doc = QJsonDocument::fromJson('[' + json + ']');
+    QCOMPARE(readValue(reader), doc.array().at(0));
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+}
+
+void tst_QJsonStreamReader::strings_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QString>("expected");
+    QTest::addColumn<bool>("hasView");
+
+    QTest::newRow("empty") << "\"\""_ba << QString("") << true;
+    QTest::newRow("ascii") << "\"Hello\""_ba << u"Hello"_s << true;
+    QTest::newRow("utf8") << "\"R\xc3\xa9sum\xc3\xa9 \xf0\x9f\x98\x80\""_ba
+                          << u"Résumé \U0001F600"_s << true;
+    QTest::newRow("escapes") << R"("a\"b\\c\/d\n\t")"_ba << u"a\"b\\c/d\n\t"_s << false;
+    QTest::newRow("unicode-escape") << R"("\u00e9\ud83d\ude00")"_ba << u"é\U0001F600"_s << false;
+    QTest::newRow("escaped-quote-at-end") << R"("\"")"_ba << u"\""_s << false;
+}
+
+void tst_QJsonStreamReader::strings()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QString, expected);
+    QFETCH(bool, hasView);
+
+    QJsonStreamReader reader(data);
+    QVERIFY(reader.isString());
+    QCOMPARE(reader.toString(), expected);
+    QCOMPARE(reader.stringView().isNull(), !hasView);
+    if (hasView)
+        QCOMPARE(reader.stringView(), expected);
+    QCOMPARE(reader.rawValue(), data.sliced(1, data.size() - 2));
+}
+
+void tst_QJsonStreamReader::containers()
+{
+    QJsonStreamReader reader(R"({"a": [1, "x", null], "b": {"c": true}, "d": {}})"_ba);
+    QVERIFY(reader.isObject());
+    QVERIFY(reader.isContainer());
+    QVERIFY(reader.rawValue().isEmpty());
+    QVERIFY(reader.enterContainer());
+    QCOMPARE(reader.containerDepth(), 1);
+    QCOMPARE(reader.parentContainerType(), QJsonStreamReader::Object);
+
+    QVERIFY(reader.isString());
+    QCOMPARE(reader.stringView(), "a");
+    QCOMPARE(reader.currentOffset(), 1);
+    QVERIFY(reader.next());
+    QVERIFY(reader.isArray());
+    QCOMPARE(reader.currentOffset(), 6);
+    QVERIFY(reader.enterContainer());
+    QCOMPARE(reader.parentContainerType(), QJsonStreamReader::Array);
+    QVERIFY(reader.isNumber());
+    QCOMPARE(reader.toInteger(), 1);
+    QCOMPARE(reader.toDouble(), 1.0);
+    QVERIFY(reader.next());
+    QCOMPARE(reader.toString(), "x");
+    QVERIFY(reader.next());
+    QVERIFY(reader.isNull());
+    QVERIFY(reader.next());
+    QVERIFY(!reader.hasNext());
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.containerDepth(), 1);
+
+    QCOMPARE(reader.stringView(), "b");
+    QVERIFY(reader.next());
+    QVERIFY(reader.enterContainer());
+    QCOMPARE(reader.stringView(), "c");
+    QVERIFY(reader.next());
+    QVERIFY(reader.isBool());
+    QVERIFY(reader.toBool());
+    QVERIFY(reader.next());
+    QVERIFY(!reader.hasNext());
+    QVERIFY(reader.leaveContainer());
+
+    QCOMPARE(reader.stringView(), "d");
+    QVERIFY(reader.next());
+    QVERIFY(reader.enterContainer());
+    QVERIFY(!reader.hasNext());
+    QVERIFY(reader.leaveContainer());
+
+    QVERIFY(!reader.hasNext());
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.containerDepth(), 0);
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+}
+
+void tst_QJsonStreamReader::documents_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("empty-array") << "[]"_ba;
+    QTest::newRow("empty-object") << "{ }"_ba;
+    QTest::newRow("nested-arrays") << "[[], [[]], [[[1]]], 2]"_ba;
+    QTest::newRow("numbers")
+            << "[0, -0, 1, -1, 1.0, 0.5, 1e3, 1E-3, 9007199254740993, -9223372036854775808,"
+               " 1.7976931348623157e308, 123456789012345678901234567890]"_ba;
+    QTest::newRow("literals") << "[true, false, null, [true], {\"n\": null}]"_ba;
+    QTest::newRow("strings")
+            << R"(["", "plain", "esc\"aped\\", "\u0041\u00e9", "caf\u00e9 \ud83d\ude00"])"_ba;
+    QTest::newRow("object") << R"({"a": 1, "b": [1, 2, {"c": "d"}], "e": {"f": {"g": null}}})"_ba;
+    QTest::newRow("whitespace") << " \r\n\t{ \"a\" \n:\t[ 1 ,2\r, 3 ] , \"b\":{} }\n "_ba;
+    QTest::newRow("utf8-keys") << "{\"\xc3\xa9t\xc3\xa9\": \"\xe2\x82\xac\"}"_ba;
+}
+
+void tst_QJsonStreamReader::documents()
+{
+    QFETCH(QByteArray, data);
+
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(data, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    QJsonStreamReader reader(data);
+    const QJsonValue value = readValue(reader);
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QCOMPARE(value, doc.isArray() ? QJsonValue(doc.array()) : QJsonValue(doc.object()));
+}
+
+void tst_QJsonStreamReader::incremental()
+{
+    QFETCH(QByteArray, data);
+    QJsonStreamReader reader(data);
+    const QStringList expected = tokens(reader, [] { return false; });
+    QCOMPARE(expected.last(), "end");
+
+    // feed the data one byte at a time
+    reader.clear();
+    qsizetype fed = 0;
+    const QStringList result = tokens(reader, [&] {
+        if (fed == data.size())
+            return false;
+        reader.addData(data.mid(fed++, 1));
+        return true;
+    });
+    QCOMPARE(result, expected);
+}
+
+void tst_QJsonStreamReader::device()
+{
+    QFETCH(QByteArray, data);
+    const QJsonDocument doc = QJsonDocument::fromJson(data);
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    const QJsonValue value = readValue(reader);
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QCOMPARE(value, doc.isArray() ? QJsonValue(doc.array()) : QJsonValue(doc.object()));
+    QVERIFY(reader.isInvalid());
+}
+
+void tst_QJsonStreamReader::skip()
+{
+    QJsonStreamReader reader(R"([{"a": [1, [2, "]"], {"}": 3}]}, "after", [[]], 4])"_ba);
+    QVERIFY(reader.enterContainer());
+    QVERIFY(reader.isObject());
+    QVERIFY(reader.next());
+    QCOMPARE(reader.containerDepth(), 1);
+    QCOMPARE(reader.stringView(), "after");
+    QVERIFY(reader.next());
+    QVERIFY(reader.isArray());
+    QVERIFY(reader.next());
+    QCOMPARE(reader.toInteger(), 4);
+    QVERIFY(reader.next());
+    QVERIFY(!reader.hasNext());
+    QVERIFY(reader.leaveContainer());
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+
+    // skipping still validates
+    reader.clear();
+    reader.addData(R"([[1, 2 3], "after"])"_ba);
+    QVERIFY(reader.enterContainer());
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, QJsonParseError::MissingValueSeparator);
+    QCOMPARE(reader.lastError().offset, 7);
+}
+
+void tst_QJsonStreamReader::skipIncremental()
+{
+    const QByteArray data = R"([{"skip": [1, {"x": "y"}, "z"]}, "after"])"_ba;
+    for (qsizetype split = 2; split < data.indexOf("after"); ++split) {
+        QJsonStreamReader reader(data.first(split));
+        QVERIFY(reader.enterContainer());
+        if (!reader.isObject()) {
+            QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+            reader.addData(data.sliced(split));
+            QVERIFY(reader.isObject());
+        } else if (!reader.next()) {
+            QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+            reader.addData(data.sliced(split));
+        }
+        QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+        QCOMPARE(reader.containerDepth(), 1);
+        QCOMPARE(reader.toString(), "after");
+    }
+}
+
+void tst_QJsonStreamReader::leaveEarly()
+{
+    QJsonStreamReader reader(R"({"a": [1, 2, 3], "b": {"c": [4]}, "c": 5} "next")"_ba);
+    QVERIFY(reader.enterContainer());
+    QVERIFY(reader.next());
+    QVERIFY(reader.enterContainer());
+    QCOMPARE(reader.toInteger(), 1);
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.stringView(), "b");
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.containerDepth(), 0);
+    QCOMPARE(reader.toString(), "next");
+}
+
+void tst_QJsonStreamReader::sequence()
+{
+    QJsonStreamReader reader("{\"a\": 1}\n[2]\n\"three\"\n"_ba);
+    QCOMPARE(readValue(reader), QJsonObject({ { "a", 1 } }));
+    QCOMPARE(readValue(reader), QJsonArray({ 2 }));
+    QCOMPARE(readValue(reader), u"three"_s);
+    QVERIFY(reader.isInvalid());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+
+    // new values at the top level are picked up after addData(), which
+    // makes the input incremental
+    reader.addData("4");
+    QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+    reader.addData(" ");
+    QVERIFY(reader.isNumber());
+    QCOMPARE(reader.toInteger(), 4);
+}
+
+void tst_QJsonStreamReader::errors_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QJsonParseError::ParseError>("error");
+    QTest::addColumn<int>("offset");
+
+    QTest::newRow("missing-value-separator") << "[1 2]"_ba << QJsonParseError::MissingValueSeparator << 3;
+    QTest::newRow("missing-name-separator") << "{\"a\" 1}"_ba << QJsonParseError::MissingNameSeparator << 5;
+    QTest::newRow("trailing-comma-array") << "[1,]"_ba << QJsonParseError::MissingObject << 3;
+    QTest::newRow("trailing-comma-object") << "{\"a\":1,}"_ba << QJsonParseError::MissingObject << 7;
+    QTest::newRow("unquoted-key") << "{a:1}"_ba << QJsonParseError::UnterminatedObject << 1;
+    QTest::newRow("mismatched-bracket") << "[1}"_ba << QJsonParseError::MissingValueSeparator << 2;
+    QTest::newRow("bad-literal") << "[tru]"_ba << QJsonParseError::IllegalValue << 1;
+    QTest::newRow("bad-literal-2") << "[nil]"_ba << QJsonParseError::IllegalValue << 1;
+    QTest::newRow("bad-value") << "[#]"_ba << QJsonParseError::IllegalValue << 1;
+    QTest::newRow("bad-number") << "[-]"_ba << QJsonParseError::IllegalNumber << 1;
+    QTest::newRow("bad-escape") << R"(["\u12"])"_ba << QJsonParseError::IllegalEscapeSequence << 2;
+    QTest::newRow("bad-utf8") << "[\"a\xff\"]"_ba << QJsonParseError::IllegalUTF8String << 2;
+    QTest::newRow("colon-in-array") << "[:]"_ba << QJsonParseError::IllegalValue << 1;
+}
+
+void tst_QJsonStreamReader::errors()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QJsonParseError::ParseError, error);
+    QFETCH(int, offset);
+
+    QJsonStreamReader reader(data);
+    QVERIFY(reader.isArray() || reader.isObject());
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, error);
+    QCOMPARE(reader.lastError().offset, offset);
+    QVERIFY(reader.isInvalid());
+    QVERIFY(!reader.hasNext());
+
+    // errors are final
+    reader.addData("]]]]");
+    QCOMPARE(reader.lastError().error, error);
+    QVERIFY(reader.isInvalid());
+}
+
+void tst_QJsonStreamReader::prematureEnd()
+{
+    QJsonStreamReader reader("[1, \"ab"_ba);
+    QVERIFY(reader.enterContainer());
+    QCOMPARE(reader.toInteger(), 1);
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+    QCOMPARE(reader.lastError().offset, 7);
+    QVERIFY(!reader.hasNext());
+
+    reader.addData("c\", 12");
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QCOMPARE(reader.toString(), "abc");
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+    reader.addData("3]");
+    QCOMPARE(reader.toInteger(), 123);
+    QVERIFY(reader.next());
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.containerDepth(), 0);
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+
+    // reading from a device
+    QBuffer buffer;
+    buffer.open(QIODevice::ReadWrite);
+    buffer.write("{\"key\": tr");
+    buffer.seek(0);
+    reader.setDevice(&buffer);
+    QVERIFY(reader.enterContainer());
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, QJsonParseError::PrematureEndOfDocument);
+    const qint64 pos = buffer.pos();
+    buffer.write("ue}");
+    buffer.seek(pos);
+    reader.reparse();
+    QVERIFY(reader.isBool());
+    QVERIFY(reader.toBool());
+    QVERIFY(reader.next());
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+}
+
+void tst_QJsonStreamReader::deepNesting()
+{
+    const QByteArray data = QByteArray(2000, '[') + QByteArray(2000, ']');
+    QJsonStreamReader reader(data);
+    QVERIFY(reader.isArray());
+    QVERIFY(!reader.next());
+    QCOMPARE(reader.lastError().error, QJsonParseError::DeepNesting);
+}
+
+void tst_QJsonStreamReader::largeDevice()
+{
+    // larger than a read chunk, to exercise the buffer management
+    QByteArray data = "[";
+    const QByteArray longString(100000, 'x');
+    for (int i = 0; i < 10000; ++i) {
+        data += "{\"index\": " + QByteArray::number(i) + ", \"text\": \"item\"}, ";
+        if (i == 5000)
+            data += '"' + longString + "\", ";
+    }
+    data += "42]";
+
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QVERIFY(reader.enterContainer());
+    qint64 sum = 0;
+    int count = 0;
+    while (reader.hasNext()) {
+        if (reader.isString()) {
+            QCOMPARE(reader.stringView().size(), longString.size());
+            QVERIFY(reader.next());
+            continue;
+        }
+        if (reader.isNumber()) {
+            QCOMPARE(reader.toInteger(), 42);
+            QVERIFY(reader.next());
+            continue;
+        }
+        QVERIFY(reader.enterContainer());
+        QCOMPARE(reader.stringView(), "index");
+        QVERIFY(reader.next());
+        sum += reader.toInteger();
+        QVERIFY(reader.leaveContainer());
+        ++count;
+    }
+    QVERIFY(reader.leaveContainer());
+    QCOMPARE(reader.lastError().error, QJsonParseError::NoError);
+    QCOMPARE(count, 10000);
+    QCOMPARE(sum, qint64(10000) * 9999 / 2);
+}
+
+QTEST_MAIN(tst_QJsonStreamReader)
+
+#include "tst_qjsonstreamreader.moc"
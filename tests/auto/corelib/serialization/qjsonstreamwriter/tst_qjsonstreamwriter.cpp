@@ -0,0 +1,400 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qjsonstreamwriter.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QTest>
+#include <QBuffer>
+
+#include <limits>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStreamWriter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void scalars_data();
+    void scalars();
+    void strings_data();
+    void strings();
+    void containers();
+    void indented();
+    void documents_data();
+    void documents();
+    void topLevelSequence();
+    void buffering();
+    void longStrings_data();
+    void longStrings();
+    void errors();
+    void writeError();
+};
+
+void tst_QJsonStreamWriter::basics()
+{
+    QBuffer buffer;
+    QJsonStreamWriter writer(&buffer);
+    QCOMPARE(writer.device(), &buffer);
+    QCOMPARE(writer.format(), QJsonValue::JsonFormat::Compact);
+    writer.setFormat(QJsonValue::JsonFormat::Indented);
+    QCOMPARE(writer.format(), QJsonValue::JsonFormat::Indented);
+
+    QByteArray data;
+    QJsonStreamWriter arrayWriter(&data);
+    QCOMPARE(arrayWriter.device(), nullptr);
+    arrayWriter.append(1);
+    QCOMPARE(data, "1");
+
+    // switching to a device flushes nothing from the byte array
+    arrayWriter.setDevice(&buffer);
+    QCOMPARE(arrayWriter.device(), &buffer);
+    buffer.open(QIODevice::WriteOnly);
+    arrayWriter.append(2);
+    QVERIFY(arrayWriter.flush());
+    QCOMPARE(data, "1");
+    QCOMPARE(buffer.data(), "\n2");
+}
+
+void tst_QJsonStreamWriter::scalars_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+    QTest::addColumn<QByteArray>("expected");
+
+    QTest::newRow("null") << QJsonValue() << "null"_ba;
+    QTest::newRow("undefined") << QJsonValue(QJsonValue::Undefined) << "null"_ba;
+    QTest::newRow("true") << QJsonValue(true) << "true"_ba;
+    QTest::newRow("false") << QJsonValue(false) << "false"_ba;
+    QTest::newRow("zero") << QJsonValue(0) << "0"_ba;
+    QTest::newRow("integer") << QJsonValue(-1234) << "-1234"_ba;
+    QTest::newRow("int64-min") << QJsonValue(std::numeric_limits<qint64>::min())
+                               << "-9223372036854775808"_ba;
+    QTest::newRow("int64-max") << QJsonValue(std::numeric_limits<qint64>::max())
+                               << "9223372036854775807"_ba;
+    QTest::newRow("double") << QJsonValue(1.5) << "1.5"_ba;
+    QTest::newRow("integral-double") << QJsonValue(2.0) << "2"_ba;
+    QTest::newRow("small-double") << QJsonValue(1e-10) << "1e-10"_ba;
+    QTest::newRow("inf") << QJsonValue(qInf()) << "null"_ba;
+    QTest::newRow("nan") << QJsonValue(qQNaN()) << "null"_ba;
+    QTest::newRow("string") << QJsonValue(u"abc"_s) << "\"abc\""_ba;
+}
+
+void tst_QJsonStreamWriter::scalars()
+{
+    QFETCH(QJsonValue, value);
+    QFETCH(QByteArray, expected);
+
+    QByteArray data;
+    {
+        QJsonStreamWriter writer(&data);
+        writer.append(value);
+    }
+    QCOMPARE(data, expected);
+    if (!value.isUndefined())
+        QCOMPARE(data, value.toJson(QJsonValue::JsonFormat::Compact));
+
+    // the typed overloads produce the same output
+    QByteArray typed;
+    QJsonStreamWriter writer(&typed);
+    switch (value.type()) {
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        writer.appendNull();
+        break;
+    case QJsonValue::Bool:
+        writer.append(value.toBool());
+        break;
+    case QJsonValue::Double:
+        if (const qint64 i = value.toInteger(); double(i) == value.toDouble())
+            writer.append(i);
+        else
+            writer.append(value.toDouble());
+        break;
+    case QJsonValue::String:
+        writer.append(value.toString());
+        break;
+    default:
+        QFAIL("unexpected type");
+    }
+    QCOMPARE(typed, expected);
+}
+
+void tst_QJsonStreamWriter::strings_data()
+{
+    QTest::addColumn<QString>("string");
+
+    QTest::newRow("empty") << QString("");
+    QTest::newRow("ascii") << u"Hello, World"_s;
+    QTest::newRow("escapes") << u"a\"b\\c/d\n\t\b\f\r"_s;
+    QTest::newRow("control") << u"\x01\x1f"_s;
+    QTest::newRow("latin1") << u"Résumé"_s;
+    QTest::newRow("non-latin1") << u"Ελληνικά \U0001F600"_s;
+    QTest::newRow("long") << u"0123456789\"abcdef\\"_s.repeated(100);
+}
+
+void tst_QJsonStreamWriter::strings()
+{
+    QFETCH(QString, string);
+
+    const QByteArray expected = QJsonValue(string).toJson(QJsonValue::JsonFormat::Compact);
+
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.append(QStringView(string));
+    QCOMPARE(data, expected);
+
+    data.clear();
+    const QByteArray utf8 = string.toUtf8();
+    writer.append(QUtf8StringView(utf8));
+    QCOMPARE(data, '\n' + expected);
+
+    if (QtPrivate::isLatin1(QStringView(string))) {
+        data.clear();
+        const QByteArray latin1 = string.toLatin1();
+        writer.append(QLatin1StringView(latin1));
+        QCOMPARE(data, '\n' + expected);
+    }
+}
+
+void tst_QJsonStreamWriter::containers()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.startObject();
+    writer.append("a"_L1);
+    writer.startArray();
+    writer.append(1);
+    writer.append(u"x"_s);
+    writer.appendNull();
+    QVERIFY(writer.endArray());
+    writer.append("b"_L1);
+    writer.startObject();
+    writer.append("c");
+    writer.append(true);
+    QVERIFY(writer.endObject());
+    writer.append("d"_L1);
+    writer.startObject();
+    QVERIFY(writer.endObject());
+    writer.append("e"_L1);
+    writer.startArray();
+    QVERIFY(writer.endArray());
+    QVERIFY(writer.endObject());
+
+    QCOMPARE(data, R"({"a":[1,"x",null],"b":{"c":true},"d":{},"e":[]})");
+}
+
+void tst_QJsonStreamWriter::indented()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.setFormat(QJsonValue::JsonFormat::Indented);
+    writer.startObject();
+    writer.append("a"_L1);
+    writer.startArray();
+    writer.append(1);
+    writer.startArray();
+    writer.endArray();
+    writer.endArray();
+    writer.append("b"_L1);
+    writer.append(2.5);
+    writer.endObject();
+
+    QCOMPARE(data, "{\n"
+                   "    \"a\": [\n"
+                   "        1,\n"
+                   "        [\n"
+                   "        ]\n"
+                   "    ],\n"
+                   "    \"b\": 2.5\n"
+                   "}\n");
+}
+
+void tst_QJsonStreamWriter::documents_data()
+{
+    QTest::addColumn<QJsonDocument>("document");
+
+    QTest::newRow("empty-array") << QJsonDocument(QJsonArray());
+    QTest::newRow("empty-object") << QJsonDocument(QJsonObject());
+    QTest::newRow("array") << QJsonDocument(QJsonArray{ 1, 2.5, u"x"_s, true, QJsonValue() });
+    QTest::newRow("nested") << QJsonDocument::fromJson(R"(
+        {"a": [1, [2, [3, []]], {}], "b": {"c": {"d": "e"}}, "f": "é😀",
+         "g": -1e300, "h": "line\nbreak", "i": [{"j": null}, {"k": false}]})");
+
+    QJsonArray large;
+    for (int i = 0; i < 10000; ++i) {
+        large.append(QJsonObject{ { "index"_L1, i },
+                                  { "name"_L1, u"Item %1"_s.arg(i) },
+                                  { "tags"_L1, QJsonArray{ u"é"_s, 0.5 * i } } });
+    }
+    QTest::newRow("large") << QJsonDocument(large);
+}
+
+void tst_QJsonStreamWriter::documents()
+{
+    QFETCH(QJsonDocument, document);
+
+    for (auto format : { QJsonDocument::Indented, QJsonDocument::Compact }) {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        QVERIFY(document.toJson(&buffer, format));
+        QCOMPARE(buffer.data(), document.toJson(format));
+    }
+
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.append(document.isArray() ? QJsonValue(document.array())
+                                     : QJsonValue(document.object()));
+    QCOMPARE(data, document.toJson(QJsonDocument::Compact));
+}
+
+void tst_QJsonStreamWriter::topLevelSequence()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.append(1);
+    writer.startArray();
+    writer.endArray();
+    writer.append("x"_L1);
+    QCOMPARE(data, "1\n[]\n\"x\"");
+
+    // indented containers already end with a newline
+    data.clear();
+    writer.setFormat(QJsonValue::JsonFormat::Indented);
+    writer.startObject();
+    writer.endObject();
+    writer.startObject();
+    writer.endObject();
+    QCOMPARE(data, "\n{\n}\n{\n}\n");
+}
+
+void tst_QJsonStreamWriter::buffering()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QJsonStreamWriter writer(&buffer);
+    writer.startArray();
+    writer.append(1);
+    QCOMPARE(buffer.size(), 0);
+    QVERIFY(writer.flush());
+    QCOMPARE(buffer.data(), "[1");
+
+    // large output reaches the device before the document is complete, in
+    // chunks of bounded size
+    qint64 previous = buffer.size();
+    qint64 largestChunk = 0;
+    for (int i = 0; i < 100000; ++i) {
+        writer.append(u"some text"_s);
+        largestChunk = qMax(largestChunk, buffer.size() - previous);
+        previous = buffer.size();
+    }
+    QCOMPARE_GT(buffer.size(), 0);
+    QCOMPARE_LT(largestChunk, 64 * 1024);
+
+    writer.endArray();
+    QVERIFY(writer.flush());
+    QCOMPARE(buffer.size(), 3 + 100000 * 12);
+    QVERIFY(buffer.data().endsWith("\"some text\"]"));
+}
+
+void tst_QJsonStreamWriter::longStrings_data()
+{
+    QTest::addColumn<QString>("string");
+
+    // the odd prefixes make the pieces end inside surrogate pairs and UTF-8
+    // sequences
+    QTest::newRow("ascii") << u"0123456789\"abcdef\\"_s.repeated(10000);
+    QTest::newRow("surrogates") << u"a"_s + u"\U0001F600"_s.repeated(60000);
+    QTest::newRow("two-byte") << u"a"_s + u"é"_s.repeated(100000);
+    QTest::newRow("three-byte") << u"ab"_s + u"€"_s.repeated(100000);
+}
+
+void tst_QJsonStreamWriter::longStrings()
+{
+    // records the largest single write the writer makes
+    class Device : public QBuffer
+    {
+    public:
+        qint64 largestWrite = 0;
+
+    protected:
+        qint64 writeData(const char *data, qint64 len) override
+        {
+            largestWrite = qMax(largestWrite, len);
+            return QBuffer::writeData(data, len);
+        }
+    };
+
+    QFETCH(QString, string);
+    const QByteArray expected = QJsonValue(string).toJson(QJsonValue::JsonFormat::Compact);
+
+    Device device;
+    device.open(QIODevice::WriteOnly);
+    QJsonStreamWriter writer(&device);
+    writer.append(QStringView(string));
+    QVERIFY(writer.flush());
+    QCOMPARE(device.data(), expected);
+    QCOMPARE_LT(device.largestWrite, 128 * 1024);
+
+    const QByteArray utf8 = string.toUtf8();
+    device.largestWrite = 0;
+    writer.append(QUtf8StringView(utf8));
+    QVERIFY(writer.flush());
+    QCOMPARE(device.data(), expected + '\n' + expected);
+    QCOMPARE_LT(device.largestWrite, 128 * 1024);
+}
+
+void tst_QJsonStreamWriter::errors()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: closing object or array that wasn't open");
+    QVERIFY(!writer.endArray());
+
+    writer.startArray();
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: endObject() called to close an array");
+    QVERIFY(!writer.endObject());
+
+    writer.startObject();
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: object keys must be strings");
+    writer.append(1);
+    writer.append(2);
+    QVERIFY(!writer.endObject());
+
+    writer.startObject();
+    writer.append("key"_L1);
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: object member without a value");
+    QVERIFY(!writer.endObject());
+
+    // a correct object afterwards is fine
+    writer.startObject();
+    writer.append("key"_L1);
+    writer.append(1);
+    QVERIFY(writer.endObject());
+}
+
+void tst_QJsonStreamWriter::writeError()
+{
+    QBuffer buffer;
+    QJsonStreamWriter writer(&buffer);
+    writer.append(1);
+    QTest::ignoreMessage(QtWarningMsg, "QIODevice::write (QBuffer): device not open");
+    QVERIFY(!writer.flush());
+
+    // the error is sticky until the device is replaced
+    writer.append(2);
+    QVERIFY(!writer.flush());
+
+    buffer.open(QIODevice::WriteOnly);
+    writer.setDevice(&buffer);
+    writer.append(3);
+    QVERIFY(writer.flush());
+    QCOMPARE(buffer.data(), "\n3");
+}
+
+QTEST_MAIN(tst_QJsonStreamWriter)
+
+#include "tst_qjsonstreamwriter.moc"
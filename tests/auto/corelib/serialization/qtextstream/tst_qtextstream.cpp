@@ -56,6 +56,7 @@ private slots:
     void readLineMaxlen();
     void readLinesFromBufferCRCR();
     void readLineInto();
+    void readLineView();
 
     // all
     void readAllFromDevice_data();
@@ -645,6 +646,51 @@ void tst_QTextStream::readLineInto()
     QVERIFY(line.isEmpty());
 }
 
+void tst_QTextStream::readLineView()
+{
+    QByteArray data = "1\n\r\n333\r\n4444";
+    QTextStream ts(&data);
+
+    QCOMPARE(ts.readLineView(), u"1");
+    QStringView line = ts.readLineView();
+    QVERIFY(!line.isNull());
+    QVERIFY(line.isEmpty());
+    QCOMPARE(ts.readLineView(2), u"33");
+    QCOMPARE(ts.readLine(), u"3"); // interleaving with the copying API
+    QCOMPARE(ts.readLineView(), u"4444");
+    QVERIFY(ts.readLineView().isNull());
+    QVERIFY(ts.atEnd());
+
+    QString string = QStringLiteral("a\nb\n\nc");
+    ts.setString(&string, QIODevice::ReadOnly);
+    QStringList lines;
+    while (!(line = ts.readLineView()).isNull())
+        lines << line.toString();
+    QCOMPARE(lines, QStringList({ "a", "b", QString(), "c" }));
+
+    // Views must match readLine() across buffer refills.
+    QFile file(m_rfc3261FilePath);
+    QVERIFY(file.open(QFile::ReadOnly));
+    QFile reference(m_rfc3261FilePath);
+    QVERIFY(reference.open(QFile::ReadOnly));
+    ts.setDevice(&file);
+    QTextStream referenceStream(&reference);
+    int count = 0;
+    while (!referenceStream.atEnd()) {
+        const QString expected = referenceStream.readLine();
+        line = ts.readLineView();
+        QCOMPARE(line, expected);
+        ++count;
+    }
+    QVERIFY(count > 1000);
+    QVERIFY(ts.readLineView().isNull());
+
+    ErrorDevice errorDevice;
+    QVERIFY(errorDevice.open(QIODevice::ReadOnly));
+    ts.setDevice(&errorDevice);
+    QVERIFY(ts.readLineView().isNull());
+}
+
 // ------------------------------------------------------------------------------
 void tst_QTextStream::readLineFromString_data()
 {
@@ -605,6 +605,8 @@ private slots:
     void tokenErrorHandling() const;
     void checkStreamNotationDeclarations() const;
     void checkStreamEntityDeclarations() const;
+    void largeDocument_data() const;
+    void largeDocument() const;
 
 private:
     static QByteArray readFile(const QString &filename);
@@ -2147,4 +2149,81 @@ void tst_QXmlStream::checkStreamEntityDeclarations() const
         QT_TEST_EQUALITY_OPS(entity, entityDeclarations.at(1), true);
     }
 }
+
+static QString describeToken(const QXmlStreamReader &reader)
+{
+    QString token = reader.tokenString() + u' ' + reader.name() + u' ' + reader.text();
+    if (reader.isWhitespace())
+        token += u" (whitespace)"_s;
+    for (const QXmlStreamAttribute &attribute : reader.attributes())
+        token += u" %1=\"%2\""_s.arg(attribute.name(), attribute.value());
+    return token;
+}
+
+static QStringList tokenize(QXmlStreamReader &reader)
+{
+    QStringList tokens;
+    while (!reader.atEnd()) {
+        reader.readNext();
+        tokens << describeToken(reader);
+    }
+    return tokens;
+}
+
+void tst_QXmlStream::largeDocument_data() const
+{
+    QTest::addColumn<QByteArray>("xml");
+    QTest::addColumn<QString>("lastText");
+
+    // larger than the chunks in which in-memory data is decoded, with
+    // multi-byte sequences straddling the chunk boundaries
+    QByteArray utf8 = "<?xml version=\"1.0\"?>\n<root>\n";
+    for (int i = 0; i < 5000; ++i) {
+        utf8 += "  <item id=\"" + QByteArray::number(i) + "\" title='caf\xc3\xa9 \"" + QByteArray::number(i)
+                + "\"'>R\xc3\xa9sum\xc3\xa9 &amp; \xf0\x9f\x98\x80 ]] text, some more text"
+                  " ]]&gt; end</item>\n    \n";
+    }
+    utf8 += "  <last>\xc3\xa9</last>\n</root>\n";
+    QTest::newRow("utf-8") << utf8 << u"é"_s;
+
+    // the declared encoding applies to the chunks after the first one too
+    QByteArray latin1 = "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n<root>\n";
+    for (int i = 0; i < 5000; ++i)
+        latin1 += "  <item a='\xe9'>\xe9t\xe9 " + QByteArray::number(i) + "</item>\n";
+    latin1 += "  <last>\xe9</last>\n</root>\n";
+    QTest::newRow("latin-1") << latin1 << u"é"_s;
+}
+
+void tst_QXmlStream::largeDocument() const
+{
+    QFETCH(QByteArray, xml);
+    QFETCH(QString, lastText);
+
+    QBuffer buffer(&xml);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QXmlStreamReader deviceReader(&buffer);
+    const QStringList expected = tokenize(deviceReader);
+    QVERIFY2(!deviceReader.hasError(), qPrintable(deviceReader.errorString()));
+    QVERIFY(expected.size() > 20000);
+    QVERIFY(expected.contains(u"Characters  " + lastText));
+
+    QXmlStreamReader reader(xml);
+    QCOMPARE(tokenize(reader), expected);
+
+    // feed it in pieces that are not a multiple of the chunk size
+    QXmlStreamReader incremental;
+    QStringList tokens;
+    for (qsizetype pos = 0; pos < xml.size(); pos += 7001) {
+        incremental.addData(xml.sliced(pos, qMin(qsizetype(7001), xml.size() - pos)));
+        while (!incremental.atEnd()) {
+            incremental.readNext();
+            if (incremental.error() == QXmlStreamReader::PrematureEndOfDocumentError)
+                break;
+            tokens << describeToken(incremental);
+        }
+    }
+    QVERIFY2(!incremental.hasError(), qPrintable(incremental.errorString()));
+    QCOMPARE(tokens, expected);
+}
+
 #include "tst_qxmlstream.moc"
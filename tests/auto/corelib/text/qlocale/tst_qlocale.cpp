@@ -92,6 +92,8 @@ private slots:
 
     void doubleRoundTrip_data();
     void doubleRoundTrip();
+    void shortestRoundTrip();
+    void cLocaleNumberOptions();
     void integerRoundTrip_data();
     void integerRoundTrip();
     void negativeNumbers();
@@ -2673,6 +2675,83 @@ void tst_QLocale::doubleRoundTrip()
     QCOMPARE(locale.toString(number, numberFormat), numberText);
 }
 
+void tst_QLocale::shortestRoundTrip()
+{
+    constexpr int Shortest = QLocale::FloatingPointShortest;
+    const QLocale c = QLocale::c();
+
+    // a deterministic sample of bit patterns over the whole range
+    quint64 bits = Q_UINT64_C(0x9e3779b97f4a7c15);
+    for (int i = 0; i < 20000; ++i) {
+        bits = bits * Q_UINT64_C(6364136223846793005) + Q_UINT64_C(1442695040888963407);
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if (!qIsFinite(d))
+            continue;
+        if (i % 2)
+            d = double(float(d));
+
+        for (char format : { 'g', 'e', 'f' }) {
+            const QString text = QString::number(d, format, Shortest);
+            const QByteArray bytes = QByteArray::number(d, format, Shortest);
+            QCOMPARE(bytes, text.toLatin1());
+            QCOMPARE(c.toString(d, format, Shortest), text);
+
+            bool ok = false;
+            QCOMPARE(text.toDouble(&ok), d);
+            QVERIFY(ok);
+            QCOMPARE(bytes.toDouble(&ok), d);
+            QVERIFY(ok);
+            QCOMPARE(c.toDouble(text, &ok), d);
+            QVERIFY(ok);
+        }
+    }
+
+    // No more digits than needed:
+    QCOMPARE(QString::number(0.1, 'g', Shortest), u"0.1");
+    QCOMPARE(QString::number(1e23, 'g', Shortest), u"1e+23");
+    QCOMPARE(QString::number(5e-324, 'g', Shortest), u"5e-324");
+    QCOMPARE(QString::number(std::numeric_limits<double>::max(), 'g', Shortest),
+             u"1.7976931348623157e+308");
+    QCOMPARE(QByteArray::number(-0.0, 'g', Shortest), "0");
+    QCOMPARE(QByteArray::number(123456.0, 'e', Shortest), "1.23456e+05");
+}
+
+void tst_QLocale::cLocaleNumberOptions()
+{
+    // The C locale's number options still apply, on top of any shortcut taken
+    // for its default options:
+    QLocale c = QLocale::c();
+    QCOMPARE(c.toString(1.5e5, 'e', 2), u"1.50e+05");
+    bool ok = false;
+    QCOMPARE(c.toDouble(u"1e05", &ok), 1e5);
+    QVERIFY(ok);
+    QCOMPARE(c.toDouble(u"1,234.5", &ok), 1234.5);
+    QVERIFY(ok);
+    QCOMPARE(c.toDouble(u"1.5x", &ok), 0.0);
+    QVERIFY(!ok);
+    QCOMPARE(c.toDouble(u"1e400", &ok), qInf()); // overflow
+    QVERIFY(!ok);
+
+    c.setNumberOptions(QLocale::OmitLeadingZeroInExponent | QLocale::RejectLeadingZeroInExponent
+                       | QLocale::IncludeTrailingZeroesAfterDot
+                       | QLocale::RejectTrailingZeroesAfterDot);
+    QCOMPARE(c.toString(1.5e5, 'e', 2), u"1.50e+5");
+    QCOMPARE(c.toString(1.5, 'g', 4), u"1.500");
+    QCOMPARE(c.toDouble(u"1e05", &ok), 0.0);
+    QVERIFY(!ok);
+    QCOMPARE(c.toDouble(u"1.50", &ok), 0.0);
+    QVERIFY(!ok);
+    QCOMPARE(c.toDouble(u"1.5e5", &ok), 1.5e5);
+    QVERIFY(ok);
+
+    c.setNumberOptions(QLocale::DefaultNumberOptions);
+    QCOMPARE(c.toString(12345.5, 'f', 1), u"12,345.5");
+    c.setNumberOptions(QLocale::RejectGroupSeparator);
+    QCOMPARE(c.toDouble(u"1,234.5", &ok), 0.0);
+    QVERIFY(!ok);
+}
+
 void tst_QLocale::integerRoundTrip_data()
 {
     QTest::addColumn<QString>("localeName");
@@ -75,6 +75,11 @@ private slots:
     void wildcard();
     void testInvalidWildcard_data();
     void testInvalidWildcard();
+    void sharedCompiledPatterns();
+    void regularExpressionSet_data();
+    void regularExpressionSet();
+    void regularExpressionSetValidity();
+    void regularExpressionSetManyPatterns();
 
 private:
     void provideRegularExpressions();
@@ -2582,6 +2587,187 @@ void tst_QRegularExpression::testInvalidWildcard()
     QCOMPARE(re.isValid(), isValid);
 }
 
+void tst_QRegularExpression::sharedCompiledPatterns()
+{
+    // the compiled form is shared, but each object still reports its own
+    // pattern information
+    for (int i = 0; i < 2; ++i) {
+        QRegularExpression re1("(?<year>\\d{4})-(\\d\\d)");
+        QRegularExpression re2("(?<year>\\d{4})-(\\d\\d)");
+        re1.optimize();
+        QVERIFY(re2.isValid());
+        QCOMPARE(re2.captureCount(), 2);
+        QCOMPARE(re2.namedCaptureGroups(), QStringList({ QString(), "year", QString() }));
+        QCOMPARE(re1.match("on 2024-05").captured("year"), "2024");
+        QCOMPARE(re2.match("on 1999-12").captured(2), "12");
+
+        // different options make a different pattern
+        QRegularExpression caseInsensitive("(?<year>\\d{4})-(\\d\\d)x",
+                                           QRegularExpression::CaseInsensitiveOption);
+        QRegularExpression caseSensitive("(?<year>\\d{4})-(\\d\\d)x");
+        QVERIFY(caseInsensitive.match("2024-05X").hasMatch());
+        QVERIFY(!caseSensitive.match("2024-05X").hasMatch());
+
+        QRegularExpression invalid1("a(b");
+        QRegularExpression invalid2("a(b");
+        QVERIFY(!invalid1.isValid());
+        QVERIFY(!invalid2.isValid());
+        QCOMPARE(invalid2.patternErrorOffset(), invalid1.patternErrorOffset());
+        QCOMPARE(invalid2.errorString(), invalid1.errorString());
+    }
+
+    // changing the pattern of a copy does not affect the original
+    QRegularExpression re("a+");
+    QRegularExpression copy = re;
+    QVERIFY(copy.match("aaa").hasMatch());
+    copy.setPattern("b+");
+    QVERIFY(!copy.match("aaa").hasMatch());
+    QVERIFY(re.match("aaa").hasMatch());
+
+    // many distinct patterns, more than the cache holds, all stay usable
+    QList<QRegularExpression> expressions;
+    for (int i = 0; i < 1000; ++i)
+        expressions.append(QRegularExpression(QString("^x%1y$").arg(i)));
+    for (int i = 0; i < 1000; ++i)
+        QVERIFY(expressions.at(i).match(QString("x%1y").arg(i)).hasMatch());
+}
+
+void tst_QRegularExpression::regularExpressionSet_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<QRegularExpression::PatternOptions>("options");
+    QTest::addColumn<QString>("subject");
+    QTest::addColumn<QList<qsizetype>>("expected");
+
+    const QStringList log = { "^ERROR\\b", "timeout", "\\bdisk\\b", "^WARN", "\\d{3,}$" };
+    QTest::newRow("log-several") << log << QRegularExpression::PatternOptions{}
+                                 << "ERROR: disk read timeout" << QList<qsizetype>{ 0, 1, 2 };
+    QTest::newRow("log-none") << log << QRegularExpression::PatternOptions{}
+                              << "INFO: diskette inserted" << QList<qsizetype>{};
+    QTest::newRow("log-anchors") << log << QRegularExpression::PatternOptions{}
+                                 << "WARN: ERROR 1234" << QList<qsizetype>{ 3, 4 };
+    QTest::newRow("empty-subject") << QStringList{ "a*", "a", "^$" }
+                                   << QRegularExpression::PatternOptions{}
+                                   << QString() << QList<qsizetype>{ 0, 2 };
+    QTest::newRow("case-insensitive") << QStringList{ "abc", "ABD", "(?-i)ABC" }
+                                      << QRegularExpression::PatternOptions(QRegularExpression::CaseInsensitiveOption)
+                                      << "xAbCx" << QList<qsizetype>{ 0 };
+    QTest::newRow("multiline") << QStringList{ "^b$", "^a" }
+                               << QRegularExpression::PatternOptions(QRegularExpression::MultilineOption)
+                               << "a\nb\nc" << QList<qsizetype>{ 0, 1 };
+    QTest::newRow("extended-comment") << QStringList{ "a b  # letters", "c d" }
+                                      << QRegularExpression::PatternOptions(QRegularExpression::ExtendedPatternSyntaxOption)
+                                      << "xcdx" << QList<qsizetype>{ 1 };
+    QTest::newRow("inline-extended") << QStringList{ "(?x) a b # comment", "z" }
+                                     << QRegularExpression::PatternOptions{}
+                                     << "abz" << QList<qsizetype>{ 0, 1 };
+    QTest::newRow("unterminated-quote") << QStringList{ "\\Qa|b", "c" }
+                                        << QRegularExpression::PatternOptions{}
+                                        << "a|bc" << QList<qsizetype>{ 0, 1 };
+    QTest::newRow("captures") << QStringList{ "(a)(b)", "(?:c)(d)" }
+                              << QRegularExpression::PatternOptions{}
+                              << "abcd" << QList<qsizetype>{ 0, 1 };
+    QTest::newRow("backreference") << QStringList{ "(a)\\1", "(b)\\g{-1}", "(?<x>c)\\k<x>", "dd" }
+                                   << QRegularExpression::PatternOptions{}
+                                   << "aa bb cc d" << QList<qsizetype>{ 0, 1, 2 };
+    QTest::newRow("recursion") << QStringList{ "\\((?:[^()]|(?R))*\\)", "(x)(?1)", "y" }
+                               << QRegularExpression::PatternOptions{}
+                               << "(a(b))xx" << QList<qsizetype>{ 0, 1 };
+    QTest::newRow("verbs") << QStringList{ "a(*COMMIT)b", "(*UCP)\\w", "a(*SKIP)(*FAIL)|c" }
+                           << QRegularExpression::PatternOptions{}
+                           << "acb" << QList<qsizetype>{ 1, 2 };
+    QTest::newRow("lookaround") << QStringList{ "(?<=a)b", "c(?!d)", "(?<!x)y" }
+                                << QRegularExpression::PatternOptions{}
+                                << "ab cd xy" << QList<qsizetype>{ 0 };
+    QTest::newRow("non-latin1") << QStringList{ "\\x{1F600}", "é+", "." }
+                                << QRegularExpression::PatternOptions{}
+                                << QString::fromUtf16(u"ééé \U0001F600") << QList<qsizetype>{ 0, 1, 2 };
+
+    QString invalidSubject = "abcdef";
+    invalidSubject[3] = QChar(0x00, 0xD8);
+    QTest::newRow("invalid-subject") << QStringList{ "a", "b" }
+                                     << QRegularExpression::PatternOptions{}
+                                     << invalidSubject << QList<qsizetype>{};
+}
+
+void tst_QRegularExpression::regularExpressionSet()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(QRegularExpression::PatternOptions, options);
+    QFETCH(QString, subject);
+    QFETCH(QList<qsizetype>, expected);
+
+    const QRegularExpressionSet set(patterns, options);
+    QVERIFY(set.isValid());
+    QCOMPARE(set.invalidPatternIndex(), -1);
+    QCOMPARE(set.patterns(), patterns);
+    QCOMPARE(set.patternOptions(), options);
+    QCOMPARE(set.size(), patterns.size());
+    QCOMPARE(set.matchingPatterns(subject), expected);
+    QCOMPARE(set.matchesAny(subject), !expected.isEmpty());
+
+    // same result as matching each pattern on its own
+    QList<qsizetype> oneByOne;
+    for (qsizetype i = 0; i < patterns.size(); ++i) {
+        if (QRegularExpression(patterns.at(i), options).match(subject).hasMatch())
+            oneByOne.append(i);
+    }
+    QCOMPARE(oneByOne, expected);
+
+    const QRegularExpressionSet copy = set;
+    QCOMPARE(copy.matchingPatterns(subject), expected);
+}
+
+void tst_QRegularExpression::regularExpressionSetValidity()
+{
+    QRegularExpressionSet empty;
+    QVERIFY(empty.isValid());
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(empty.matchingPatterns(u"abc"), QList<qsizetype>());
+    QVERIFY(!empty.matchesAny(u"abc"));
+    QCOMPARE(empty.errorString(), QRegularExpression().errorString());
+
+    const QStringList patterns = { "a", "(b", "c[" };
+    QRegularExpressionSet set(patterns);
+    QVERIFY(!set.isValid());
+    QCOMPARE(set.invalidPatternIndex(), 1);
+    QCOMPARE(set.errorString(), QRegularExpression("(b").errorString());
+
+    static const QRegularExpression ignoreMessagePattern(
+        "^" + QRegularExpression::escape("QRegularExpressionSet::matchingPatterns(): "
+                                         "called on an invalid QRegularExpression object")
+    );
+    QTest::ignoreMessage(QtWarningMsg, ignoreMessagePattern);
+    QCOMPARE(set.matchingPatterns(u"abc"), QList<qsizetype>());
+}
+
+void tst_QRegularExpression::regularExpressionSetManyPatterns()
+{
+    // enough patterns to need several combined patterns, including some that
+    // must be matched separately
+    QStringList patterns;
+    for (int i = 0; i < 600; ++i) {
+        if (i % 100 == 7)
+            patterns.append(QString("(w%1)\\1").arg(i));
+        else
+            patterns.append(QString("\\bw%1\\b").arg(i));
+    }
+    const QRegularExpressionSet set(patterns);
+    QVERIFY(set.isValid());
+
+    QCOMPARE(set.matchingPatterns(u"w1 w599 w300 w507w507 w8"),
+             QList<qsizetype>({ 1, 8, 300, 507, 599 }));
+    QCOMPARE(set.matchingPatterns(u"w600 w-1"), QList<qsizetype>());
+    QVERIFY(set.matchesAny(u"zz w42 zz"));
+    QVERIFY(!set.matchesAny(u"zz w4200 zz"));
+
+    // a long subject with everything matching
+    QString subject;
+    for (int i = patterns.size() - 1; i >= 0; --i)
+        subject += QString(i % 100 == 7 ? "w%1w%1 " : "w%1 ").arg(i);
+    QCOMPARE(set.matchingPatterns(subject).size(), patterns.size());
+}
+
 QTEST_APPLESS_MAIN(tst_QRegularExpression)
 
 #include "tst_qregularexpression.moc"
@@ -151,6 +151,13 @@ private slots:
 
     void convertL1U16();
 
+    void utfSurrogates_data();
+    void utfSurrogates();
+    void utfBlockBoundaries_data();
+    void utfBlockBoundaries();
+    void utf32OutOfRange();
+    void appendToBuffer();
+
 #if QT_CONFIG(icu)
     void roundtripIcu_data();
     void roundtripIcu();
@@ -411,6 +418,215 @@ void tst_QStringConverter::convertL1U16()
     QCOMPARE(reencoded, uniString.toLatin1());
 }
 
+static const std::array utfEncodings = {
+    QStringConverter::Utf16LE, QStringConverter::Utf16BE,
+    QStringConverter::Utf32LE, QStringConverter::Utf32BE,
+};
+
+// Encodes the code units of \a in without validating them: surrogate pairs
+// become one UTF-32 code point, unpaired surrogates are written as they are.
+static QByteArray encodeUnchecked(QStringView in, QStringConverter::Encoding encoding)
+{
+    const bool bigEndian = encoding == QStringConverter::Utf16BE
+            || encoding == QStringConverter::Utf32BE;
+    QByteArray result;
+    auto append = [&](char32_t value, int size) {
+        for (int i = 0; i < size; ++i) {
+            const int shift = 8 * (bigEndian ? size - 1 - i : i);
+            result.append(char(value >> shift));
+        }
+    };
+    for (qsizetype i = 0; i < in.size(); ++i) {
+        const char16_t c = in[i].unicode();
+        if (encoding == QStringConverter::Utf16LE || encoding == QStringConverter::Utf16BE) {
+            append(c, 2);
+        } else if (QChar::isHighSurrogate(c) && i + 1 < in.size() && in[i + 1].isLowSurrogate()) {
+            append(QChar::surrogateToUcs4(c, in[i + 1].unicode()), 4);
+            ++i;
+        } else {
+            append(c, 4);
+        }
+    }
+    return result;
+}
+
+void tst_QStringConverter::utfSurrogates_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<QString>("expected");
+
+    const QChar high = QChar::highSurrogate(0x1f600);
+    const QChar low = QChar::lowSurrogate(0x1f600);
+    const QChar replacement = QChar::ReplacementCharacter;
+
+    QTest::newRow("pair") << u"a"_s + high + low + u"b"_s << u"a\U0001F600b"_s;
+    QTest::newRow("lone-high") << u"a"_s + high + u"b"_s << u"a"_s + replacement + u"b"_s;
+    QTest::newRow("lone-low") << u"a"_s + low + u"b"_s << u"a"_s + replacement + u"b"_s;
+    QTest::newRow("reversed-pair") << QString(low) + high + u"b"_s
+                                   << QString(replacement) + replacement + u"b"_s;
+    QTest::newRow("two-highs") << QString(high) + high + low
+                               << QString(replacement) + high + low;
+    QTest::newRow("high-at-end") << u"ab"_s + high << u"ab"_s + replacement;
+    QTest::newRow("low-at-start") << QString(low) + u"ab"_s << QString(replacement) + u"ab"_s;
+}
+
+void tst_QStringConverter::utfSurrogates()
+{
+    QFETCH(QString, input);
+    QFETCH(QString, expected);
+    const bool invalid = input != expected;
+
+    for (QStringConverter::Encoding encoding : utfEncodings) {
+        const QByteArray raw = encodeUnchecked(input, encoding);
+        const QByteArray valid = encodeUnchecked(expected, encoding);
+
+        QStringEncoder encoder(encoding, QStringConverter::Flag::Stateless);
+        QCOMPARE(encoder.encode(input), valid);
+        QCOMPARE(encoder.hasError(), invalid);
+
+        QStringDecoder decoder(encoding, QStringConverter::Flag::Stateless);
+        QCOMPARE(decoder.decode(raw), expected);
+        QCOMPARE(decoder.hasError(), invalid);
+
+        // surrogate pairs split between calls are still recognized
+        QStringEncoder statefulEncoder(encoding);
+        QByteArray encodedPiecewise;
+        for (QChar c : std::as_const(input))
+            encodedPiecewise += statefulEncoder.encode(QStringView(&c, 1));
+        QStringEncoder wholeEncoder(encoding);
+        QCOMPARE(encodedPiecewise, wholeEncoder.encode(input));
+        QCOMPARE(statefulEncoder.hasError(), wholeEncoder.hasError());
+        QStringDecoder statefulDecoder(encoding);
+        QString decodedPiecewise;
+        for (char c : raw)
+            decodedPiecewise += statefulDecoder.decode(QByteArrayView(&c, 1));
+        QStringDecoder wholeDecoder(encoding);
+        QCOMPARE(decodedPiecewise, wholeDecoder.decode(raw));
+        QCOMPARE(statefulDecoder.hasError(), wholeDecoder.hasError());
+    }
+}
+
+void tst_QStringConverter::utfBlockBoundaries_data()
+{
+    QTest::addColumn<QString>("special");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("pair") << u"\U0001F600"_s << u"\U0001F600"_s;
+    QTest::newRow("lone-high") << QString(QChar::highSurrogate(0x10000))
+                               << QString(QChar::ReplacementCharacter);
+    QTest::newRow("lone-low") << QString(QChar::lowSurrogate(0x10ffff))
+                              << QString(QChar::ReplacementCharacter);
+    QTest::newRow("two-pairs") << u"\U0001F600\U00010000"_s << u"\U0001F600\U00010000"_s;
+    QTest::newRow("high-pair") << QChar::highSurrogate(0x10000) + u"\U0001F600"_s
+                               << QChar(QChar::ReplacementCharacter) + u"\U0001F600"_s;
+    QTest::newRow("pair-low") << u"\U0001F600"_s + QChar::lowSurrogate(0x10000)
+                              << u"\U0001F600"_s + QChar(QChar::ReplacementCharacter);
+}
+
+void tst_QStringConverter::utfBlockBoundaries()
+{
+    QFETCH(QString, special);
+    QFETCH(QString, expected);
+
+    // the SIMD code paths handle blocks of 8 or 16 code units; make sure that
+    // the scalar code takes over correctly wherever the special sequence is
+    for (qsizetype length = 0; length <= 40; ++length) {
+        QString filler(length, Qt::Uninitialized);
+        for (qsizetype i = 0; i < length; ++i)
+            filler[i] = QChar(char16_t(0x41 + i * 0x301 % 0xd700));
+
+        for (qsizetype pos = 0; pos <= length; ++pos) {
+            const QString input = filler.first(pos) + special + filler.sliced(pos);
+            const QString output = filler.first(pos) + expected + filler.sliced(pos);
+            for (QStringConverter::Encoding encoding : utfEncodings) {
+                QStringEncoder encoder(encoding, QStringConverter::Flag::Stateless);
+                QCOMPARE(encoder.encode(input), encodeUnchecked(output, encoding));
+                QCOMPARE(encoder.hasError(), input != output);
+
+                QStringDecoder decoder(encoding, QStringConverter::Flag::Stateless);
+                QCOMPARE(decoder.decode(encodeUnchecked(input, encoding)), output);
+                QCOMPARE(decoder.hasError(), input != output);
+            }
+        }
+    }
+}
+
+void tst_QStringConverter::utf32OutOfRange()
+{
+    const QString text = u"0123456789abcdef"_s;
+    for (char32_t value : { char32_t(0x110000), char32_t(0xffffffff), char32_t(0xdfff) }) {
+        for (qsizetype pos = 0; pos <= text.size(); ++pos) {
+            for (QStringConverter::Encoding encoding : { QStringConverter::Utf32LE,
+                                                         QStringConverter::Utf32BE }) {
+                QByteArray encoded = encodeUnchecked(text, encoding);
+                const bool bigEndian = encoding == QStringConverter::Utf32BE;
+                const char bytes[4] = {
+                    char(value >> (bigEndian ? 24 : 0)), char(value >> (bigEndian ? 16 : 8)),
+                    char(value >> (bigEndian ? 8 : 16)), char(value >> (bigEndian ? 0 : 24)),
+                };
+                encoded.insert(4 * pos, bytes, 4);
+
+                QStringDecoder decoder(encoding);
+                QString expected = text;
+                expected.insert(pos, QChar::ReplacementCharacter);
+                QCOMPARE(decoder.decode(encoded), expected);
+                QVERIFY(decoder.hasError());
+
+                QStringDecoder nullDecoder(encoding, QStringConverter::Flag::ConvertInvalidToNull);
+                expected[pos] = QChar::Null;
+                QCOMPARE(nullDecoder.decode(encoded), expected);
+                QVERIFY(nullDecoder.hasError());
+            }
+        }
+    }
+}
+
+void tst_QStringConverter::appendToBuffer()
+{
+    const QString text = u"Grüße, 世界 \U0001F600!"_s.repeated(20);
+
+    for (QStringConverter::Encoding encoding : { QStringConverter::Utf8, QStringConverter::Utf16BE,
+                                                 QStringConverter::Utf32LE }) {
+        const QByteArray encoded = QStringEncoder(encoding).encode(text);
+
+        QStringEncoder encoder(encoding);
+        QByteArray bytes = "prefix";
+        for (qsizetype i = 0; i < text.size(); i += 7)
+            QCOMPARE(&encoder.appendToBuffer(bytes, QStringView(text).sliced(i).first(qMin<qsizetype>(7, text.size() - i))), &bytes);
+        QCOMPARE(bytes, "prefix" + encoded);
+        QVERIFY(!encoder.hasError());
+
+        // decode in chunks that split characters
+        QStringDecoder decoder(encoding);
+        QString string = u"prefix"_s;
+        for (qsizetype i = 0; i < encoded.size(); i += 5)
+            QCOMPARE(&decoder.appendToBuffer(string, encoded.sliced(i).first(qMin<qsizetype>(5, encoded.size() - i))), &string);
+        QCOMPARE(string, u"prefix"_s + text);
+        QVERIFY(!decoder.hasError());
+
+        // no reallocation if the capacity suffices
+        QString reserved;
+        reserved.reserve(decoder.requiredSpace(encoded.size()));
+        const QChar *data = reserved.constData();
+        decoder.resetState();
+        decoder.appendToBuffer(reserved, encoded);
+        QCOMPARE(reserved, text);
+        QCOMPARE(reserved.constData(), data);
+    }
+
+    QStringDecoder invalidDecoder;
+    QString string = u"unchanged"_s;
+    invalidDecoder.appendToBuffer(string, "abc");
+    QCOMPARE(string, u"unchanged");
+    QVERIFY(invalidDecoder.hasError());
+
+    QStringEncoder invalidEncoder;
+    QByteArray bytes = "unchanged";
+    invalidEncoder.appendToBuffer(bytes, u"abc");
+    QCOMPARE(bytes, "unchanged");
+    QVERIFY(invalidEncoder.hasError());
+}
+
 void tst_QStringConverter::roundtrip_data()
 {
     QTest::addColumn<QStringView>("utf16");
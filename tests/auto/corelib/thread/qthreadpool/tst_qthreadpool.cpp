@@ -89,6 +89,9 @@ private slots:
     void waitForDoneAfterTake();
     void threadReuse();
     void nullFunctions();
+    void workStealing();
+    void workStealingTryTakeAndClear();
+    void workStealingTryStart();
 
 private:
     QMutex m_functionTestMutex;
@@ -1516,5 +1519,148 @@ void tst_QThreadPool::nullFunctions()
     }
 }
 
+// starts runnables from within runnables, as divide-and-conquer algorithms do
+static void spawnRecursively(QThreadPool *pool, QAtomicInt *count, int depth)
+{
+    count->ref();
+    if (depth == 0)
+        return;
+    for (int i = 0; i < 4; ++i)
+        pool->start([=] { spawnRecursively(pool, count, depth - 1); });
+}
+
+void tst_QThreadPool::workStealing()
+{
+    TestThreadPool manager;
+    QVERIFY(!manager.isWorkStealingEnabled());
+    manager.setWorkStealingEnabled(true);
+    QVERIFY(manager.isWorkStealingEnabled());
+    manager.setMaxThreadCount(4);
+
+    QAtomicInt count;
+    manager.start([&] { spawnRecursively(&manager, &count, 5); });
+    WAIT_FOR_DONE(manager);
+    // 1 + 4 + ... + 4^5
+    QCOMPARE(count.loadRelaxed(), 1365);
+
+    // runnables that are queued with a higher priority still go first
+    QSemaphore queued;
+    QSemaphore proceed;
+    QList<int> order;
+    QMutex orderMutex;
+    const auto record = [&](int value) {
+        QMutexLocker locker(&orderMutex);
+        order.append(value);
+    };
+    manager.setMaxThreadCount(1);
+    manager.start([&] {
+        manager.start([&] { record(0); });
+        queued.release();
+        proceed.acquire();
+    });
+    QVERIFY(queued.tryAcquire(1, 10s));
+    manager.start([&] { record(1); }, 1);
+    proceed.release();
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(order, QList<int>({ 1, 0 }));
+}
+
+void tst_QThreadPool::workStealingTryTakeAndClear()
+{
+    TestThreadPool manager;
+    manager.setWorkStealingEnabled(true);
+    manager.setMaxThreadCount(1);
+
+    QSemaphore started;
+    QSemaphore proceed;
+    const QSemaphoreReleaser releaser(proceed, 2);
+    QAtomicInt runCount;
+    QAtomicInt dtorCount;
+
+    class CountingRunnable : public QRunnable
+    {
+    public:
+        CountingRunnable(QAtomicInt &runs, QAtomicInt &dtors) : runs(runs), dtors(dtors) {}
+        ~CountingRunnable() override { dtors.ref(); }
+        void run() override { runs.ref(); }
+
+        QAtomicInt &runs;
+        QAtomicInt &dtors;
+    };
+
+    // with a single thread, nobody steals what the blocked runnable starts
+    auto *taken = new CountingRunnable(runCount, dtorCount);
+    taken->setAutoDelete(false);
+    manager.start([&] {
+        manager.start(taken);
+        manager.start(new CountingRunnable(runCount, dtorCount));
+        started.release();
+        proceed.acquire();
+    });
+    QVERIFY(started.tryAcquire(1, 10s));
+
+    QVERIFY(manager.tryTake(taken));
+    QVERIFY(!manager.tryTake(taken));
+    manager.clear();
+    QCOMPARE(dtorCount.loadRelaxed(), 1);
+
+    proceed.release();
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(runCount.loadRelaxed(), 0);
+    delete taken;
+    QCOMPARE(dtorCount.loadRelaxed(), 2);
+}
+
+static void trySpawnRecursively(QThreadPool *pool, QAtomicInt *count, int depth)
+{
+    count->ref();
+    if (depth == 0)
+        return;
+    for (int i = 0; i < 4; ++i) {
+        // like QtConcurrent, run the work here if no other thread is free
+        const auto work = [=] { trySpawnRecursively(pool, count, depth - 1); };
+        if (!pool->tryStart(work))
+            work();
+    }
+}
+
+void tst_QThreadPool::workStealingTryStart()
+{
+    TestThreadPool manager;
+    manager.setWorkStealingEnabled(true);
+    manager.setMaxThreadCount(2);
+
+    QAtomicInt count;
+    manager.start([&] { trySpawnRecursively(&manager, &count, 5); });
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(count.loadRelaxed(), 1365);
+
+    // tryStart() from a pool thread still fails if no other thread is free
+    QSemaphore blocked;
+    QSemaphore proceed;
+    const QSemaphoreReleaser releaser(proceed, 2);
+    bool busyResult = true;
+    bool freeResult = false;
+    QSemaphore ran;
+    manager.start([&] {
+        manager.start([&] {
+            blocked.release();
+            proceed.acquire();
+        });
+        QVERIFY(blocked.tryAcquire(1, 10s));
+        busyResult = manager.tryStart([] {});
+        proceed.release();
+        // wait until the other thread is idle again
+        const QDeadlineTimer deadline(10s);
+        while (manager.activeThreadCount() > 1 && !deadline.hasExpired())
+            QThread::sleep(1ms);
+        freeResult = manager.tryStart([&] { ran.release(); });
+    });
+    WAIT_FOR_DONE(manager);
+    QVERIFY(!busyResult);
+    QVERIFY(freeResult);
+    QCOMPARE(ran.available(), 1);
+}
+
 QTEST_MAIN(tst_QThreadPool);
 #include "tst_qthreadpool.moc"
@@ -9,6 +9,7 @@
 #include "qbitarray.h"
 
 #include <QtCore/qelapsedtimer.h>
+#include <QtCore/qrandom.h>
 #include <QtCore/qscopeguard.h>
 
 /**
@@ -36,6 +37,16 @@ static QBitArray detached(QBitArray a)
     return a;
 }
 
+static QBitArray randomBitArray(QRandomGenerator &rng, qsizetype size, int percentSet = 50)
+{
+    QBitArray ba(size);
+    for (qsizetype i = 0; i < size; ++i) {
+        if (int(rng.bounded(100)) < percentSet)
+            ba.setBit(i);
+    }
+    return ba;
+}
+
 class tst_QBitArray : public QObject
 {
     Q_OBJECT
@@ -47,6 +58,7 @@ private slots:
     void countBits_data();
     void countBits();
     void countBits2();
+    void countBitsLarge();
     void isEmpty();
     void swap();
     void fill();
@@ -73,6 +85,7 @@ private slots:
     // operator ~
     void operator_neg_data();
     void operator_neg();
+    void bitwiseOperatorsLarge();
     void datastream_data();
     void datastream();
     void invertOnNull() const;
@@ -85,6 +98,11 @@ private slots:
 
     void toUInt32_data();
     void toUInt32();
+
+    void indexOf();
+    void lastIndexOf();
+    void rankSelect_data();
+    void rankSelect();
 };
 
 void tst_QBitArray::compareCompiles()
@@ -237,6 +255,23 @@ void tst_QBitArray::countBits2()
     }
 }
 
+void tst_QBitArray::countBitsLarge()
+{
+    // long enough for the SIMD code paths, with every possible tail length
+    QRandomGenerator rng(42);
+    for (qsizetype size : { 255, 256, 2047, 2048, 2049, 8191, 8192 * 31 + 13 }) {
+        for (qsizetype tail = 0; tail < 9; ++tail) {
+            const QBitArray ba = randomBitArray(rng, size + tail);
+            qsizetype expected = 0;
+            for (qsizetype i = 0; i < ba.size(); ++i)
+                expected += ba.testBit(i);
+            QCOMPARE(ba.count(true), expected);
+            QCOMPARE(ba.count(false), ba.size() - expected);
+        }
+    }
+    QCOMPARE(QBitArray(1 << 20, true).count(true), 1 << 20);
+}
+
 void tst_QBitArray::isEmpty()
 {
     QBitArray a1;
@@ -753,6 +788,43 @@ void tst_QBitArray::operator_neg()
     QT_TEST_EQUALITY_OPS(~~input, res, true);     // performs two in-place negations
 }
 
+void tst_QBitArray::bitwiseOperatorsLarge()
+{
+    QRandomGenerator rng(1234);
+    for (qsizetype size1 : { 0, 100, 777, 4096, 5000 }) {
+        for (qsizetype size2 : { 0, 100, 777, 4096, 5000 }) {
+            const QBitArray a = randomBitArray(rng, size1);
+            const QBitArray b = randomBitArray(rng, size2);
+            const qsizetype size = qMax(size1, size2);
+            QBitArray expectedAnd(size), expectedOr(size), expectedXor(size);
+            for (qsizetype i = 0; i < size; ++i) {
+                const bool x = i < size1 && a.testBit(i);
+                const bool y = i < size2 && b.testBit(i);
+                expectedAnd.setBit(i, x && y);
+                expectedOr.setBit(i, x || y);
+                expectedXor.setBit(i, x != y);
+            }
+
+            QCOMPARE(a & b, expectedAnd);
+            QCOMPARE(a | b, expectedOr);
+            QCOMPARE(a ^ b, expectedXor);
+            QCOMPARE(detached(a) &= b, expectedAnd);
+            QCOMPARE(detached(a) |= b, expectedOr);
+            QCOMPARE(detached(a) ^= b, expectedXor);
+            QCOMPARE(detached(a) &= detached(b), expectedAnd);
+            QCOMPARE(detached(a) |= detached(b), expectedOr);
+            QCOMPARE(detached(a) ^= detached(b), expectedXor);
+
+            QBitArray inverted = ~a;
+            QCOMPARE(inverted.size(), size1);
+            QCOMPARE(inverted.count(true), a.count(false));
+            QCOMPARE(~detached(a), inverted);
+            for (qsizetype i = 0; i < size1; ++i)
+                QCOMPARE(inverted.testBit(i), !a.testBit(i));
+        }
+    }
+}
+
 void tst_QBitArray::datastream_data()
 {
     QTest::addColumn<QString>("bitField");
@@ -1032,5 +1104,105 @@ void tst_QBitArray::toUInt32()
     QCOMPARE(ok, check);
 }
 
+void tst_QBitArray::indexOf()
+{
+    QCOMPARE(QBitArray().indexOf(true), -1);
+    QCOMPARE(QBitArray().indexOf(false), -1);
+    QCOMPARE(QBitArray(100).indexOf(true), -1);
+    QCOMPARE(QBitArray(100, true).indexOf(false), -1);
+    QCOMPARE(QBitArray(100).indexOf(false, 99), 99);
+    QCOMPARE(QBitArray(100).indexOf(false, 100), -1);
+    QCOMPARE(QBitArray(100).indexOf(false, -1), 99);
+    QCOMPARE(QBitArray(100).indexOf(false, -1000), 0);
+
+    QRandomGenerator rng(7);
+    for (qsizetype size : { 1, 63, 64, 65, 200, 1000 }) {
+        for (int percentSet : { 1, 50, 99 }) {
+            const QBitArray ba = randomBitArray(rng, size, percentSet);
+            for (bool on : { true, false }) {
+                for (qsizetype from = 0; from <= size; ++from) {
+                    qsizetype expected = from;
+                    while (expected < size && ba.testBit(expected) != on)
+                        ++expected;
+                    if (expected == size)
+                        expected = -1;
+                    QCOMPARE(ba.indexOf(on, from), expected);
+                }
+            }
+        }
+    }
+
+    // iterating over the set bits
+    QBitArray sparse(100000);
+    const QList<qsizetype> positions = { 0, 63, 64, 4095, 50000, 99999 };
+    for (qsizetype i : positions)
+        sparse.setBit(i);
+    QList<qsizetype> found;
+    for (qsizetype i = sparse.indexOf(true); i != -1; i = sparse.indexOf(true, i + 1))
+        found.append(i);
+    QCOMPARE(found, positions);
+}
+
+void tst_QBitArray::lastIndexOf()
+{
+    QCOMPARE(QBitArray().lastIndexOf(true), -1);
+    QCOMPARE(QBitArray(100).lastIndexOf(true), -1);
+    QCOMPARE(QBitArray(100).lastIndexOf(false), 99);
+    QCOMPARE(QBitArray(100).lastIndexOf(false, 1000), 99);
+    QCOMPARE(QBitArray(100).lastIndexOf(false, -100), 0);
+    QCOMPARE(QBitArray(100).lastIndexOf(false, -101), -1);
+
+    QRandomGenerator rng(8);
+    for (qsizetype size : { 1, 63, 64, 65, 200, 1000 }) {
+        for (int percentSet : { 1, 50, 99 }) {
+            const QBitArray ba = randomBitArray(rng, size, percentSet);
+            for (bool on : { true, false }) {
+                for (qsizetype from = 0; from < size; ++from) {
+                    qsizetype expected = from;
+                    while (expected >= 0 && ba.testBit(expected) != on)
+                        --expected;
+                    QCOMPARE(ba.lastIndexOf(on, from), expected);
+                }
+            }
+        }
+    }
+}
+
+void tst_QBitArray::rankSelect_data()
+{
+    QTest::addColumn<QBitArray>("bits");
+
+    QRandomGenerator rng(99);
+    QTest::newRow("null") << QBitArray();
+    QTest::newRow("zeroes") << QBitArray(10000);
+    QTest::newRow("ones") << QBitArray(10000, true);
+    QTest::newRow("one-bit") << QBitArray(1, true);
+    QTest::newRow("dense") << randomBitArray(rng, 70001, 90);
+    QTest::newRow("half") << randomBitArray(rng, 70001, 50);
+    QTest::newRow("sparse") << randomBitArray(rng, 200003, 1);
+}
+
+void tst_QBitArray::rankSelect()
+{
+    QFETCH(QBitArray, bits);
+
+    const QBitArrayRankSelect index(bits);
+    QCOMPARE(index.bitArray(), bits);
+    QCOMPARE(index.size(), bits.size());
+    QCOMPARE(index.count(), bits.count(true));
+
+    qsizetype ones = 0;
+    for (qsizetype i = 0; i < bits.size(); ++i) {
+        QCOMPARE(index.rank(i), ones);
+        if (bits.testBit(i)) {
+            QCOMPARE(index.select(ones), i);
+            ++ones;
+        }
+    }
+    QCOMPARE(index.rank(bits.size()), ones);
+    QCOMPARE(index.select(ones), -1);
+    QCOMPARE(index.select(-1), -1);
+}
+
 QTEST_APPLESS_MAIN(tst_QBitArray)
 #include "tst_qbitarray.moc"
@@ -0,0 +1,376 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QAtomicInt>
+#include <QConcurrentCache>
+#include <QString>
+#include <QThread>
+
+#include <memory>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+using namespace std::chrono_literals;
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void construction();
+    void insertAndFind();
+    void replace();
+    void findOrCompute();
+    void removeAndTake();
+    void clear();
+    void cost();
+    void oversizedEntries();
+    void entriesLargerThanShare();
+    void fewerCostThanShards();
+    void setMaxCost();
+    void scanResistance();
+    void frequentEntriesAreAdmitted();
+    void timeToLive();
+    void removeExpired();
+    void statistics();
+    void concurrentAccess();
+};
+
+void tst_QConcurrentCache::construction()
+{
+    QConcurrentCache<int, int> cache;
+    QCOMPARE(cache.maxCost(), 100);
+    QCOMPARE(cache.shardCount(), qsizetype(QConcurrentCache<int, int>::DefaultShardCount));
+    QCOMPARE(cache.timeToLive(), 0ms);
+    QVERIFY(cache.isEmpty());
+    QCOMPARE(cache.size(), 0);
+    QCOMPARE(cache.totalCost(), 0);
+
+    QConcurrentCache<int, int> sharded(1000, 5);
+    QCOMPARE(sharded.maxCost(), 1000);
+    QCOMPARE(sharded.shardCount(), 8);
+}
+
+void tst_QConcurrentCache::insertAndFind()
+{
+    QConcurrentCache<QString, int> cache(100, 1);
+    QCOMPARE(cache.find(u"a"_s), std::nullopt);
+    QCOMPARE(cache.value(u"a"_s), 0);
+    QCOMPARE(cache.value(u"a"_s, -1), -1);
+    QVERIFY(!cache.contains(u"a"_s));
+
+    QVERIFY(cache.insert(u"a"_s, 1));
+    QVERIFY(cache.insert(u"b"_s, 2, 5));
+    QCOMPARE(cache.size(), 2);
+    QCOMPARE(cache.totalCost(), 6);
+    QVERIFY(cache.contains(u"a"_s));
+    QCOMPARE(cache.find(u"a"_s), 1);
+    QCOMPARE(cache.value(u"b"_s), 2);
+}
+
+void tst_QConcurrentCache::replace()
+{
+    QConcurrentCache<int, QString> cache(100, 1);
+    QVERIFY(cache.insert(1, u"one"_s, 10));
+    QVERIFY(cache.insert(1, u"uno"_s, 4));
+    QCOMPARE(cache.size(), 1);
+    QCOMPARE(cache.totalCost(), 4);
+    QCOMPARE(cache.value(1), u"uno"_s);
+}
+
+void tst_QConcurrentCache::findOrCompute()
+{
+    QConcurrentCache<int, QString> cache(100, 1);
+    int calls = 0;
+    auto factory = [&calls] { ++calls; return u"made"_s; };
+
+    QCOMPARE(cache.findOrCompute(1, factory, 7), u"made"_s);
+    QCOMPARE(calls, 1);
+    QCOMPARE(cache.totalCost(), 7);
+    QCOMPARE(cache.findOrCompute(1, factory), u"made"_s);
+    QCOMPARE(calls, 1);
+
+    // the factory runs unlocked, so it may use the cache, even the same shard
+    QCOMPARE(cache.findOrCompute(2, [&] { return cache.value(1) + u'!'; }), u"made!"_s);
+    QCOMPARE(cache.findOrCompute(3, [&] {
+                 cache.insert(3, u"inner"_s);
+                 return u"outer"_s;
+             }), u"inner"_s);
+    QCOMPARE(cache.value(3), u"inner"_s);
+}
+
+void tst_QConcurrentCache::removeAndTake()
+{
+    QConcurrentCache<int, QString> cache(100, 2);
+    cache.insert(1, u"one"_s, 3);
+    cache.insert(2, u"two"_s, 4);
+
+    QVERIFY(cache.remove(1));
+    QVERIFY(!cache.remove(1));
+    QCOMPARE(cache.totalCost(), 4);
+
+    QCOMPARE(cache.take(2), u"two"_s);
+    QCOMPARE(cache.take(2), std::nullopt);
+    QVERIFY(cache.isEmpty());
+    QCOMPARE(cache.totalCost(), 0);
+}
+
+void tst_QConcurrentCache::clear()
+{
+    QConcurrentCache<int, int> cache(1000, 4);
+    for (int i = 0; i < 100; ++i)
+        cache.insert(i, i);
+    QCOMPARE(cache.size(), 100);
+    cache.clear();
+    QVERIFY(cache.isEmpty());
+    QCOMPARE(cache.totalCost(), 0);
+    QVERIFY(cache.insert(1, 1));
+    QCOMPARE(cache.value(1), 1);
+}
+
+void tst_QConcurrentCache::cost()
+{
+    QConcurrentCache<int, int> cache(10, 1);
+    for (int i = 0; i < 100; ++i) {
+        cache.insert(i, i, 3);
+        QVERIFY(cache.totalCost() <= 10);
+    }
+    QCOMPARE(cache.size(), 3);
+    QCOMPARE(cache.totalCost(), 9);
+
+    // zero-cost entries never cause evictions
+    QConcurrentCache<int, int> free(0, 1);
+    QVERIFY(free.insert(1, 1, 0));
+    QVERIFY(!free.insert(2, 2, 1));
+    QCOMPARE(free.size(), 1);
+}
+
+void tst_QConcurrentCache::oversizedEntries()
+{
+    QConcurrentCache<int, int> cache(100, 4);
+    QVERIFY(cache.insert(1, 1, 25));
+    QVERIFY(!cache.insert(2, 2, 101));
+    QVERIFY(!cache.contains(2));
+
+    // an oversized replacement removes the old entry, like in QCache
+    QVERIFY(!cache.insert(1, 10, 1000));
+    QVERIFY(!cache.contains(1));
+    QVERIFY(cache.isEmpty());
+}
+
+void tst_QConcurrentCache::entriesLargerThanShare()
+{
+    // like QCache(100), accept entries costing more than a shard's share
+    QConcurrentCache<int, int> cache(100);
+    QCOMPARE(cache.shardCount(), 8);
+    QVERIFY(cache.insert(1, 1, 20));
+    QVERIFY(cache.contains(1));
+    cache.clear();
+    QVERIFY(cache.insert(2, 2, 100));
+    QVERIFY(cache.contains(2));
+    QCOMPARE(cache.totalCost(), 100);
+
+    // filling the cache with many keys keeps it within budget
+    for (int i = 10; i < 200; ++i) {
+        cache.insert(i, i, 1 + i % 30);
+        QVERIFY(cache.totalCost() <= 100);
+    }
+}
+
+void tst_QConcurrentCache::fewerCostThanShards()
+{
+    QConcurrentCache<int, int> cache(4);
+    QCOMPARE(cache.shardCount(), 8);
+    for (int i = 0; i < 4; ++i)
+        QVERIFY(cache.insert(i, i));
+    for (int i = 0; i < 4; ++i)
+        QVERIFY(cache.contains(i));
+    QCOMPARE(cache.size(), 4);
+
+    cache.insert(4, 4);
+    QCOMPARE(cache.size(), 4);
+    QCOMPARE(cache.totalCost(), 4);
+    QCOMPARE(cache.statistics().evictions, 1);
+}
+
+void tst_QConcurrentCache::setMaxCost()
+{
+    QConcurrentCache<int, int> cache(100, 1);
+    for (int i = 0; i < 100; ++i)
+        cache.insert(i, i);
+    QCOMPARE(cache.size(), 100);
+
+    cache.setMaxCost(40);
+    QCOMPARE(cache.maxCost(), 40);
+    QCOMPARE(cache.size(), 40);
+    QCOMPARE(cache.statistics().evictions, 60);
+
+    cache.setMaxCost(-1);
+    QCOMPARE(cache.maxCost(), 0);
+    QVERIFY(cache.isEmpty());
+}
+
+void tst_QConcurrentCache::scanResistance()
+{
+    // A hot set that keeps being used survives a long scan of keys that are
+    // used once; a strict LRU cache would lose all of it during each burst
+    // of 1000 scanned keys.
+    constexpr int HotKeys = 50;
+    QConcurrentCache<int, int> cache(100, 1);
+    auto useHotSet = [&] {
+        for (int key = 0; key < HotKeys; ++key)
+            cache.findOrCompute(key, [key] { return key; });
+    };
+    for (int round = 0; round < 5; ++round)
+        useHotSet();
+
+    const auto before = cache.statistics();
+    for (int key = 1000; key < 11000; ++key) {
+        cache.findOrCompute(key, [key] { return key; });
+        if (key % 1000 == 999)
+            useHotSet();
+    }
+    const auto after = cache.statistics();
+    // the hot set was hardly ever missed, while strict LRU would have
+    // missed every hot key in each of the ten rounds
+    QVERIFY(after.misses - before.misses < 10000 + 10 * HotKeys / 4);
+
+    int survivors = 0;
+    for (int key = 0; key < HotKeys; ++key)
+        survivors += cache.contains(key);
+    QCOMPARE(survivors, HotKeys);
+    QVERIFY(cache.totalCost() <= 100);
+}
+
+void tst_QConcurrentCache::frequentEntriesAreAdmitted()
+{
+    // Keys that keep being requested displace entries used only once,
+    // even though they are new to the cache each time.
+    QConcurrentCache<int, int> cache(20, 1);
+    for (int key = 0; key < 20; ++key)
+        cache.insert(key, key);
+
+    for (int round = 0; round < 10; ++round) {
+        for (int key = 100; key < 105; ++key)
+            cache.findOrCompute(key, [key] { return key; });
+    }
+    for (int key = 100; key < 105; ++key)
+        QVERIFY2(cache.contains(key), QByteArray::number(key));
+    QCOMPARE(cache.size(), 20);
+}
+
+void tst_QConcurrentCache::timeToLive()
+{
+    // Only entries that are meant to expire get a short lifetime, so that
+    // a stalled machine can't make the others expire too.
+    QConcurrentCache<int, int> cache(100, 1);
+    cache.insert(1, 1, 1, 10ms);
+    cache.insert(5, 5, 1, 1min);
+    cache.setTimeToLive(10ms);
+    QCOMPARE(cache.timeToLive(), 10ms);
+    cache.insert(2, 2);
+    cache.insert(3, 3, 1, 0ms); // never expires
+    cache.setTimeToLive(1min);
+    cache.insert(6, 6);
+    cache.setTimeToLive(0ms);
+    cache.insert(4, 4);
+    QVERIFY(cache.contains(5));
+    QVERIFY(cache.contains(6));
+
+    QThread::sleep(30ms);
+    QVERIFY(!cache.contains(1));
+    QCOMPARE(cache.find(1), std::nullopt);
+    QCOMPARE(cache.take(2), std::nullopt);
+    QCOMPARE(cache.value(3), 3);
+    QCOMPARE(cache.value(4), 4);
+    QCOMPARE(cache.value(5), 5);
+    QCOMPARE(cache.value(6), 6);
+    QCOMPARE(cache.size(), 4);
+    QCOMPARE(cache.statistics().expirations, 2);
+
+    // re-inserting gives a new lifetime
+    cache.insert(7, 7, 1, 10ms);
+    QThread::sleep(30ms);
+    cache.insert(7, 8);
+    QCOMPARE(cache.find(7), 8);
+}
+
+void tst_QConcurrentCache::removeExpired()
+{
+    QConcurrentCache<int, int> cache(100, 4);
+    for (int i = 0; i < 10; ++i)
+        cache.insert(i, i, 1, i % 2 ? 10ms : 0ms);
+    QThread::sleep(30ms);
+    QCOMPARE(cache.size(), 10);
+    QCOMPARE(cache.removeExpired(), 5);
+    QCOMPARE(cache.size(), 5);
+    QCOMPARE(cache.totalCost(), 5);
+    QCOMPARE(cache.removeExpired(), 0);
+    QCOMPARE(cache.statistics().expirations, 5);
+}
+
+void tst_QConcurrentCache::statistics()
+{
+    QConcurrentCache<int, int> cache(3, 1);
+    cache.insert(1, 1);
+    QVERIFY(cache.find(1));
+    QVERIFY(cache.find(1));
+    QVERIFY(!cache.find(2));
+    cache.value(3);
+    QVERIFY(cache.contains(1)); // does not count
+
+    QConcurrentCache<int, int>::Statistics s = cache.statistics();
+    QCOMPARE(s.hits, 2);
+    QCOMPARE(s.misses, 2);
+    QCOMPARE(s.evictions, 0);
+    QCOMPARE(s.expirations, 0);
+
+    for (int i = 10; i < 20; ++i)
+        cache.insert(i, i);
+    QCOMPARE(cache.statistics().evictions, 8);
+
+    cache.resetStatistics();
+    s = cache.statistics();
+    QCOMPARE(s.hits, 0);
+    QCOMPARE(s.misses, 0);
+    QCOMPARE(s.evictions, 0);
+}
+
+void tst_QConcurrentCache::concurrentAccess()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int Lookups = 20000;
+    QConcurrentCache<int, int> cache(500);
+    QAtomicInt wrongValues;
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&, t] {
+            quint32 state = 12345 + t;
+            for (int i = 0; i < Lookups; ++i) {
+                state = state * 1664525u + 1013904223u;
+                // skewed towards small keys, so that some are hot
+                const int key = int((state >> 16) % 2000) % (1 + int(state >> 28) * 100);
+                const int cost = 1 + key % 3;
+                if (cache.findOrCompute(key, [key] { return key * 2; }, cost) != key * 2)
+                    wrongValues.ref();
+                if (i % 100 == 0)
+                    cache.remove(key + 1);
+            }
+        }));
+    }
+    for (auto &thread : threads)
+        thread->start();
+    for (auto &thread : threads)
+        QVERIFY(thread->wait());
+
+    QCOMPARE(wrongValues.loadRelaxed(), 0);
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+    const auto s = cache.statistics();
+    QCOMPARE(s.hits + s.misses, qint64(ThreadCount) * Lookups);
+    QVERIFY(s.hits > 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QConcurrentCache)
+#include "tst_qconcurrentcache.moc"
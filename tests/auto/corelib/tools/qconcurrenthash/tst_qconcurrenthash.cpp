@@ -0,0 +1,266 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QAtomicInt>
+#include <QConcurrentHash>
+#include <QString>
+#include <QThread>
+
+#include <memory>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void shardCount_data();
+    void shardCount();
+    void insertAndFind();
+    void insertIfAbsent();
+    void findOrInsert();
+    void modify();
+    void removeAndTake();
+    void clear();
+    void toHash();
+    void factoryResultIsStored();
+    void concurrentInsert();
+    void concurrentFindOrInsert();
+    void concurrentModify();
+    void concurrentMixed();
+};
+
+template <typename Function>
+static void runInThreads(int count, Function function)
+{
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < count; ++i)
+        threads.emplace_back(QThread::create(function, i));
+    for (auto &thread : threads)
+        thread->start();
+    for (auto &thread : threads)
+        QVERIFY(thread->wait());
+}
+
+void tst_QConcurrentHash::shardCount_data()
+{
+    QTest::addColumn<qsizetype>("requested");
+    QTest::addColumn<qsizetype>("expected");
+
+    QTest::newRow("zero") << qsizetype(0) << qsizetype(1);
+    QTest::newRow("one") << qsizetype(1) << qsizetype(1);
+    QTest::newRow("three") << qsizetype(3) << qsizetype(4);
+    QTest::newRow("sixteen") << qsizetype(16) << qsizetype(16);
+    QTest::newRow("seventeen") << qsizetype(17) << qsizetype(32);
+}
+
+void tst_QConcurrentHash::shardCount()
+{
+    QFETCH(qsizetype, requested);
+    QFETCH(qsizetype, expected);
+
+    QConcurrentHash<int, int> hash(requested);
+    QCOMPARE(hash.shardCount(), expected);
+
+    // all keys are found again, whatever the number of shards
+    for (int i = 0; i < 1000; ++i)
+        QVERIFY(hash.insert(i, i * 2));
+    QCOMPARE(hash.size(), 1000);
+    for (int i = 0; i < 1000; ++i)
+        QCOMPARE(hash.value(i), i * 2);
+
+    QConcurrentHash<int, int> defaultHash;
+    QCOMPARE(defaultHash.shardCount(), qsizetype(QConcurrentHash<int, int>::DefaultShardCount));
+}
+
+void tst_QConcurrentHash::insertAndFind()
+{
+    QConcurrentHash<QString, int> hash;
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.size(), 0);
+    QVERIFY(!hash.contains(u"one"_s));
+    QCOMPARE(hash.find(u"one"_s), std::nullopt);
+    QCOMPARE(hash.value(u"one"_s), 0);
+    QCOMPARE(hash.value(u"one"_s, -1), -1);
+
+    QVERIFY(hash.insert(u"one"_s, 1));
+    QVERIFY(hash.insert(u"two"_s, 2));
+    QVERIFY(!hash.insert(u"one"_s, 11)); // replaces
+    QVERIFY(!hash.isEmpty());
+    QCOMPARE(hash.size(), 2);
+    QVERIFY(hash.contains(u"one"_s));
+    QCOMPARE(hash.find(u"one"_s), 11);
+    QCOMPARE(hash.value(u"two"_s), 2);
+    QCOMPARE(hash.value(u"two"_s, -1), 2);
+}
+
+void tst_QConcurrentHash::insertIfAbsent()
+{
+    QConcurrentHash<int, QString> hash;
+    QVERIFY(hash.insertIfAbsent(1, u"a"_s));
+    QVERIFY(!hash.insertIfAbsent(1, u"b"_s));
+    QCOMPARE(hash.value(1), u"a"_s);
+    QCOMPARE(hash.size(), 1);
+}
+
+void tst_QConcurrentHash::findOrInsert()
+{
+    QConcurrentHash<int, QString> hash;
+    int calls = 0;
+    auto factory = [&calls] { ++calls; return u"created"_s; };
+
+    QCOMPARE(hash.findOrInsert(7, factory), u"created"_s);
+    QCOMPARE(calls, 1);
+    QCOMPARE(hash.findOrInsert(7, factory), u"created"_s);
+    QCOMPARE(calls, 1);
+
+    hash.insert(8, u"existing"_s);
+    QCOMPARE(hash.findOrInsert(8, factory), u"existing"_s);
+    QCOMPARE(calls, 1);
+    QCOMPARE(hash.size(), 2);
+}
+
+void tst_QConcurrentHash::modify()
+{
+    QConcurrentHash<int, QList<int>> hash;
+    QVERIFY(!hash.modify(1, [](QList<int> &list) { list.append(1); }));
+    QVERIFY(!hash.contains(1));
+
+    hash.insert(1, {});
+    QVERIFY(hash.modify(1, [](QList<int> &list) { list.append(1); }));
+    QVERIFY(hash.modify(1, [](QList<int> &list) { list.append(2); }));
+    QCOMPARE(hash.value(1), QList<int>({ 1, 2 }));
+}
+
+void tst_QConcurrentHash::removeAndTake()
+{
+    QConcurrentHash<int, QString> hash;
+    hash.insert(1, u"one"_s);
+    hash.insert(2, u"two"_s);
+
+    QVERIFY(hash.remove(1));
+    QVERIFY(!hash.remove(1));
+    QVERIFY(!hash.contains(1));
+
+    QCOMPARE(hash.take(2), u"two"_s);
+    QCOMPARE(hash.take(2), std::nullopt);
+    QVERIFY(hash.isEmpty());
+}
+
+void tst_QConcurrentHash::clear()
+{
+    QConcurrentHash<int, int> hash(8);
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(42));
+    QVERIFY(hash.insert(42, 1));
+}
+
+void tst_QConcurrentHash::toHash()
+{
+    QConcurrentHash<int, int> hash(4);
+    QHash<int, int> expected;
+    QCOMPARE(hash.toHash(), expected);
+
+    for (int i = 0; i < 500; ++i) {
+        hash.insert(i, -i);
+        expected.insert(i, -i);
+    }
+    QCOMPARE(hash.toHash(), expected);
+}
+
+void tst_QConcurrentHash::factoryResultIsStored()
+{
+    // the returned value is a copy of the one stored in the hash
+    QConcurrentHash<int, std::shared_ptr<int>> hash;
+    const std::shared_ptr<int> value = hash.findOrInsert(1, [] { return std::make_shared<int>(5); });
+    QCOMPARE(*value, 5);
+    QCOMPARE(value.use_count(), 2);
+    QCOMPARE(hash.find(1), value);
+}
+
+static constexpr int ThreadCount = 8;
+
+void tst_QConcurrentHash::concurrentInsert()
+{
+    constexpr int PerThread = 5000;
+    QConcurrentHash<int, int> hash(16);
+    runInThreads(ThreadCount, [&hash](int thread) {
+        for (int i = 0; i < PerThread; ++i)
+            hash.insert(thread * PerThread + i, thread);
+    });
+
+    QCOMPARE(hash.size(), ThreadCount * PerThread);
+    for (int i = 0; i < ThreadCount * PerThread; ++i)
+        QCOMPARE(hash.value(i, -1), i / PerThread);
+}
+
+void tst_QConcurrentHash::concurrentFindOrInsert()
+{
+    // All threads ask for the same keys; each value must be created once.
+    constexpr int Keys = 2000;
+    QConcurrentHash<int, int> hash;
+    QAtomicInt created;
+    runInThreads(ThreadCount, [&](int) {
+        for (int i = 0; i < Keys; ++i) {
+            const int value = hash.findOrInsert(i, [&] { created.ref(); return i * 3; });
+            if (value != i * 3)
+                qFatal("findOrInsert returned %d for key %d", value, i);
+        }
+    });
+
+    QCOMPARE(created.loadRelaxed(), Keys);
+    QCOMPARE(hash.size(), Keys);
+}
+
+void tst_QConcurrentHash::concurrentModify()
+{
+    constexpr int Keys = 16;
+    constexpr int Increments = 10000;
+    QConcurrentHash<int, int> hash(4);
+    for (int i = 0; i < Keys; ++i)
+        hash.insert(i, 0);
+
+    runInThreads(ThreadCount, [&hash](int) {
+        for (int i = 0; i < Increments; ++i)
+            hash.modify(i % Keys, [](int &value) { ++value; });
+    });
+
+    for (int i = 0; i < Keys; ++i)
+        QCOMPARE(hash.value(i), ThreadCount * Increments / Keys);
+}
+
+void tst_QConcurrentHash::concurrentMixed()
+{
+    // Readers and writers on overlapping keys; each thread owns the keys
+    // congruent to its number and checks that no other thread touched them.
+    constexpr int Keys = 4096;
+    QConcurrentHash<int, int> hash(8);
+    QAtomicInt errors;
+    runInThreads(ThreadCount, [&](int thread) {
+        for (int round = 0; round < 20; ++round) {
+            for (int key = thread; key < Keys; key += ThreadCount)
+                hash.insert(key, round);
+            for (int key = 0; key < Keys; ++key) {
+                const std::optional<int> value = hash.find(key);
+                if (key % ThreadCount == thread && value != round)
+                    errors.ref();
+            }
+            for (int key = thread; key < Keys; key += 2 * ThreadCount) {
+                if (hash.take(key) != round)
+                    errors.ref();
+            }
+        }
+    });
+
+    QCOMPARE(errors.loadRelaxed(), 0);
+    QCOMPARE(hash.size(), Keys / 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QConcurrentHash)
+#include "tst_qconcurrenthash.moc"
@@ -33,6 +33,10 @@ private slots:
     void hashLength();
     void addDataAcceptsNullByteArrayView_data() { all_methods(false); }
     void addDataAcceptsNullByteArrayView();
+    void addDataInPieces_data() { all_methods(false); }
+    void addDataInPieces();
+    void hashMany_data() { all_methods(false); }
+    void hashMany();
     void move();
     void swap();
 private:
@@ -539,6 +543,71 @@ void tst_QCryptographicHash::addDataAcceptsNullByteArrayView()
     QCOMPARE(hash2.resultView(), expected);
 }
 
+void tst_QCryptographicHash::addDataInPieces()
+{
+    QFETCH(const QCryptographicHash::Algorithm, algorithm);
+
+    if (!QCryptographicHash::supportsAlgorithm(algorithm))
+        QSKIP("QCryptographicHash doesn't support this algorithm");
+
+    // Large chunks take the multi-block (possibly SIMD) paths, single bytes
+    // go through the partial block buffer; both must agree.
+    QByteArray data(5000, Qt::Uninitialized);
+    for (qsizetype i = 0; i < data.size(); ++i)
+        data[i] = char(i * 7 + i / 256);
+
+    for (qsizetype size : {0, 1, 63, 64, 65, 127, 128, 129, 1000, 5000}) {
+        const QByteArrayView message = QByteArrayView(data).first(size);
+
+        QCryptographicHash whole(algorithm);
+        whole.addData(message);
+
+        QCryptographicHash bytewise(algorithm);
+        for (char c : message)
+            bytewise.addData(QByteArrayView(&c, 1));
+
+        QCryptographicHash split(algorithm);
+        split.addData(message.first(size / 3));
+        split.addData(message.sliced(size / 3));
+
+        QCOMPARE(bytewise.resultView(), whole.resultView());
+        QCOMPARE(split.resultView(), whole.resultView());
+    }
+}
+
+void tst_QCryptographicHash::hashMany()
+{
+    QFETCH(const QCryptographicHash::Algorithm, algorithm);
+
+    if (!QCryptographicHash::supportsAlgorithm(algorithm))
+        QSKIP("QCryptographicHash doesn't support this algorithm");
+
+    QCOMPARE(QCryptographicHash::hashMany({}, algorithm), QList<QByteArray>());
+
+    // Sizes around the padding boundaries, in an order that makes the
+    // messages of a batch finish at different times.
+    const qsizetype sizes[] = { 0, 55, 56, 63, 64, 65, 119, 120, 1, 4096, 3, 200,
+                                128, 10000, 57, 0, 119, 64, 777, 2 };
+    QList<QByteArray> data;
+    QList<QByteArrayView> messages;
+    for (qsizetype size : sizes) {
+        QByteArray message(size, Qt::Uninitialized);
+        for (qsizetype i = 0; i < size; ++i)
+            message[i] = char(i * 13 + size);
+        data.append(message);
+    }
+    for (const QByteArray &message : std::as_const(data))
+        messages.append(message);
+
+    for (qsizetype count = 1; count <= messages.size(); ++count) {
+        const QList<QByteArray> results =
+                QCryptographicHash::hashMany(QSpan(messages).first(count), algorithm);
+        QCOMPARE(results.size(), count);
+        for (qsizetype i = 0; i < count; ++i)
+            QCOMPARE(results.at(i), QCryptographicHash::hash(messages.at(i), algorithm));
+    }
+}
+
 void tst_QCryptographicHash::move()
 {
     QCryptographicHash hash1(QCryptographicHash::Sha1);
@@ -19,6 +19,7 @@ private slots:
     void readPointerAtPositionEmptyRead();
     void readPointerAtPositionWithHead();
     void readPointerAtPositionReadTooMuch();
+    void readPointers();
     void sizeWhenReservedAndChopped();
     void sizeWhenReserved();
     void free();
@@ -193,6 +194,44 @@ void tst_QRingBuffer::readPointerAtPositionWriteRead()
     QVERIFY(outData.buffer().startsWith(inData.buffer()));
 }
 
+void tst_QRingBuffer::readPointers()
+{
+    QRingBuffer ringBuffer;
+    QByteArrayView blocks[4];
+    QVERIFY(ringBuffer.readPointers(blocks, 100).isEmpty());
+
+    ringBuffer.append(QByteArray("abc"));
+    ringBuffer.append(QByteArray("defgh"));
+    ringBuffer.append(QByteArray("ij"));
+    ringBuffer.append(QByteArray("klm"));
+    ringBuffer.append(QByteArray("nopq"));
+    ringBuffer.free(1);
+
+    QSpan<QByteArrayView> result = ringBuffer.readPointers(blocks, ringBuffer.size());
+    QCOMPARE(result.size(), 4);
+    QCOMPARE(result.data(), blocks);
+    QCOMPARE(result[0], "bc");
+    QCOMPARE(result[1], "defgh");
+    QCOMPARE(result[2], "ij");
+    QCOMPARE(result[3], "klm");
+    // the views point into the buffer itself
+    QCOMPARE(result[0].data(), ringBuffer.readPointer());
+
+    // limited by length
+    result = ringBuffer.readPointers(blocks, 9);
+    QCOMPARE(result.size(), 3);
+    QCOMPARE(result[2], "ij");
+    result = ringBuffer.readPointers(blocks, 4);
+    QCOMPARE(result.size(), 2);
+    QCOMPARE(result[1], "de");
+    QVERIFY(ringBuffer.readPointers(blocks, 0).isEmpty());
+
+    // limited by the number of blocks
+    result = ringBuffer.readPointers(QSpan(blocks).first(1), ringBuffer.size());
+    QCOMPARE(result.size(), 1);
+    QCOMPARE(result[0], "bc");
+}
+
 void tst_QRingBuffer::free()
 {
     QRingBuffer ringBuffer;
@@ -7,6 +7,18 @@
 #include <qcoreapplication.h>
 #include <qdebug.h>
 #include <qabstractsocket.h>
+#include <qnetworkproxy.h>
+#include <qprocess.h>
+#include <qtcpserver.h>
+#include <qtcpsocket.h>
+#include <qtemporaryfile.h>
+
+#ifdef Q_OS_UNIX
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
 
 class tst_QAbstractSocket : public QObject
 {
@@ -18,6 +30,11 @@ public:
 
 private slots:
     void getSetCheck();
+    void sendFile();
+#ifdef Q_OS_UNIX
+    void sendFileToClosedPeer();
+    void sendFileToClosedPeerChild();
+#endif
 };
 
 tst_QAbstractSocket::tst_QAbstractSocket()
@@ -64,5 +81,88 @@ void tst_QAbstractSocket::getSetCheck()
     QCOMPARE(quint16(0xffff), obj1.peerPort());
 }
 
+void tst_QAbstractSocket::sendFile()
+{
+    const QByteArray contents = QByteArray("0123456789abcdef").repeated(64 * 1024);
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write(contents), contents.size());
+    QVERIFY(file.seek(10));
+
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+    QTcpSocket socket;
+    socket.setProxy(QNetworkProxy::NoProxy);
+    socket.connectToHost(server.serverAddress(), server.serverPort());
+    QVERIFY(socket.waitForConnected(5000));
+    QVERIFY(server.waitForNewConnection(5000));
+    std::unique_ptr<QTcpSocket> peer(server.nextPendingConnection());
+    QVERIFY(peer);
+
+    QByteArray received;
+    connect(peer.get(), &QIODevice::readyRead, this, [&] { received += peer->readAll(); });
+
+    const qint64 offset = 100;
+    const qint64 size = contents.size() - 1000;
+    QCOMPARE(socket.write("head"), 4);
+    QCOMPARE(socket.sendFile(&file, offset, size), size);
+    QCOMPARE(file.pos(), 10);
+    QCOMPARE(socket.bytesToWrite(), size + 4);
+    file.close();
+
+    const QByteArray expected = "head" + contents.mid(offset, size);
+    QTRY_COMPARE_WITH_TIMEOUT(received.size(), expected.size(), 10000);
+    QVERIFY(received == expected);
+    QCOMPARE(socket.bytesToWrite(), 0);
+}
+
+#ifdef Q_OS_UNIX
+void tst_QAbstractSocket::sendFileToClosedPeer()
+{
+#if !QT_CONFIG(process)
+    QSKIP("This test requires QProcess support");
+#else
+    // Writing to a socket ignores SIGPIPE for the rest of the process, and
+    // so may the test harness. Only a fresh process shows whether sendFile()
+    // does that itself, so run the check in a child: QProcess restores the
+    // default SIGPIPE handler there, and the child dies if it is raised.
+    QProcess child;
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert(QStringLiteral("QT_TST_QABSTRACTSOCKET_CHILD"), QStringLiteral("1"));
+    child.setProcessEnvironment(environment);
+    child.setProcessChannelMode(QProcess::ForwardedChannels);
+    child.start(QCoreApplication::applicationFilePath(),
+                { QStringLiteral("sendFileToClosedPeerChild") });
+    QVERIFY2(child.waitForFinished(30000), qPrintable(child.errorString()));
+    QCOMPARE(child.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(child.exitCode(), 0);
+#endif
+}
+
+void tst_QAbstractSocket::sendFileToClosedPeerChild()
+{
+    if (!qEnvironmentVariableIsSet("QT_TST_QABSTRACTSOCKET_CHILD"))
+        QSKIP("Run by sendFileToClosedPeer() in a child process");
+
+    const QByteArray contents(64 * 1024, 'x');
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write(contents), contents.size());
+
+    // The peer end of a socket pair is closed before anything is sent, so
+    // the first sendfile() fails with EPIPE.
+    int fds[2];
+    QCOMPARE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    QTcpSocket socket;
+    QVERIFY(socket.setSocketDescriptor(fds[0]));
+    ::close(fds[1]);
+
+    QCOMPARE(socket.sendFile(&file), contents.size());
+    socket.flush();
+    QTRY_COMPARE_WITH_TIMEOUT(socket.state(), QAbstractSocket::UnconnectedState, 10000);
+    QCOMPARE(socket.error(), QAbstractSocket::RemoteHostClosedError);
+}
+#endif // Q_OS_UNIX
+
 QTEST_MAIN(tst_QAbstractSocket)
 #include "tst_qabstractsocket.moc"
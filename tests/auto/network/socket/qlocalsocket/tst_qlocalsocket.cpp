@@ -111,6 +111,7 @@ private slots:
     void writeToClientAndDisconnect_data();
     void writeToClientAndDisconnect();
     void writeToDisconnected();
+    void writeManyByteArrays();
 
     void debug();
     void bytesWrittenSignal();
@@ -1529,6 +1530,43 @@ void tst_QLocalSocket::writeToClientAndDisconnect()
     QCOMPARE(client.state(), QLocalSocket::UnconnectedState);
 }
 
+void tst_QLocalSocket::writeManyByteArrays()
+{
+    // Each QByteArray written is kept as a chunk of its own in the write
+    // buffer; they are flushed together and must arrive complete and in order.
+    CrashSafeLocalServer server;
+    QVERIFY2(server.listen("writeManyByteArrays"), qUtf8Printable(server.errorString()));
+    QLocalSocket client;
+    client.connectToServer("writeManyByteArrays");
+    QVERIFY(client.waitForConnected(3000));
+    QVERIFY(server.waitForNewConnection(3000));
+    QLocalSocket *serverSocket = server.nextPendingConnection();
+    QVERIFY(serverSocket);
+
+    QByteArray expected;
+    for (int i = 0; i < 500; ++i) {
+        const QByteArray message = QByteArray::number(i) + QByteArray(i % 37, 'x') + ';';
+        expected += message;
+        QCOMPARE(serverSocket->write(message), message.size());
+    }
+    // larger than the chunks handed to the kernel at once, and than a pipe buffer
+    const QByteArray big(200'000, 'b');
+    expected += big;
+    QCOMPARE(serverSocket->write(big), big.size());
+    QCOMPARE(serverSocket->bytesToWrite(), expected.size());
+
+    QByteArray received;
+    while (received.size() < expected.size()) {
+        serverSocket->flush();
+        if (!client.bytesAvailable() && !client.waitForReadyRead(3000))
+            break;
+        received += client.readAll();
+    }
+    QCOMPARE(received.size(), expected.size());
+    QCOMPARE(received, expected);
+    QCOMPARE(serverSocket->bytesToWrite(), 0);
+}
+
 void tst_QLocalSocket::writeToDisconnected()
 {
     CrashSafeLocalServer server;
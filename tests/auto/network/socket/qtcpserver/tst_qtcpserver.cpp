@@ -38,6 +38,9 @@
 
 #include "../../../network-settings.h"
 
+#include <memory>
+#include <vector>
+
 #if defined(Q_OS_LINUX)
 #define SHOULD_CHECK_SYSCALL_SUPPORT
 #include <netinet/in.h>
@@ -83,6 +86,7 @@ private slots:
 
     void qtbug6305_data() { serverAddress_data(); }
     void qtbug6305();
+    void reusePort();
 
     void linkLocal();
 
@@ -914,6 +918,59 @@ void tst_QTcpServer::qtbug6305()
     QVERIFY(!server2.listen(listenAddress, server.serverPort())); // second listen should fail
 }
 
+void tst_QTcpServer::reusePort()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer server;
+    QVERIFY(!server.isReusePortEnabled());
+    server.setReusePortEnabled(true);
+    QVERIFY(server.isReusePortEnabled());
+#if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
+    QVERIFY2(server.listen(QHostAddress::LocalHost), qPrintable(server.errorString()));
+#else
+    QVERIFY(!server.listen(QHostAddress::LocalHost));
+    QCOMPARE(server.serverError(), QAbstractSocket::UnsupportedSocketOperationError);
+    QSKIP("Port sharing between servers is not supported on this platform");
+#endif
+
+    // both servers need the option
+    QTcpServer exclusive;
+    QVERIFY(!exclusive.listen(QHostAddress::LocalHost, server.serverPort()));
+    QCOMPARE(exclusive.serverError(), QAbstractSocket::AddressInUseError);
+
+    QTcpServer server2;
+    server2.setReusePortEnabled(true);
+    QVERIFY2(server2.listen(QHostAddress::LocalHost, server.serverPort()),
+             qPrintable(server2.errorString()));
+
+    // the connections are spread by a hash of the client's address and
+    // port, so with this many clients each server gets some
+    constexpr int ClientCount = 32;
+    std::vector<std::unique_ptr<QTcpSocket>> clients;
+    for (int i = 0; i < ClientCount; ++i) {
+        clients.push_back(std::make_unique<QTcpSocket>());
+        clients.back()->connectToHost(QHostAddress::LocalHost, server.serverPort());
+    }
+
+    int accepted[2] = {};
+    const auto acceptAll = [&] {
+        QTcpServer *servers[] = { &server, &server2 };
+        for (int i = 0; i < 2; ++i) {
+            while (QTcpSocket *socket = servers[i]->nextPendingConnection()) {
+                ++accepted[i];
+                delete socket;
+            }
+        }
+        return accepted[0] + accepted[1] == ClientCount;
+    };
+    QTRY_VERIFY(acceptAll());
+    QCOMPARE_GT(accepted[0], 0);
+    QCOMPARE_GT(accepted[1], 0);
+}
+
 void tst_QTcpServer::linkLocal()
 {
     QFETCH_GLOBAL(bool, setProxy);
@@ -19,6 +19,7 @@
 
 #include <QTest>
 #include <QSignalSpy>
+#include <QTemporaryFile>
 #include <QAuthenticator>
 #include <QCoreApplication>
 #include <QEventLoop>
@@ -177,6 +178,7 @@ private slots:
     void socketDiscardDataInWriteMode();
     void writeOnReadBufferOverflow();
     void readNotificationsAfterBind();
+    void sendFile();
 
 protected slots:
     void nonBlockingIMAP_hostFound();
@@ -3217,5 +3219,63 @@ void tst_QTcpSocket::readNotificationsAfterBind()
     QCOMPARE(spyReadyRead.size(), 0);
 }
 
+void tst_QTcpSocket::sendFile()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QByteArray contents(1024 * 1024, Qt::Uninitialized);
+    for (qsizetype i = 0; i < contents.size(); ++i)
+        contents[i] = char(i * 7 + i / 1031);
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write(contents), contents.size());
+    QVERIFY(file.seek(10));
+
+    QTcpServer tcpServer;
+    QVERIFY(tcpServer.listen(QHostAddress::LocalHost));
+    QTcpSocket *socket = newSocket();
+    socket->connectToHost(tcpServer.serverAddress(), tcpServer.serverPort());
+    QVERIFY(socket->waitForConnected(5000));
+    QVERIFY2(tcpServer.waitForNewConnection(5000), "Network timeout");
+    std::unique_ptr<QTcpSocket> newConnection(tcpServer.nextPendingConnection());
+    QVERIFY(newConnection);
+
+    QByteArray received;
+    connect(newConnection.get(), &QIODevice::readyRead, this, [&] {
+        received += newConnection->readAll();
+    });
+    qint64 totalWritten = 0;
+    connect(socket, &QIODevice::bytesWritten, this, [&](qint64 written) {
+        totalWritten += written;
+    });
+
+    const qint64 offset = 100;
+    const qint64 size = contents.size() - 1000;
+    QCOMPARE(socket->write("head"), 4);
+    QCOMPARE(socket->sendFile(&file, offset, size), size);
+    QCOMPARE(file.pos(), 10);
+    QCOMPARE(socket->write("tail"), 4);
+    QCOMPARE(socket->sendFile(&file, contents.size() - 3), 3);
+    QCOMPARE(socket->bytesToWrite(), size + 11);
+    file.close();
+
+    const QByteArray expected = "head" + contents.mid(offset, size) + "tail"
+            + contents.right(3);
+    QTRY_COMPARE_WITH_TIMEOUT(received.size(), expected.size(), 10000);
+    QVERIFY(received == expected);
+    QCOMPARE(totalWritten, expected.size());
+    QCOMPARE(socket->bytesToWrite(), 0);
+
+    // out-of-range offsets and unreadable files are refused
+    QTest::ignoreMessage(QtWarningMsg, "QAbstractSocket::sendFile: file not open for reading");
+    QCOMPARE(socket->sendFile(&file), -1);
+    QVERIFY(file.open());
+    QCOMPARE(socket->sendFile(&file, contents.size() + 1), -1);
+
+    delete socket;
+}
+
 QTEST_MAIN(tst_QTcpSocket)
 #include "tst_qtcpsocket.moc"
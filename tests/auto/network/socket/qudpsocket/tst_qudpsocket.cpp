@@ -102,6 +102,7 @@ private slots:
     void linkLocalIPv4();
     void readyRead();
     void readyReadForEmptyDatagram();
+    void batchDatagrams();
     void asyncReadDatagram();
     void writeInHostLookupState();
 
@@ -1848,6 +1849,87 @@ void tst_QUdpSocket::readyReadForEmptyDatagram()
     QCOMPARE(receiver.readDatagram(buf, sizeof buf), qint64(0));
 }
 
+void tst_QUdpSocket::batchDatagrams()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QUdpSocket sender, receiver;
+    QVERIFY2(receiver.bind(QHostAddress(QHostAddress::LocalHost), 0), receiver.errorString().toLatin1());
+    const QHostAddress address = receiver.localAddress();
+    const quint16 port = receiver.localPort();
+
+    // runs of equally sized datagrams, which may be sent with segmentation
+    // offload, followed by shorter and empty ones
+    QList<QByteArray> payloads;
+    for (int i = 0; i < 40; ++i)
+        payloads << QByteArray(100, char('a' + i % 26));
+    payloads << QByteArray(30, 'x') << QByteArray() << QByteArray(7, 'y');
+    for (int i = 0; i < 20; ++i)
+        payloads << QByteArray(1000 + i, char('A' + i));
+
+    QList<QUdpSocket::BatchDatagram> outgoing;
+    for (const QByteArray &payload : std::as_const(payloads))
+        outgoing.append({ payload, address, port });
+
+    QSignalSpy bytesWrittenSpy(&sender, &QUdpSocket::bytesWritten);
+    qsizetype sent = 0;
+    while (sent < outgoing.size()) {
+        const qsizetype result = sender.writeDatagrams(QSpan(outgoing).subspan(sent));
+        QVERIFY2(result > 0, sender.errorString().toLatin1());
+        sent += result;
+    }
+    qint64 totalBytes = 0;
+    for (const QByteArray &payload : std::as_const(payloads))
+        totalBytes += payload.size();
+    qint64 bytesWritten = 0;
+    for (const QList<QVariant> &arguments : std::as_const(bytesWrittenSpy))
+        bytesWritten += arguments.at(0).toLongLong();
+    QCOMPARE(bytesWritten, totalBytes);
+
+    QByteArray buffer(16 * 2048, Qt::Uninitialized);
+    std::array<QUdpSocket::BatchDatagram, 16> incoming;
+    qsizetype received = 0;
+    while (received < payloads.size()) {
+        if (!receiver.hasPendingDatagrams())
+            QVERIFY(receiver.waitForReadyRead(5000));
+        const qsizetype count = receiver.readDatagrams(buffer, incoming);
+        QVERIFY2(count >= 0, receiver.errorString().toLatin1());
+        for (qsizetype i = 0; i < count; ++i) {
+            QCOMPARE(incoming[i].data.toByteArray(), payloads.at(received + i));
+            QCOMPARE(incoming[i].address, address);
+            QCOMPARE(incoming[i].port, sender.localPort());
+        }
+        received += count;
+    }
+    QCOMPARE(receiver.readDatagrams(buffer, incoming), qsizetype(0));
+
+    // a datagram longer than its slot is truncated
+    QVERIFY(sender.writeDatagram(QByteArray(100, 'z'), address, port) == 100);
+    QVERIFY(receiver.waitForReadyRead(5000));
+    QCOMPARE(receiver.readDatagrams(QSpan(buffer).first(64), incoming), qsizetype(1));
+    QCOMPARE(incoming[0].data.toByteArray(), QByteArray(4, 'z'));
+
+    // a connected socket sends to its peer when the port is 0
+    QUdpSocket connected;
+    connected.connectToHost(address, port);
+    QVERIFY(connected.waitForConnected(5000));
+    const QUdpSocket::BatchDatagram toPeer[] = { { "one" }, { "two" } };
+    QCOMPARE(connected.writeDatagrams(toPeer), qsizetype(2));
+    received = 0;
+    while (received < 2) {
+        if (!receiver.hasPendingDatagrams())
+            QVERIFY(receiver.waitForReadyRead(5000));
+        const qsizetype count = receiver.readDatagrams(buffer, QSpan(incoming).subspan(received));
+        QVERIFY(count >= 0);
+        received += count;
+    }
+    QCOMPARE(incoming[0].data.toByteArray(), QByteArray("one"));
+    QCOMPARE(incoming[1].data.toByteArray(), QByteArray("two"));
+    QCOMPARE(incoming[0].port, connected.localPort());
+}
+
 void tst_QUdpSocket::async_readDatagramSlot()
 {
     char buf[1];
@@ -145,6 +145,10 @@ private slots:
     void psql_bindWithDoubleColonCastOperator();
     void psql_specialFloatValues_data() { generic_data("QPSQL"); }
     void psql_specialFloatValues();
+    void psql_copyFromStdin_data() { generic_data("QPSQL"); }
+    void psql_copyFromStdin();
+    void psql_execBatchFailingRow_data() { generic_data("QPSQL"); }
+    void psql_execBatchFailingRow();
     void queryOnInvalidDatabase_data() { generic_data(); }
     void queryOnInvalidDatabase();
     void createQueryOnClosedDatabase_data() { generic_data(); }
@@ -225,6 +229,10 @@ private slots:
     void sqlite_constraint_data() { generic_data("QSQLITE"); }
     void sqlite_constraint();
 
+    void sqlite_execBatchTransaction_data() { generic_data("QSQLITE"); }
+    void sqlite_execBatchTransaction();
+    void sqlite_statementReuse_data() { generic_data("QSQLITE"); }
+    void sqlite_statementReuse();
     void sqlite_real_data() { generic_data("QSQLITE"); }
     void sqlite_real();
 
@@ -2901,6 +2909,98 @@ void tst_QSqlQuery::psql_specialFloatValues()
     }
 }
 
+void tst_QSqlQuery::psql_copyFromStdin()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    QSqlQuery q(db);
+    TableScope ts(db, "copytest", __FILE__);
+    QVERIFY_SQL(q, exec(QLatin1String("create table %1 (id int, txt varchar(20), bin bytea)")
+                        .arg(ts.tableName())));
+    QVERIFY_SQL(q, prepare(QLatin1String("copy %1 (id, txt, bin) from stdin")
+                           .arg(ts.tableName())));
+
+    const QVariantList ids = { 1, 2, 3 };
+    const QVariantList texts = { u"plain"_s, u"tab\tand\nnewline \\"_s,
+                                 QVariant(QMetaType::fromType<QString>()) };
+    const QVariantList blobs = { QByteArray("\0\x01\\", 3), QByteArray(), QByteArray("x") };
+    q.addBindValue(ids);
+    q.addBindValue(texts);
+    q.addBindValue(blobs);
+    QVERIFY_SQL(q, execBatch());
+    QCOMPARE(q.numRowsAffected(), 3);
+
+    // a single row from plain bound values
+    q.addBindValue(4);
+    q.addBindValue(u"four"_s);
+    q.addBindValue(QByteArray("4"));
+    QVERIFY_SQL(q, exec());
+
+    QVERIFY_SQL(q, exec(QLatin1String("select id, txt, bin from %1 order by id")
+                        .arg(ts.tableName())));
+    for (int i = 0; i < 3; ++i) {
+        QVERIFY(q.next());
+        QCOMPARE(q.value(0).toInt(), ids.at(i).toInt());
+        QCOMPARE(q.value(1).isNull(), texts.at(i).isNull());
+        QCOMPARE(q.value(1).toString(), texts.at(i).toString());
+        QCOMPARE(q.value(2).toByteArray(), blobs.at(i).toByteArray());
+    }
+    QVERIFY(q.next());
+    QCOMPARE(q.value(1).toString(), u"four");
+    QVERIFY(!q.next());
+}
+
+void tst_QSqlQuery::psql_execBatchFailingRow()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    QSqlQuery q(db);
+    TableScope ts(db, "batchfail", __FILE__);
+    QVERIFY_SQL(q, exec(QLatin1String("create table %1 (id int primary key)")
+                        .arg(ts.tableName())));
+    QVERIFY_SQL(q, prepare(QLatin1String("insert into %1 (id) values (?)")
+                           .arg(ts.tableName())));
+
+    // The batch runs in one transaction: a duplicate key in the middle
+    // stores none of the rows, however many rows are sent at once.
+    QVariantList ids;
+    for (int i = 0; i < 1000; ++i)
+        ids << i;
+    ids[500] = 499;
+    q.addBindValue(ids);
+    QVERIFY(!q.execBatch());
+
+    QSqlQuery count(db);
+    QVERIFY_SQL(count, exec(QLatin1String("select count(*) from %1").arg(ts.tableName())));
+    QVERIFY(count.next());
+    QCOMPARE(count.value(0).toInt(), 0);
+
+    // the connection is usable again, and a batch without errors is stored
+    ids[500] = 500;
+    q.addBindValue(ids);
+    QVERIFY_SQL(q, execBatch());
+    QVERIFY_SQL(count, exec(QLatin1String("select count(*) from %1").arg(ts.tableName())));
+    QVERIFY(count.next());
+    QCOMPARE(count.value(0).toInt(), 1000);
+
+    // inside a transaction, the failing row aborts that transaction
+    QVERIFY_SQL(q, exec(QLatin1String("delete from %1").arg(ts.tableName())));
+    QVERIFY_SQL(q, prepare(QLatin1String("insert into %1 (id) values (?)")
+                           .arg(ts.tableName())));
+    QVERIFY(db.transaction());
+    ids[500] = 499;
+    q.addBindValue(ids);
+    QVERIFY(!q.execBatch());
+    QVERIFY(db.rollback());
+    QVERIFY_SQL(count, exec(QLatin1String("select count(*) from %1").arg(ts.tableName())));
+    QVERIFY(count.next());
+    QCOMPARE(count.value(0).toInt(), 0);
+}
+
 /* For task 157397: Using QSqlQuery with an invalid QSqlDatabase
    does not set the last error of the query.
    This test function will output some warnings, that's ok.
@@ -4268,6 +4368,97 @@ void tst_QSqlQuery::sqlite_constraint()
     QCOMPARE(q.lastError().databaseText(), QLatin1String("Raised Abort successfully"));
 }
 
+void tst_QSqlQuery::sqlite_execBatchTransaction()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    TableScope ts(db, "sqlitebatch", __FILE__);
+
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec(QLatin1String("CREATE TABLE %1 (id INTEGER PRIMARY KEY, name TEXT)")
+                        .arg(ts.tableName())));
+    QVERIFY_SQL(q, prepare(QLatin1String("INSERT INTO %1 (id, name) VALUES (?, ?)")
+                           .arg(ts.tableName())));
+
+    // the rows of a failing batch are all rolled back
+    q.addBindValue(QVariantList{ 1, 2, 1 });
+    q.addBindValue(QVariantList{ u"a"_s, u"b"_s, u"c"_s });
+    QVERIFY(!q.execBatch());
+    QVERIFY(q.lastError().isValid());
+
+    QSqlQuery count(db);
+    QVERIFY_SQL(count, exec("SELECT COUNT(*) FROM " + ts.tableName()));
+    QVERIFY(count.next());
+    QCOMPARE(count.value(0).toInt(), 0);
+
+    // but not the ones of an enclosing transaction
+    QVERIFY_SQL(db, transaction());
+    QVERIFY_SQL(q, exec("INSERT INTO " + ts.tableName() + " VALUES (10, 'x')"));
+    QVERIFY_SQL(q, prepare(QLatin1String("INSERT INTO %1 (id, name) VALUES (:id, :name)")
+                           .arg(ts.tableName())));
+    q.bindValue(":id", QVariantList{ 1, 2, 3 });
+    q.bindValue(":name", QVariantList{ u"a"_s, u"b"_s, QVariant(QMetaType::fromType<QString>()) });
+    QVERIFY_SQL(q, execBatch());
+    QVERIFY_SQL(db, commit());
+
+    QVERIFY_SQL(q, exec("SELECT id, name FROM " + ts.tableName() + " ORDER BY id"));
+    QVERIFY(q.next());
+    QCOMPARE(q.value(0).toInt(), 1);
+    QCOMPARE(q.value(1).toString(), u"a");
+    QVERIFY(q.next());
+    QVERIFY(q.next());
+    QCOMPARE(q.value(0).toInt(), 3);
+    QVERIFY(q.value(1).isNull());
+    QVERIFY(q.next());
+    QCOMPARE(q.value(0).toInt(), 10);
+    QVERIFY(!q.next());
+}
+
+// the driver keeps the statements of finished queries for later queries
+// with the same text
+void tst_QSqlQuery::sqlite_statementReuse()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    TableScope ts(db, "sqlitereuse", __FILE__);
+
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec(QLatin1String("CREATE TABLE %1 (id INTEGER)").arg(ts.tableName())));
+    QVERIFY_SQL(q, exec(QLatin1String("INSERT INTO %1 VALUES (1), (2)").arg(ts.tableName())));
+
+    const QString select = "SELECT * FROM " + ts.tableName() + " WHERE id >= ?";
+    QVariant handle;
+    {
+        QSqlQuery first(db);
+        QVERIFY_SQL(first, prepare(select));
+        first.addBindValue(2);
+        QVERIFY_SQL(first, exec());
+        QVERIFY(first.next());
+        QCOMPARE(first.value(0).toInt(), 2);
+        handle = first.result()->handle();
+    }
+
+    // a reused statement has no results left over
+    QSqlQuery second(db);
+    QVERIFY_SQL(second, prepare(select));
+    QCOMPARE(second.result()->handle(), handle);
+    second.addBindValue(1);
+    QVERIFY_SQL(second, exec());
+    QVERIFY(second.next());
+    QCOMPARE(second.value(0).toInt(), 1);
+
+    // the statement picks up schema changes
+    QVERIFY_SQL(q, exec(QLatin1String("ALTER TABLE %1 ADD COLUMN name TEXT")
+                        .arg(ts.tableName())));
+    QSqlQuery third(db);
+    QVERIFY_SQL(third, prepare(select));
+    third.addBindValue(2);
+    QVERIFY_SQL(third, exec());
+    QCOMPARE(third.record().count(), 2);
+}
+
 void tst_QSqlQuery::sqlite_real()
 {
     QFETCH(QString, dbName);
@@ -3,9 +3,12 @@
 
 #include <QTest>
 #include <QVariantMap>
+#include <qjsonarray.h>
 #include <qjsondocument.h>
 #include <qjsonobject.h>
 
+using namespace Qt::StringLiterals;
+
 class BenchmarkQtJson: public QObject
 {
     Q_OBJECT
@@ -21,6 +24,8 @@ private Q_SLOTS:
     void parseNumbers();
     void parseJson();
     void parseJsonToVariant();
+    void parseLargeDocument_data();
+    void parseLargeDocument();
 
     void jsonObjectInsert();
     void variantMapInsert();
@@ -93,6 +98,52 @@ void BenchmarkQtJson::parseJsonToVariant()
     }
 }
 
+void BenchmarkQtJson::parseLargeDocument_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    // about 8 MB each, large enough for the scanning of string bodies and
+    // whitespace to dominate over the creation of the values
+    constexpr int Records = 40000;
+    QJsonArray ascii, unicode, escaped, numbers;
+    for (int i = 0; i < Records; ++i) {
+        const QString n = QString::number(i);
+        ascii.append(QJsonObject{
+            { "id", i },
+            { "name", "record number " + n },
+            { "description", QString("The quick brown fox jumps over the lazy dog. ").repeated(3) },
+        });
+        unicode.append(QJsonObject{
+            { "id", i },
+            { "name", u"enregistrement numéro "_s + n },
+            { "description", u"Größere Änderungen für Ångström, 日本語のテキスト. "_s.repeated(3) },
+        });
+        escaped.append(QJsonObject{
+            { "id", i },
+            { "path", "C:\\Program Files\\App\\" + n },
+            { "text", QString("line one\nline \"two\"\tand\tthree\n").repeated(3) },
+        });
+        numbers.append(QJsonArray{ i, -i * 7919, i * 0.25, i * 1.0e-7, 6.02214076e23 / (i + 1) });
+    }
+
+    QTest::newRow("ascii") << QJsonDocument(ascii).toJson(QJsonDocument::Compact);
+    QTest::newRow("ascii-indented") << QJsonDocument(ascii).toJson(QJsonDocument::Indented);
+    QTest::newRow("unicode") << QJsonDocument(unicode).toJson(QJsonDocument::Compact);
+    QTest::newRow("escaped") << QJsonDocument(escaped).toJson(QJsonDocument::Compact);
+    QTest::newRow("numbers") << QJsonDocument(numbers).toJson(QJsonDocument::Compact);
+}
+
+void BenchmarkQtJson::parseLargeDocument()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        QJsonParseError error;
+        QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+        QCOMPARE(error.error, QJsonParseError::NoError);
+    }
+}
+
 void BenchmarkQtJson::jsonObjectInsert()
 {
     QJsonObject object;
@@ -13,6 +13,31 @@ private slots:
 
     void event_posting_multiple_objects_benchmark_data();
     void event_posting_multiple_objects_benchmark();
+
+    void queued_signals_from_threads_data();
+    void queued_signals_from_threads();
+};
+
+class Sender : public QObject
+{
+    Q_OBJECT
+signals:
+    void ping();
+};
+
+class Receiver : public QObject
+{
+    Q_OBJECT
+public:
+    QEventLoop loop;
+    int count = 0;
+    int expected = 0;
+public slots:
+    void pong()
+    {
+        if (++count == expected)
+            loop.quit();
+    }
 };
 
 void tst_QCoreApplication::event_posting_benchmark_data()
@@ -65,6 +90,43 @@ void tst_QCoreApplication::event_posting_multiple_objects_benchmark()
     }
 }
 
+void tst_QCoreApplication::queued_signals_from_threads_data()
+{
+    QTest::addColumn<int>("producers");
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+// many threads emitting signals connected to an object in the main thread
+void tst_QCoreApplication::queued_signals_from_threads()
+{
+    QFETCH(int, producers);
+    constexpr int SignalsPerThread = 10000;
+
+    Receiver receiver;
+    const auto emitSignals = [&receiver] {
+        Sender sender;
+        QObject::connect(&sender, &Sender::ping, &receiver, &Receiver::pong, Qt::QueuedConnection);
+        for (int i = 0; i < SignalsPerThread; ++i)
+            emit sender.ping();
+    };
+
+    QBENCHMARK {
+        receiver.count = 0;
+        receiver.expected = producers * SignalsPerThread;
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (int i = 0; i < producers; ++i)
+            threads.emplace_back(QThread::create(emitSignals));
+        for (const auto &thread : threads)
+            thread->start();
+        receiver.loop.exec();
+        for (const auto &thread : threads)
+            thread->wait();
+    }
+}
+
 QTEST_MAIN(tst_QCoreApplication)
 
 #include "tst_bench_qcoreapplication.moc"
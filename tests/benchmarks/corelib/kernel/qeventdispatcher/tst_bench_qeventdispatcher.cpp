@@ -0,0 +1,145 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QScopeGuard>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QThread>
+
+#include <private/qeventdispatcher_unix_p.h>
+#if QT_CONFIG(epoll)
+#  include <private/qeventdispatcher_epoll_p.h>
+#endif
+#if QT_CONFIG(io_uring)
+#  include <private/qeventdispatcher_io_uring_p.h>
+#endif
+
+#include <qtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class tst_QEventDispatcher : public QObject
+{
+    Q_OBJECT
+public:
+    enum Backend { Poll, Epoll, IoUring };
+    Q_ENUM(Backend)
+
+private slots:
+    void initTestCase();
+    void socketNotifierWakeUp_data();
+    void socketNotifierWakeUp();
+};
+
+void tst_QEventDispatcher::initTestCase()
+{
+    // every notifier needs a socket pair
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+void tst_QEventDispatcher::socketNotifierWakeUp_data()
+{
+    QTest::addColumn<Backend>("backend");
+    QTest::addColumn<int>("notifierCount");
+
+    for (int count : { 1, 10, 100, 1000, 10000 }) {
+        QTest::addRow("poll-%d", count) << Poll << count;
+#if QT_CONFIG(epoll)
+        QTest::addRow("epoll-%d", count) << Epoll << count;
+#endif
+#if QT_CONFIG(io_uring)
+        if (QEventDispatcherIoUring::isSupported())
+            QTest::addRow("io_uring-%d", count) << IoUring << count;
+#endif
+    }
+}
+
+// Measures the round trip of making one out of notifierCount sockets readable
+// and having the event loop of another thread deliver its notifier.
+void tst_QEventDispatcher::socketNotifierWakeUp()
+{
+    QFETCH(Backend, backend);
+    QFETCH(int, notifierCount);
+
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < rlim_t(2 * notifierCount + 64))
+        QSKIP("Not enough file descriptors available");
+
+    QThread thread;
+    switch (backend) {
+    case Poll:
+        thread.setEventDispatcher(new QEventDispatcherUNIX);
+        break;
+    case Epoll:
+#if QT_CONFIG(epoll)
+        thread.setEventDispatcher(new QEventDispatcherEpoll);
+#endif
+        break;
+    case IoUring:
+#if QT_CONFIG(io_uring)
+        thread.setEventDispatcher(new QEventDispatcherIoUring);
+#endif
+        break;
+    }
+    thread.start();
+
+    QSemaphore activations;
+    std::vector<std::unique_ptr<QSocketNotifier>> notifiers;
+    QObject context;
+    context.moveToThread(&thread);
+
+    std::vector<std::array<int, 2>> pairs;
+    const auto cleanup = qScopeGuard([&] {
+        // notifiers must be destroyed in the thread they live in
+        QMetaObject::invokeMethod(&context, [&] {
+            notifiers.clear();
+        }, Qt::BlockingQueuedConnection);
+        thread.quit();
+        thread.wait();
+
+        for (const auto &fds : pairs) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+    });
+
+    for (int i = 0; i < notifierCount; ++i) {
+        std::array<int, 2> fds;
+        QVERIFY2(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()) == 0, qPrintable(qt_error_string()));
+        pairs.push_back(fds);
+    }
+
+    QMetaObject::invokeMethod(&context, [&] {
+        for (const auto &fds : pairs) {
+            auto notifier = std::make_unique<QSocketNotifier>(fds[0], QSocketNotifier::Read);
+            connect(notifier.get(), &QSocketNotifier::activated, notifier.get(),
+                    [&activations](QSocketDescriptor socket) {
+                char c;
+                if (::read(socket, &c, 1) == 1)
+                    activations.release();
+            });
+            notifiers.push_back(std::move(notifier));
+        }
+    }, Qt::BlockingQueuedConnection);
+
+    size_t next = 0;
+    QBENCHMARK {
+        const int fd = pairs[next++ % pairs.size()][1];
+        QCOMPARE(::write(fd, "x", 1), 1);
+        activations.acquire();
+    }
+}
+
+QTEST_MAIN(tst_QEventDispatcher)
+
+#include "tst_bench_qeventdispatcher.moc"
@@ -0,0 +1,118 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QObject>
+
+#include <private/qtimerinfo_unix_p.h>
+
+#include <qtest.h>
+
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class tst_QTimerInfoList : public QObject
+{
+    Q_OBJECT
+private slots:
+    void registerAndUnregister_data() { populate(); }
+    void registerAndUnregister();
+    void restart_data() { populate(); }
+    void restart();
+    void unregisterObject_data() { populate(); }
+    void unregisterObject();
+    void remainingTime_data() { populate(); }
+    void remainingTime();
+
+private:
+    void populate();
+};
+
+// Timers that never expire during the benchmark, spread over a range of
+// intervals so that they are not all in the same place in the list.
+static void fill(QTimerInfoList &list, std::vector<QObject> &objects)
+{
+    for (size_t i = 0; i < objects.size(); ++i) {
+        list.registerTimer(Qt::TimerId(i + 1), 1h + std::chrono::milliseconds(i * 7919 % 100000),
+                           Qt::PreciseTimer, &objects[i]);
+    }
+}
+
+void tst_QTimerInfoList::populate()
+{
+    QTest::addColumn<int>("timerCount");
+
+    for (int count : { 10, 100, 1000, 10000, 100000 })
+        QTest::addRow("%d", count) << count;
+}
+
+// a QTimer that is started and stopped while many others are running
+void tst_QTimerInfoList::registerAndUnregister()
+{
+    QFETCH(int, timerCount);
+    QTimerInfoList list;
+    std::vector<QObject> objects(timerCount);
+    fill(list, objects);
+
+    QObject object;
+    const Qt::TimerId id = Qt::TimerId(timerCount + 1);
+    QBENCHMARK {
+        list.registerTimer(id, 1h + 50s, Qt::PreciseTimer, &object);
+        list.unregisterTimer(id);
+    }
+    list.clearTimers();
+}
+
+// QTimer::start() on a running timer, e.g. resetting an idle timeout
+void tst_QTimerInfoList::restart()
+{
+    QFETCH(int, timerCount);
+    QTimerInfoList list;
+    std::vector<QObject> objects(timerCount);
+    fill(list, objects);
+
+    size_t next = 0;
+    QBENCHMARK {
+        const size_t i = next++ % objects.size();
+        const Qt::TimerId id = Qt::TimerId(i + 1);
+        list.unregisterTimer(id);
+        list.registerTimer(id, 1h + 50s, Qt::PreciseTimer, &objects[i]);
+    }
+    list.clearTimers();
+}
+
+// what happens when an object with a running timer is destroyed
+void tst_QTimerInfoList::unregisterObject()
+{
+    QFETCH(int, timerCount);
+    QTimerInfoList list;
+    std::vector<QObject> objects(timerCount);
+    fill(list, objects);
+
+    size_t next = 0;
+    QBENCHMARK {
+        const size_t i = next++ % objects.size();
+        list.unregisterTimers(&objects[i]);
+        list.registerTimer(Qt::TimerId(i + 1), 1h + 50s, Qt::PreciseTimer, &objects[i]);
+    }
+    list.clearTimers();
+}
+
+void tst_QTimerInfoList::remainingTime()
+{
+    QFETCH(int, timerCount);
+    QTimerInfoList list;
+    std::vector<QObject> objects(timerCount);
+    fill(list, objects);
+
+    size_t next = 0;
+    QBENCHMARK {
+        const Qt::TimerId id = Qt::TimerId(next++ % objects.size() + 1);
+        [[maybe_unused]] auto remaining = list.remainingDuration(id);
+    }
+    list.clearTimers();
+}
+
+QTEST_MAIN(tst_QTimerInfoList)
+
+#include "tst_bench_qtimerinfolist.moc"
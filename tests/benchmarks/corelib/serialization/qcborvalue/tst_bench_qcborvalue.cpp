@@ -1,8 +1,11 @@
 // Copyright (C) 2023 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
+#include <QCborArray>
 #include <QCborMap>
 #include <QCborValue>
+#include <QJsonDocument>
+#include <QJsonValue>
 
 #include <QTest>
 
@@ -42,6 +45,8 @@ private:
     template <typename Type>
     void doConstruct();
 
+    static QCborValue manySmallMaps();
+
 private slots:
     void keyLookupLatin1() { doKeyLookup<QLatin1StringView>(); }
     void keyLookupString() { doKeyLookup<QString>(); }
@@ -51,8 +56,61 @@ private slots:
     void constructString() { doConstruct<QString>(); }
     void constructStringView() { doConstruct<QStringView>(); }
     void constructConstCharPtr() { doConstruct<char>(); }
+
+    void fromCbor_data();
+    void fromCbor();
+    void fromJson_data();
+    void fromJson();
 };
 
+QCborValue tst_QCborValue::manySmallMaps()
+{
+    QCborArray array;
+    for (int i = 0; i < 10000; ++i) {
+        array.append(QCborMap{ { "id", i },
+                               { "name", QString("Item %1").arg(i) },
+                               { "tags", QCborArray{ "a", "b", i * 0.5 } } });
+    }
+    return array;
+}
+
+void tst_QCborValue::fromCbor_data()
+{
+    QTest::addColumn<bool>("useArena");
+
+    QTest::newRow("heap") << false;
+    QTest::newRow("arena") << true;
+}
+
+void tst_QCborValue::fromCbor()
+{
+    QFETCH(bool, useArena);
+
+    const QByteArray data = manySmallMaps().toCbor();
+    const QCborValue::DecodingOptions options =
+            useArena ? QCborValue::DecodingOption::UseArena : QCborValue::DecodingOptions();
+    QBENCHMARK {
+        [[maybe_unused]] const QCborValue v = QCborValue::fromCbor(data, options);
+    }
+}
+
+void tst_QCborValue::fromJson_data()
+{
+    fromCbor_data();
+}
+
+void tst_QCborValue::fromJson()
+{
+    QFETCH(bool, useArena);
+
+    const QByteArray json = manySmallMaps().toJsonValue().toJson();
+    const QJsonDocument::ParseOptions options =
+            useArena ? QJsonDocument::ParseOption::UseArena : QJsonDocument::ParseOptions();
+    QBENCHMARK {
+        [[maybe_unused]] const QJsonDocument doc = QJsonDocument::fromJson(json, options);
+    }
+}
+
 template <typename Type>
 void tst_QCborValue::doKeyLookup()
 {
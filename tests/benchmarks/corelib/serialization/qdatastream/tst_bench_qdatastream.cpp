@@ -0,0 +1,130 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QDataStream>
+#include <QList>
+#include <QPointF>
+#include <QSpan>
+
+#include <QTest>
+
+#include <vector>
+
+class tst_QDataStream : public QObject
+{
+    Q_OBJECT
+private:
+    template <typename T>
+    void doWriteList(const T &value);
+    template <typename T>
+    void doReadList(const T &value);
+
+private slots:
+    void byteOrder_data();
+
+    void writeListInt_data() { byteOrder_data(); }
+    void writeListInt() { doWriteList(42); }
+    void writeListDouble_data() { byteOrder_data(); }
+    void writeListDouble() { doWriteList(0.5); }
+    void writeListPointF_data() { byteOrder_data(); }
+    void writeListPointF() { doWriteList(QPointF(1, 2)); }
+    void writeListString_data() { byteOrder_data(); }
+    void writeListString() { doWriteList(QStringLiteral("x")); }
+
+    void readListInt_data() { byteOrder_data(); }
+    void readListInt() { doReadList(42); }
+    void readListDouble_data() { byteOrder_data(); }
+    void readListDouble() { doReadList(0.5); }
+    void readListPointF_data() { byteOrder_data(); }
+    void readListPointF() { doReadList(QPointF(1, 2)); }
+
+    void writeRawSpan_data() { byteOrder_data(); }
+    void writeRawSpan();
+    void readRawSpan_data() { byteOrder_data(); }
+    void readRawSpan();
+};
+
+static constexpr qsizetype ElementCount = 1024 * 1024;
+
+void tst_QDataStream::byteOrder_data()
+{
+    QTest::addColumn<QDataStream::ByteOrder>("byteOrder");
+
+    QTest::newRow("big-endian") << QDataStream::BigEndian;
+    QTest::newRow("little-endian") << QDataStream::LittleEndian;
+}
+
+template <typename T>
+void tst_QDataStream::doWriteList(const T &value)
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    const QList<T> list(ElementCount, value);
+    QByteArray data;
+    data.reserve(ElementCount * qsizetype(sizeof(T)) + 16);
+    QBENCHMARK {
+        data.clear();
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(byteOrder);
+        stream << list;
+    }
+}
+
+template <typename T>
+void tst_QDataStream::doReadList(const T &value)
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(byteOrder);
+        stream << QList<T>(ElementCount, value);
+    }
+
+    QList<T> list;
+    QBENCHMARK {
+        QDataStream stream(data);
+        stream.setByteOrder(byteOrder);
+        stream >> list;
+    }
+    QCOMPARE(list.size(), ElementCount);
+}
+
+void tst_QDataStream::writeRawSpan()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    const std::vector<double> values(ElementCount, 0.5);
+    QByteArray data;
+    data.reserve(ElementCount * qsizetype(sizeof(double)));
+    QBENCHMARK {
+        data.clear();
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(byteOrder);
+        stream.writeRawSpan(QSpan(values));
+    }
+}
+
+void tst_QDataStream::readRawSpan()
+{
+    QFETCH(QDataStream::ByteOrder, byteOrder);
+
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(byteOrder);
+        stream.writeRawSpan(QSpan(std::vector<double>(ElementCount, 0.5)));
+    }
+
+    std::vector<double> values(ElementCount);
+    QBENCHMARK {
+        QDataStream stream(data);
+        stream.setByteOrder(byteOrder);
+        stream.readRawSpan(QSpan(values));
+    }
+}
+
+QTEST_MAIN(tst_QDataStream)
+
+#include "tst_bench_qdatastream.moc"
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QBuffer>
+#include <QXmlStreamReader>
+
+#include <QTest>
+
+class tst_QXmlStreamReader : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+
+    void readFromByteArray_data();
+    void readFromByteArray();
+    void readFromDevice_data() { readFromByteArray_data(); }
+    void readFromDevice();
+
+private:
+    QByteArray textHeavy;
+    QByteArray attributeHeavy;
+    QByteArray nonAscii;
+};
+
+void tst_QXmlStreamReader::initTestCase()
+{
+    // roughly 10 MB each
+    textHeavy = "<?xml version=\"1.0\"?>\n<feed>\n";
+    attributeHeavy = textHeavy;
+    nonAscii = textHeavy;
+    for (int i = 0; i < 50000; ++i) {
+        const QByteArray n = QByteArray::number(i);
+        textHeavy += "  <entry><title>Entry " + n + "</title><summary>Lorem ipsum dolor sit amet, "
+                     "consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et "
+                     "dolore magna aliqua &amp; more.</summary></entry>\n";
+        attributeHeavy += "  <row id=\"" + n + "\" name=\"Row number " + n
+                          + "\" description=\"A somewhat longer attribute value for row " + n
+                          + "\" status='active' owner=\"nobody@example.com\"/>\n";
+        nonAscii += "  <p lang=\"el\">Ελληνικά κείμενα και résumé " + n
+                    + " — καλημέρα κόσμε, Grüße aus Köln.</p>\n";
+    }
+    textHeavy += "</feed>\n";
+    attributeHeavy += "</feed>\n";
+    nonAscii += "</feed>\n";
+}
+
+void tst_QXmlStreamReader::readFromByteArray_data()
+{
+    QTest::addColumn<QByteArray>("xml");
+
+    QTest::newRow("text") << textHeavy;
+    QTest::newRow("attributes") << attributeHeavy;
+    QTest::newRow("non-ascii") << nonAscii;
+}
+
+void tst_QXmlStreamReader::readFromByteArray()
+{
+    QFETCH(QByteArray, xml);
+
+    QBENCHMARK {
+        QXmlStreamReader reader(xml);
+        while (!reader.atEnd())
+            reader.readNext();
+        QVERIFY(!reader.hasError());
+    }
+}
+
+void tst_QXmlStreamReader::readFromDevice()
+{
+    QFETCH(QByteArray, xml);
+
+    QBENCHMARK {
+        QBuffer buffer(&xml);
+        buffer.open(QIODevice::ReadOnly);
+        QXmlStreamReader reader(&buffer);
+        while (!reader.atEnd())
+            reader.readNext();
+        QVERIFY(!reader.hasError());
+    }
+}
+
+QTEST_MAIN(tst_QXmlStreamReader)
+
+#include "tst_bench_qxmlstreamreader.moc"
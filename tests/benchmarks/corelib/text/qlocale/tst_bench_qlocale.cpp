@@ -4,6 +4,8 @@
 #include <QLocale>
 #include <QTest>
 
+#include <random>
+
 using namespace Qt::StringLiterals;
 
 class tst_QLocale : public QObject
@@ -37,6 +39,10 @@ private Q_SLOTS:
     void toULongLong();
     void toDouble_data();
     void toDouble();
+    void doubleToString_data();
+    void doubleToString();
+    void stringToDouble_data();
+    void stringToDouble();
 };
 
 static QString data()
@@ -583,6 +589,113 @@ void tst_QLocale::toDouble()
     QCOMPARE(actual, expected);
 }
 
+// Doubles as found in measurement data: a mix of short decimals and values
+// that need all 17 digits
+static QList<double> sampleDoubles()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    QList<double> values;
+    values.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        const double d = dist(rng);
+        values.append(i % 2 ? d : std::round(d * 100) / 100);
+    }
+    return values;
+}
+
+enum class NumberApi { QString, QByteArray, QLocaleC };
+Q_DECLARE_METATYPE(NumberApi)
+
+static void numberApi_data()
+{
+    QTest::addColumn<NumberApi>("api");
+    QTest::addColumn<char>("format");
+    QTest::addColumn<int>("precision");
+
+    constexpr int Shortest = QLocale::FloatingPointShortest;
+    QTest::newRow("QString: shortest") << NumberApi::QString << 'g' << Shortest;
+    QTest::newRow("QByteArray: shortest") << NumberApi::QByteArray << 'g' << Shortest;
+    QTest::newRow("QLocale::c: shortest") << NumberApi::QLocaleC << 'g' << Shortest;
+    QTest::newRow("QString: f6") << NumberApi::QString << 'f' << 6;
+    QTest::newRow("QByteArray: e17") << NumberApi::QByteArray << 'e' << 17;
+}
+
+void tst_QLocale::doubleToString_data()
+{
+    numberApi_data();
+}
+
+void tst_QLocale::doubleToString()
+{
+    QFETCH(NumberApi, api);
+    QFETCH(char, format);
+    QFETCH(int, precision);
+
+    const QList<double> values = sampleDoubles();
+    const QLocale c = QLocale::c();
+    qsizetype total = 0;
+    QBENCHMARK {
+        for (double d : values) {
+            switch (api) {
+            case NumberApi::QString:
+                total += QString::number(d, format, precision).size();
+                break;
+            case NumberApi::QByteArray:
+                total += QByteArray::number(d, format, precision).size();
+                break;
+            case NumberApi::QLocaleC:
+                total += c.toString(d, format, precision).size();
+                break;
+            }
+        }
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QLocale::stringToDouble_data()
+{
+    numberApi_data();
+}
+
+void tst_QLocale::stringToDouble()
+{
+    QFETCH(NumberApi, api);
+    QFETCH(char, format);
+    QFETCH(int, precision);
+
+    const QList<double> values = sampleDoubles();
+    QStringList strings;
+    QByteArrayList byteArrays;
+    for (double d : values) {
+        byteArrays.append(QByteArray::number(d, format, precision));
+        strings.append(QString::fromLatin1(byteArrays.last()));
+    }
+
+    const QLocale c = QLocale::c();
+    bool allOk = true;
+    double sum = 0;
+    QBENCHMARK {
+        for (qsizetype i = 0; i < strings.size(); ++i) {
+            bool ok = false;
+            switch (api) {
+            case NumberApi::QString:
+                sum += strings.at(i).toDouble(&ok);
+                break;
+            case NumberApi::QByteArray:
+                sum += byteArrays.at(i).toDouble(&ok);
+                break;
+            case NumberApi::QLocaleC:
+                sum += c.toDouble(strings.at(i), &ok);
+                break;
+            }
+            allOk = allOk && ok;
+        }
+    }
+    QVERIFY(allOk);
+    Q_UNUSED(sum);
+}
+
 QTEST_MAIN(tst_QLocale)
 
 #include "tst_bench_qlocale.moc"
@@ -0,0 +1,114 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qstringconverter.h>
+#include <qtest.h>
+
+using namespace Qt::StringLiterals;
+
+class tst_QStringConverter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encode_data() { data(); }
+    void encode();
+    void decode_data() { data(); }
+    void decode();
+    void decodeChunksOperatorPlus_data() { data(); }
+    void decodeChunksOperatorPlus();
+    void decodeChunksAppendToBuffer_data() { data(); }
+    void decodeChunksAppendToBuffer();
+
+private:
+    void data();
+};
+
+void tst_QStringConverter::data()
+{
+    QTest::addColumn<QStringConverter::Encoding>("encoding");
+    QTest::addColumn<QString>("text");
+
+    const QString ascii = u"The quick brown fox jumps over the lazy dog. "_s.repeated(2000);
+    const QString cjk = u"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。"_s.repeated(2000);
+    const QString mixed = u"Status: ✅ done 🎉, next: 📞 call 😀 at 10:00. "_s.repeated(2000);
+
+    const struct {
+        const char *name;
+        QStringConverter::Encoding encoding;
+    } encodings[] = {
+        { "UTF-16LE", QStringConverter::Utf16LE },
+        { "UTF-16BE", QStringConverter::Utf16BE },
+        { "UTF-32LE", QStringConverter::Utf32LE },
+        { "UTF-32BE", QStringConverter::Utf32BE },
+    };
+    for (const auto &e : encodings) {
+        QTest::addRow("%s:ascii", e.name) << e.encoding << ascii;
+        QTest::addRow("%s:cjk", e.name) << e.encoding << cjk;
+        QTest::addRow("%s:mixed", e.name) << e.encoding << mixed;
+    }
+}
+
+void tst_QStringConverter::encode()
+{
+    QFETCH(QStringConverter::Encoding, encoding);
+    QFETCH(QString, text);
+
+    QStringEncoder encoder(encoding);
+    QByteArray result;
+    QBENCHMARK {
+        result = encoder.encode(text);
+    }
+    QVERIFY(!encoder.hasError());
+}
+
+void tst_QStringConverter::decode()
+{
+    QFETCH(QStringConverter::Encoding, encoding);
+    QFETCH(QString, text);
+
+    const QByteArray encoded = QStringEncoder(encoding).encode(text);
+    QStringDecoder decoder(encoding);
+    QString result;
+    QBENCHMARK {
+        result = decoder.decode(encoded);
+    }
+    QVERIFY(!decoder.hasError());
+    QCOMPARE(result, text);
+}
+
+static constexpr qsizetype ChunkSize = 509;     // odd, so characters get split
+
+void tst_QStringConverter::decodeChunksOperatorPlus()
+{
+    QFETCH(QStringConverter::Encoding, encoding);
+    QFETCH(QString, text);
+
+    const QByteArray encoded = QStringEncoder(encoding).encode(text);
+    QStringDecoder decoder(encoding);
+    QBENCHMARK {
+        QString result;
+        for (qsizetype i = 0; i < encoded.size(); i += ChunkSize)
+            result += QString(decoder.decode(QByteArrayView(encoded).sliced(i).first(qMin(ChunkSize, encoded.size() - i))));
+    }
+    QVERIFY(!decoder.hasError());
+}
+
+void tst_QStringConverter::decodeChunksAppendToBuffer()
+{
+    QFETCH(QStringConverter::Encoding, encoding);
+    QFETCH(QString, text);
+
+    const QByteArray encoded = QStringEncoder(encoding).encode(text);
+    QStringDecoder decoder(encoding);
+    QBENCHMARK {
+        QString result;
+        for (qsizetype i = 0; i < encoded.size(); i += ChunkSize)
+            decoder.appendToBuffer(result, QByteArrayView(encoded).sliced(i).first(qMin(ChunkSize, encoded.size() - i)));
+    }
+    QVERIFY(!decoder.hasError());
+}
+
+QTEST_MAIN(tst_QStringConverter)
+
+#include "tst_bench_qstringconverter.moc"
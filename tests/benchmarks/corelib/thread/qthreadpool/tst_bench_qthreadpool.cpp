@@ -15,6 +15,8 @@ public:
 private slots:
     void startRunnables();
     void activeThreadCount();
+    void startFromRunnables_data();
+    void startFromRunnables();
 };
 
 tst_QThreadPool::tst_QThreadPool()
@@ -50,6 +52,41 @@ void tst_QThreadPool::activeThreadCount()
     }
 }
 
+void tst_QThreadPool::startFromRunnables_data()
+{
+    QTest::addColumn<bool>("workStealing");
+
+    QTest::newRow("shared queue") << false;
+    QTest::newRow("work stealing") << true;
+}
+
+// Each runnable starts more of them, as divide-and-conquer algorithms do, so
+// all threads of the pool start runnables at the same time.
+static void spawn(QThreadPool *threadPool, QSemaphore *done, int depth)
+{
+    if (depth > 0) {
+        for (int i = 0; i < 8; ++i)
+            threadPool->start([=] { spawn(threadPool, done, depth - 1); });
+    }
+    done->release();
+}
+
+void tst_QThreadPool::startFromRunnables()
+{
+    QFETCH(bool, workStealing);
+
+    constexpr int Depth = 5;
+    constexpr int RunnableCount = 1 + 8 + 8 * 8 + 8 * 8 * 8 + 8 * 8 * 8 * 8 + 8 * 8 * 8 * 8 * 8;
+
+    QThreadPool threadPool;
+    threadPool.setWorkStealingEnabled(workStealing);
+    QSemaphore done;
+    QBENCHMARK {
+        threadPool.start([&] { spawn(&threadPool, &done, Depth); });
+        done.acquire(RunnableCount);
+    }
+}
+
 QTEST_MAIN(tst_QThreadPool)
 
 #include "tst_bench_qthreadpool.moc"
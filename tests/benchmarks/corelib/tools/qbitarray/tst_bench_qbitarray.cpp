@@ -0,0 +1,133 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QBitArray>
+#include <QRandomGenerator>
+
+class tst_QBitArray : public QObject
+{
+    Q_OBJECT
+private slots:
+    void bitwiseAnd_data() { data(); }
+    void bitwiseAnd();
+    void bitwiseOrInPlace_data() { data(); }
+    void bitwiseOrInPlace();
+    void invert_data() { data(); }
+    void invert();
+    void countBits_data() { data(); }
+    void countBits();
+    void iterateSetBits_data() { data(); }
+    void iterateSetBits();
+    void rank_data() { data(); }
+    void rank();
+    void select_data() { data(); }
+    void select();
+
+private:
+    void data();
+};
+
+static QBitArray randomBitArray(qsizetype size, int percentSet)
+{
+    QRandomGenerator rng(size + percentSet);
+    QBitArray ba(size);
+    for (qsizetype i = 0; i < size; ++i) {
+        if (int(rng.bounded(100)) < percentSet)
+            ba.setBit(i);
+    }
+    return ba;
+}
+
+void tst_QBitArray::data()
+{
+    QTest::addColumn<QBitArray>("bits");
+
+    for (qsizetype size : { 1 << 10, 1 << 16, 1 << 24 }) {
+        for (int percentSet : { 1, 50 }) {
+            QTest::addRow("%lld bits, %d%% set", qlonglong(size), percentSet)
+                    << randomBitArray(size, percentSet);
+        }
+    }
+}
+
+void tst_QBitArray::bitwiseAnd()
+{
+    QFETCH(QBitArray, bits);
+    const QBitArray other = ~bits;
+    QBENCHMARK {
+        const QBitArray result = bits & other;
+        Q_UNUSED(result);
+    }
+}
+
+void tst_QBitArray::bitwiseOrInPlace()
+{
+    QFETCH(QBitArray, bits);
+    const QBitArray other = ~bits;
+    bits.detach();
+    QBENCHMARK {
+        bits |= other;
+    }
+}
+
+void tst_QBitArray::invert()
+{
+    QFETCH(QBitArray, bits);
+    QBENCHMARK {
+        const QBitArray result = ~bits;
+        Q_UNUSED(result);
+    }
+}
+
+void tst_QBitArray::countBits()
+{
+    QFETCH(QBitArray, bits);
+    qsizetype count = 0;
+    QBENCHMARK {
+        count = bits.count(true);
+    }
+    QVERIFY(count <= bits.size());
+}
+
+void tst_QBitArray::iterateSetBits()
+{
+    QFETCH(QBitArray, bits);
+    qsizetype visited = 0;
+    QBENCHMARK {
+        visited = 0;
+        for (qsizetype i = bits.indexOf(true); i != -1; i = bits.indexOf(true, i + 1))
+            ++visited;
+    }
+    QCOMPARE(visited, bits.count(true));
+}
+
+void tst_QBitArray::rank()
+{
+    QFETCH(QBitArray, bits);
+    const QBitArrayRankSelect index(bits);
+    qsizetype sum = 0;
+    QBENCHMARK {
+        for (qsizetype i = 0; i < bits.size(); i += 997)
+            sum += index.rank(i);
+    }
+    QVERIFY(sum >= 0);
+}
+
+void tst_QBitArray::select()
+{
+    QFETCH(QBitArray, bits);
+    const QBitArrayRankSelect index(bits);
+    const qsizetype count = index.count();
+    qsizetype sum = 0;
+    QBENCHMARK {
+        for (qsizetype n = 0; n < count; n += 97)
+            sum += index.select(n);
+    }
+    QVERIFY(sum >= 0);
+}
+
+QTEST_MAIN(tst_QBitArray)
+
+#include "tst_bench_qbitarray.moc"
@@ -0,0 +1,117 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QAtomicInt>
+#include <QCache>
+#include <QConcurrentCache>
+#include <QMutex>
+#include <QSemaphore>
+#include <QThread>
+
+#include <memory>
+#include <vector>
+
+// Compares QConcurrentCache against the usual QCache guarded by a single
+// QMutex, with an increasing number of threads looking up keys and creating
+// the missing values. The keys are skewed towards small values, so that some
+// are much more popular than others, as in real caches.
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void lockedQCache_data() { data(); }
+    void lockedQCache();
+    void concurrentCache_data() { data(); }
+    void concurrentCache();
+
+private:
+    void data();
+};
+
+static constexpr int KeyCount = 1 << 16;
+static constexpr int Capacity = KeyCount / 8;
+static constexpr int OperationsPerThread = 200'000;
+
+struct LockedCache
+{
+    QMutex mutex;
+    QCache<int, int> cache{Capacity};
+
+    template <typename Factory>
+    int findOrCompute(int key, Factory &&factory)
+    {
+        QMutexLocker locker(&mutex);
+        if (const int *value = cache.object(key))
+            return *value;
+        const int value = factory();
+        cache.insert(key, new int(value));
+        return value;
+    }
+};
+
+void tst_QConcurrentCache::data()
+{
+    QTest::addColumn<int>("threads");
+
+    for (int threads : { 1, 2, 4, 8, 16 })
+        QTest::addRow("threads=%d", threads) << threads;
+}
+
+// Runs \a threads threads, each doing OperationsPerThread calls of
+// findOrCompute() on pseudo-random keys; only the time between the start and
+// the end of the work is measured.
+template <typename Cache>
+static void run(Cache &cache, int threads)
+{
+    QSemaphore ready;
+    QSemaphore go;
+    QAtomicInt sum;
+    std::vector<std::unique_ptr<QThread>> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back(QThread::create([&, t] {
+            quint32 state = 2463534242u + t;
+            ready.release();
+            go.acquire();
+            int total = 0;
+            for (int i = 0; i < OperationsPerThread; ++i) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                const qint64 r = state % KeyCount;
+                const int key = int(r * r / KeyCount);
+                total += cache.findOrCompute(key, [key] { return key * 2; });
+            }
+            sum.fetchAndAddRelaxed(total);
+        }));
+        workers.back()->start();
+    }
+    ready.acquire(threads);
+
+    QBENCHMARK_ONCE {
+        go.release(threads);
+        for (auto &worker : workers)
+            worker->wait();
+    }
+}
+
+void tst_QConcurrentCache::lockedQCache()
+{
+    QFETCH(int, threads);
+
+    LockedCache cache;
+    run(cache, threads);
+}
+
+void tst_QConcurrentCache::concurrentCache()
+{
+    QFETCH(int, threads);
+
+    QConcurrentCache<int, int> cache(Capacity);
+    run(cache, threads);
+}
+
+QTEST_MAIN(tst_QConcurrentCache)
+#include "tst_bench_qconcurrentcache.moc"
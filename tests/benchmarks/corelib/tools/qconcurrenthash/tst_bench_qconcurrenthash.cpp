@@ -0,0 +1,133 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QAtomicInt>
+#include <QConcurrentHash>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QSemaphore>
+#include <QThread>
+
+#include <memory>
+#include <vector>
+
+// Compares QConcurrentHash against the usual QHash guarded by a single
+// QReadWriteLock, with an increasing number of threads hammering the table.
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void lockedQHash_data() { data(); }
+    void lockedQHash();
+    void concurrentHash_data() { data(); }
+    void concurrentHash();
+
+private:
+    void data();
+};
+
+static constexpr int KeyCount = 1 << 16;
+static constexpr int OperationsPerThread = 200'000;
+
+struct LockedHash
+{
+    mutable QReadWriteLock lock;
+    QHash<int, int> hash;
+
+    std::optional<int> find(int key) const
+    {
+        QReadLocker locker(&lock);
+        const auto it = hash.constFind(key);
+        return it == hash.cend() ? std::nullopt : std::optional<int>(*it);
+    }
+    void insert(int key, int value)
+    {
+        QWriteLocker locker(&lock);
+        hash.insert(key, value);
+    }
+};
+
+void tst_QConcurrentHash::data()
+{
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<int>("writePercent");
+
+    for (int threads : { 1, 2, 4, 8, 16 }) {
+        for (int writePercent : { 0, 10, 50 }) {
+            QTest::addRow("threads=%d,writes=%d%%", threads, writePercent)
+                    << threads << writePercent;
+        }
+    }
+}
+
+// Runs \a threads threads, each doing OperationsPerThread lookups or inserts
+// on pseudo-random keys; only the time between the start and the end of the
+// work is measured.
+template <typename Hash>
+static void run(Hash &hash, int threads, int writePercent)
+{
+    QSemaphore ready;
+    QSemaphore go;
+    QAtomicInt hits;
+    std::vector<std::unique_ptr<QThread>> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back(QThread::create([&, t] {
+            quint32 state = 2463534242u + t;
+            ready.release();
+            go.acquire();
+            int found = 0;
+            for (int i = 0; i < OperationsPerThread; ++i) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                const int key = int(state % KeyCount);
+                if (int(state >> 24) % 100 < writePercent)
+                    hash.insert(key, i);
+                else
+                    found += hash.find(key).has_value();
+            }
+            hits.fetchAndAddRelaxed(found);
+        }));
+        workers.back()->start();
+    }
+    ready.acquire(threads);
+
+    QBENCHMARK_ONCE {
+        go.release(threads);
+        for (auto &worker : workers)
+            worker->wait();
+    }
+}
+
+template <typename Hash>
+static void fill(Hash &hash)
+{
+    for (int i = 0; i < KeyCount; i += 2)
+        hash.insert(i, i);
+}
+
+void tst_QConcurrentHash::lockedQHash()
+{
+    QFETCH(int, threads);
+    QFETCH(int, writePercent);
+
+    LockedHash hash;
+    fill(hash);
+    run(hash, threads, writePercent);
+}
+
+void tst_QConcurrentHash::concurrentHash()
+{
+    QFETCH(int, threads);
+    QFETCH(int, writePercent);
+
+    QConcurrentHash<int, int> hash;
+    fill(hash);
+    run(hash, threads, writePercent);
+}
+
+QTEST_MAIN(tst_QConcurrentHash)
+#include "tst_bench_qconcurrenthash.moc"
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QByteArray>
+#include <QElapsedTimer>
 #include <QCryptographicHash>
 #include <QFile>
 #include <QMetaEnum>
@@ -33,6 +34,14 @@ private Q_SLOTS:
     void addData();
     void addDataChunked_data() { hash_data(); }
     void addDataChunked();
+    void throughput_data();
+    void throughput();
+
+    // many independent messages:
+    void hashMany_data();
+    void hashMany();
+    void hashEach_data() { hashMany_data(); }
+    void hashEach();
 
     // QMessageAuthenticationCode:
     void hmac_hash_data() { hash_data(); }
@@ -142,6 +151,89 @@ void tst_QCryptographicHash::addDataChunked()
     }
 }
 
+void tst_QCryptographicHash::throughput_data()
+{
+    QTest::addColumn<Algorithm>("algo");
+    for_each_algorithm([] (Algorithm algo, const char *name) {
+        if (algo == Algorithm::NumAlgorithms)
+            return;
+        QTest::addRow("%s", name) << algo;
+    });
+}
+
+// Reports the bulk hashing speed in bytes per second on one core
+void tst_QCryptographicHash::throughput()
+{
+    QFETCH(const Algorithm, algo);
+
+    SKIP_IF_NOT_SUPPORTED(algo);
+
+    QCryptographicHash hash(algo);
+    QElapsedTimer timer;
+    qint64 bytes = 0;
+    timer.start();
+    do {
+        for (int i = 0; i < 16; ++i)
+            hash.addData(blockOfData);
+        bytes += 16 * blockOfData.size();
+    } while (timer.elapsed() < 250);
+    const qint64 ns = timer.nsecsElapsed();
+    [[maybe_unused]]
+    auto r = hash.resultView();
+
+    QTest::setBenchmarkResult(qreal(bytes) * 1e9 / qreal(ns), QTest::BytesPerSecond);
+}
+
+void tst_QCryptographicHash::hashMany_data()
+{
+    QTest::addColumn<Algorithm>("algo");
+    QTest::addColumn<QList<QByteArrayView>>("messages");
+
+    static const int datasizes[] = { 64, 1000, 4096, 65536 };
+    for (int size : datasizes) {
+        // 4 MiB or 1024 messages, whichever is less
+        QList<QByteArrayView> messages;
+        for (int i = 0; i < qMin(1024, (4 << 20) / size); ++i) {
+            const int offset = (i * 61) % (MaxBlockSize - size + 1);
+            messages.append(QByteArrayView(blockOfData.constData() + offset, size));
+        }
+
+        for (Algorithm algo : { Algorithm::Sha1, Algorithm::Sha224, Algorithm::Sha256,
+                                Algorithm::Blake2b_256, Algorithm::Blake2s_256 }) {
+            QTest::addRow("%s-%dx%d", QMetaEnum::fromType<Algorithm>().valueToKey(algo),
+                          int(messages.size()), size) << algo << messages;
+        }
+    }
+}
+
+void tst_QCryptographicHash::hashMany()
+{
+    QFETCH(const Algorithm, algo);
+    QFETCH(const QList<QByteArrayView>, messages);
+
+    SKIP_IF_NOT_SUPPORTED(algo);
+
+    QBENCHMARK {
+        [[maybe_unused]]
+        auto r = QCryptographicHash::hashMany(messages, algo);
+    }
+}
+
+void tst_QCryptographicHash::hashEach()
+{
+    QFETCH(const Algorithm, algo);
+    QFETCH(const QList<QByteArrayView>, messages);
+
+    SKIP_IF_NOT_SUPPORTED(algo);
+
+    QBENCHMARK {
+        for (QByteArrayView message : messages) {
+            [[maybe_unused]]
+            auto r = QCryptographicHash::hash(message, algo);
+        }
+    }
+}
+
 static QByteArray hmacKey() {
     static QByteArray key = [] {
             QByteArray result(277, Qt::Uninitialized);
@@ -24,6 +24,10 @@ private slots:
     void benchmark();
     void benchmarkSelectPrepared_data() { generic_data(); }
     void benchmarkSelectPrepared();
+    void benchmarkPrepareNewQuery_data() { generic_data(); }
+    void benchmarkPrepareNewQuery();
+    void benchmarkExecBatch_data() { generic_data(); }
+    void benchmarkExecBatch();
 
 private:
     // returns all database connections
@@ -115,4 +119,54 @@ void tst_QSqlQuery::benchmarkSelectPrepared()
     }
 }
 
+// a new QSqlQuery for the same statement each time, as in a function that
+// looks something up
+void tst_QSqlQuery::benchmarkPrepareNewQuery()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    QSqlQuery q(db);
+    TableScope ts(db, "benchmark", __FILE__);
+
+    QVERIFY_SQL(q, exec("CREATE TABLE " + ts.tableName() + "(id INT NOT NULL, txt VARCHAR(20))"));
+    QVERIFY_SQL(q, exec("INSERT INTO " + ts.tableName() + " VALUES (1, 'one'), (2, 'two')"));
+
+    const QString select = "SELECT txt FROM " + ts.tableName() + " WHERE id = ?";
+    int i = 0;
+    QBENCHMARK {
+        QSqlQuery lookup(db);
+        QVERIFY_SQL(lookup, prepare(select));
+        lookup.addBindValue(i++ % 2 + 1);
+        QVERIFY_SQL(lookup, exec());
+        QVERIFY(lookup.next());
+    }
+}
+
+void tst_QSqlQuery::benchmarkExecBatch()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    QSqlQuery q(db);
+    TableScope ts(db, "benchmark", __FILE__);
+
+    QVERIFY_SQL(q, exec("CREATE TABLE " + ts.tableName() + "(id INT NOT NULL, txt VARCHAR(20))"));
+
+    const int NUM_ROWS = 10000;
+    QVariantList ids;
+    QVariantList texts;
+    for (int i = 0; i < NUM_ROWS; ++i) {
+        ids << i;
+        texts << QString("Value" + QString::number(i));
+    }
+
+    QVERIFY_SQL(q, prepare("INSERT INTO " + ts.tableName() + " VALUES (?, ?)"));
+    QBENCHMARK {
+        q.addBindValue(ids);
+        q.addBindValue(texts);
+        QVERIFY_SQL(q, execBatch());
+    }
+}
+
 #include "main.moc"